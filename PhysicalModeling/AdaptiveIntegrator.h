@@ -0,0 +1,694 @@
+/** @file	AdaptiveIntegrator.h
+	@brief	header for embedded Runge-Kutta integration with adaptive
+	step size control
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_ADAPTIVEINTEGRATOR_H_
+#define _PHYSICALMODELING_ADAPTIVEINTEGRATOR_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/SpringNetwork.h>
+#include <PhysicalModeling/SpringForceKernel.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+#include <cmath>
+
+namespace PhysicalModeling {
+
+/** @defgroup gIntegrators Integrators
+	@brief Time integration of spring-damper systems with error control.
+	@{
+*/
+
+/** @brief Butcher tableau of the Dormand-Prince 5(4) pair.
+
+	Fifth-order solution with a fourth-order embedded error estimate; the
+	last stage is evaluated at the new state, so it is reused as the
+	first stage of the next step.
+*/
+struct DormandPrince45 {
+	enum { stages = 7, errorOrder = 4 };
+
+	static double a(int i, int j) {
+		static const double table[7][6] = {
+			{0, 0, 0, 0, 0, 0},
+			{1.0 / 5, 0, 0, 0, 0, 0},
+			{3.0 / 40, 9.0 / 40, 0, 0, 0, 0},
+			{44.0 / 45, -56.0 / 15, 32.0 / 9, 0, 0, 0},
+			{19372.0 / 6561, -25360.0 / 2187, 64448.0 / 6561, -212.0 / 729, 0, 0},
+			{9017.0 / 3168, -355.0 / 33, 46732.0 / 5247, 49.0 / 176, -5103.0 / 18656, 0},
+			{35.0 / 384, 0, 500.0 / 1113, 125.0 / 192, -2187.0 / 6784, 11.0 / 84}
+		};
+		return table[i][j];
+	}
+
+	static double b(int i) {
+		static const double table[7] = {35.0 / 384, 0, 500.0 / 1113, 125.0 / 192, -2187.0 / 6784, 11.0 / 84, 0};
+		return table[i];
+	}
+
+	/// @brief Difference between the solution and embedded weights
+	static double e(int i) {
+		static const double table[7] = {
+			35.0 / 384 - 5179.0 / 57600,
+			0,
+			500.0 / 1113 - 7571.0 / 16695,
+			125.0 / 192 - 393.0 / 640,
+			-2187.0 / 6784 + 92097.0 / 339200,
+			11.0 / 84 - 187.0 / 2100,
+			-1.0 / 40
+		};
+		return table[i];
+	}
+
+	static double c(int i) {
+		static const double table[7] = {0, 1.0 / 5, 3.0 / 10, 4.0 / 5, 8.0 / 9, 1, 1};
+		return table[i];
+	}
+};
+
+/** @brief Butcher tableau of the Bogacki-Shampine 3(2) pair.
+
+	Cheaper per step than DormandPrince45, and a better choice at loose
+	tolerances. Also reuses its last stage.
+*/
+struct BogackiShampine23 {
+	enum { stages = 4, errorOrder = 2 };
+
+	static double a(int i, int j) {
+		static const double table[4][3] = {
+			{0, 0, 0},
+			{1.0 / 2, 0, 0},
+			{0, 3.0 / 4, 0},
+			{2.0 / 9, 1.0 / 3, 4.0 / 9}
+		};
+		return table[i][j];
+	}
+
+	static double b(int i) {
+		static const double table[4] = {2.0 / 9, 1.0 / 3, 4.0 / 9, 0};
+		return table[i];
+	}
+
+	static double e(int i) {
+		static const double table[4] = {2.0 / 9 - 7.0 / 24, 1.0 / 3 - 1.0 / 4, 4.0 / 9 - 1.0 / 3, -1.0 / 8};
+		return table[i];
+	}
+
+	static double c(int i) {
+		static const double table[4] = {0, 1.0 / 2, 3.0 / 4, 1};
+		return table[i];
+	}
+};
+
+/** @brief Event source for AdaptiveIntegrator::integrate() with no events.
+
+	An event source reports a set of continuous event functions of the
+	state. An event fires when its function goes from non-negative to
+	negative within a step; handleEvent() is then called at the located
+	time, and should change the system so that the function is
+	non-negative again (for instance by negating it, as a contact does
+	when it switches on or off).
+
+	handleEvent() is also given the state and its derivative just before
+	the event. It returns true if it updated the derivative to the one
+	after the event, so the integrator need not evaluate the whole system
+	again, or false to leave that to the integrator.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct NoEvents {
+	std::size_t eventCount() const { return 0; }
+	void eventValues(Precision, const std::vector<Precision> &, std::vector<Precision> &) const {}
+	bool handleEvent(std::size_t, Precision, const std::vector<Precision> &, std::vector<Precision> &) {
+		return false;
+	}
+};
+
+/** @brief Embedded Runge-Kutta integrator that chooses its own step size.
+
+	Integrates a system given as a functor
+	@code
+	void operator()(Precision t, const std::vector<Precision> & y, std::vector<Precision> & dydt);
+	@endcode
+	that evaluates the derivative of the whole state at once, so a system
+	can sweep over all of its springs in one pass per stage.
+
+	Each step is accepted when the RMS over components of
+	@f$ e_i / (atol_i + rtol \max(|y_i|, |\hat y_i|)) @f$ is at most one,
+	where e is the difference between the solution and the embedded
+	lower-order estimate. The next step is scaled from the error with the
+	usual safety factor and growth limits. Absolute tolerances carry the
+	dimensions of their state components; components without one use the
+	relative tolerance as their absolute tolerance.
+
+	The last stage of both supplied tableaux is the derivative at the new
+	state, so it is reused as the first stage of the next step.
+
+	With an event source (see NoEvents), each accepted step is checked
+	for events. A crossing is located by Illinois root finding on the
+	cubic Hermite interpolant of the step, the step is retaken to end
+	just past the earliest crossing, and the event is handled there, so
+	discontinuities such as contact onset fall on step boundaries without
+	shrinking the steps elsewhere.
+*/
+template<class Tableau, class Precision = DimensionedQuantities::DefaultPrecision>
+class AdaptiveIntegrator {
+	public:
+		typedef Tableau tableau_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+
+		AdaptiveIntegrator() :
+			_relTol(Precision(1e-6)),
+			_safety(Precision(0.9)),
+			_minStep(0),
+			_maxStep(std::numeric_limits<Precision>::max()),
+			_h(0),
+			_eventTol(Precision(1e-10)),
+			_accepted(0),
+			_rejected(0),
+			_evaluations(0),
+			_handledEvents(0) {}
+
+		/// @name Tolerances
+		/// @{
+		void setRelativeTolerance(Precision rtol) { _relTol = rtol; }
+
+		/// @brief Absolute tolerance for count state components starting at first
+		template<class Dims>
+		void setAbsoluteTolerance(std::size_t first, std::size_t count,
+				const DimensionedQuantities::Quantity<Dims, Precision> & tol) {
+			if (_absTol.size() < first + count) {
+				_absTol.resize(first + count, Precision(-1));
+			}
+			std::fill(_absTol.begin() + first, _absTol.begin() + first + count, tol.value());
+		}
+		/// @}
+
+		/// @name Step size limits
+		/// @{
+		void setMinStep(const time_t & h) { _minStep = h.value(); }
+		void setMaxStep(const time_t & h) { _maxStep = h.value(); }
+		/// @brief First step to try; zero (the default) picks one automatically
+		void setInitialStep(const time_t & h) { _h = h.value(); }
+		/// @}
+
+		/** @brief Integrate y from t0 to t1.
+
+			The step size carries over between calls.
+
+			@returns false if the step size fell below the minimum step, in
+			which case y holds the state at the last accepted step.
+		*/
+		template<class System>
+		bool integrate(System & system, std::vector<Precision> & y, const time_t & t0, const time_t & t1) {
+			NoEvents<Precision> none;
+			return integrate(system, y, t0, t1, none);
+		}
+
+		/// @brief Integrate y from t0 to t1, handling the events of an event source
+		template<class System, class Events>
+		bool integrate(System & system, std::vector<Precision> & y, const time_t & t0, const time_t & t1,
+			Events & events);
+
+		/// @brief Width of the time bracket to which events are located
+		void setEventTolerance(const time_t & tol) { _eventTol = tol.value(); }
+
+		/// @name Statistics, accumulated over all calls
+		/// @{
+		std::size_t acceptedSteps() const { return _accepted; }
+		std::size_t rejectedSteps() const { return _rejected; }
+		std::size_t evaluations() const { return _evaluations; }
+		std::size_t handledEvents() const { return _handledEvents; }
+		/// @}
+
+		/// @brief Step size that will be tried next
+		time_t stepSize() const { return time_t(_h); }
+
+	private:
+		template<class System>
+		Precision _attempt(System & system, Precision t, Precision h, const std::vector<Precision> & y);
+		Precision _initialStep(Precision span, const std::vector<Precision> & y);
+		void _interpolate(Precision theta, Precision h, const std::vector<Precision> & y0, std::vector<Precision> & out) const;
+		template<class Events>
+		Precision _locateEvent(Events & events, std::size_t e, Precision t, Precision h, const std::vector<Precision> & y0);
+		Precision _absoluteTolerance(std::size_t i) const {
+			return (i < _absTol.size() && _absTol[i] >= 0) ? _absTol[i] : _relTol;
+		}
+
+		Precision _relTol;
+		Precision _safety;
+		Precision _minStep;
+		Precision _maxStep;
+		Precision _h;
+		Precision _eventTol;
+		std::size_t _accepted;
+		std::size_t _rejected;
+		std::size_t _evaluations;
+		std::size_t _handledEvents;
+		std::vector<Precision> _absTol;
+
+		/// @name Preallocated workspace
+		/// @{
+		std::vector<std::vector<Precision> > _k;
+		std::vector<Precision> _stage;
+		std::vector<Precision> _yNew;
+		std::vector<Precision> _dense;
+		std::vector<Precision> _g, _gNew, _gDense;
+		/// @}
+};
+
+/** @brief Adapts a SpringNetwork to AdaptiveIntegrator.
+
+	The state vector holds the x, y, and z positions of every node,
+	followed by the x, y, and z velocities. Pinned nodes keep their
+	positions. The network is only read and written by getState() and
+	setState(), or all at once by advance().
+
+	Ground contacts are one-sided springs between a node and a horizontal
+	plane, active only while the node is below the plane. The system is
+	also an event source for them: the event function of each contact is
+	its gap in meters, negated while active, so onset and release are
+	located within a step and only the contact concerned is switched.
+	Spring forces are continuous across the switch, so only that
+	contact's term of the derivative is added or removed.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class SpringNetworkSystem {
+	public:
+		typedef SpringNetwork<Precision> network_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::length, Precision> length_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::speed, Precision> speed_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::accel, Precision> accel_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::stiffness, Precision> stiffness_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::viscosity, Precision> viscosity_t;
+
+		explicit SpringNetworkSystem(network_t & network) :
+			_net(&network),
+			_gx(0),
+			_gy(0),
+			_gz(0) {}
+
+		void setGravity(const accel_t & gx, const accel_t & gy, const accel_t & gz) {
+			_gx = gx.value();
+			_gy = gy.value();
+			_gz = gz.value();
+		}
+
+		std::size_t stateSize() const { return 6 * _net->nodeCount(); }
+		void getState(std::vector<Precision> & state) const;
+		void setState(const std::vector<Precision> & state);
+
+		/// @brief Set the integrator's tolerances for positions and velocities
+		template<class Integrator>
+		void setTolerances(Integrator & integrator, const length_t & position, const speed_t & velocity) const {
+			const std::size_t n = 3 * _net->nodeCount();
+			integrator.setAbsoluteTolerance(0, n, position);
+			integrator.setAbsoluteTolerance(n, n, velocity);
+		}
+
+		/// @name Ground contacts
+		/// @{
+
+		/// @brief Add a contact spring between node and the plane y = height,
+		/// returning its index
+		std::size_t addGroundContact(std::size_t node, const length_t & height,
+				const stiffness_t & stiffness, const viscosity_t & viscosity = viscosity_t()) {
+			_contactNode.push_back(node);
+			_contactHeight.push_back(height.value());
+			_contactK.push_back(stiffness.value());
+			_contactB.push_back(viscosity.value());
+			_contactActive.push_back(_net->y[node] < height.value());
+			return _contactNode.size() - 1;
+		}
+		std::size_t contactCount() const { return _contactNode.size(); }
+		bool contactActive(std::size_t c) const { return _contactActive[c]; }
+		/// @}
+
+		/// @brief Advance the network by dt with the given integrator
+		template<class Integrator>
+		bool advance(Integrator & integrator, const time_t & dt) {
+			getState(_state);
+			const bool ok = integrator.integrate(*this, _state, time_t(0), dt, *this);
+			setState(_state);
+			return ok;
+		}
+
+		/// @brief Derivative of the whole state, for the integrator
+		void operator()(Precision t, const std::vector<Precision> & state, std::vector<Precision> & rate) const;
+
+		/// @name Event source interface, for the integrator
+		/// @{
+		std::size_t eventCount() const { return _contactNode.size(); }
+		void eventValues(Precision t, const std::vector<Precision> & state, std::vector<Precision> & values) const;
+		bool handleEvent(std::size_t c, Precision t, const std::vector<Precision> & state, std::vector<Precision> & rate);
+		/// @}
+
+	private:
+		network_t * _net;
+		Precision _gx, _gy, _gz;
+		std::vector<Precision> _state;
+
+		std::vector<std::size_t> _contactNode;
+		std::vector<Precision> _contactHeight;
+		std::vector<Precision> _contactK;
+		std::vector<Precision> _contactB;
+		std::vector<bool> _contactActive;
+};
+
+// -- inline implementations -- //
+template<class Tableau, class Precision>
+template<class System>
+inline Precision AdaptiveIntegrator<Tableau, Precision>::_attempt(System & system, Precision t, Precision h,
+		const std::vector<Precision> & y) {
+	const std::size_t n = y.size();
+	const int s = Tableau::stages;
+	for (int i = 1; i < s; ++i) {
+		_stage = y;
+		for (int j = 0; j < i; ++j) {
+			const Precision aij = Precision(Tableau::a(i, j)) * h;
+			if (aij != 0) {
+				const std::vector<Precision> & kj = _k[j];
+				for (std::size_t m = 0; m < n; ++m) {
+					_stage[m] += aij * kj[m];
+				}
+			}
+		}
+		system(t + Precision(Tableau::c(i)) * h, _stage, _k[i]);
+		++_evaluations;
+	}
+
+	_yNew = y;
+	Precision sum = 0;
+	for (std::size_t m = 0; m < n; ++m) {
+		Precision delta = 0, err = 0;
+		for (int i = 0; i < s; ++i) {
+			delta += Precision(Tableau::b(i)) * _k[i][m];
+			err += Precision(Tableau::e(i)) * _k[i][m];
+		}
+		_yNew[m] += h * delta;
+		const Precision scale = _absoluteTolerance(m)
+			+ _relTol * std::max(std::fabs(y[m]), std::fabs(_yNew[m]));
+		const Precision ratio = h * err / scale;
+		sum += ratio * ratio;
+	}
+	return n > 0 ? std::sqrt(sum / Precision(n)) : Precision(0);
+}
+
+template<class Tableau, class Precision>
+inline Precision AdaptiveIntegrator<Tableau, Precision>::_initialStep(Precision span,
+		const std::vector<Precision> & y) {
+	// Hairer, Norsett & Wanner's starting step: keep the first-order term
+	// of the error below tolerance
+	Precision d0 = 0, d1 = 0;
+	const std::size_t n = y.size();
+	for (std::size_t m = 0; m < n; ++m) {
+		const Precision scale = _absoluteTolerance(m) + _relTol * std::fabs(y[m]);
+		d0 += (y[m] / scale) * (y[m] / scale);
+		d1 += (_k[0][m] / scale) * (_k[0][m] / scale);
+	}
+	Precision h = Precision(1e-6);
+	if (d0 > Precision(1e-10) && d1 > Precision(1e-10)) {
+		h = Precision(0.01) * std::sqrt(d0 / d1);
+	} else if (d1 > Precision(1e-10)) {
+		h = Precision(0.01) * std::sqrt(Precision(n) / d1);
+	}
+	return std::min(h, std::fabs(span));
+}
+
+template<class Tableau, class Precision>
+inline void AdaptiveIntegrator<Tableau, Precision>::_interpolate(Precision theta, Precision h,
+		const std::vector<Precision> & y0, std::vector<Precision> & out) const {
+	// Cubic Hermite between (y0, f0) and (yNew, f1), with f1 the last stage
+	const std::vector<Precision> & f0 = _k[0];
+	const std::vector<Precision> & f1 = _k[Tableau::stages - 1];
+	out.resize(y0.size());
+	for (std::size_t m = 0; m < y0.size(); ++m) {
+		const Precision delta = _yNew[m] - y0[m];
+		out[m] = (1 - theta) * y0[m] + theta * _yNew[m]
+			+ theta * (theta - 1) * ((1 - 2 * theta) * delta + (theta - 1) * h * f0[m] + theta * h * f1[m]);
+	}
+}
+
+template<class Tableau, class Precision>
+template<class Events>
+inline Precision AdaptiveIntegrator<Tableau, Precision>::_locateEvent(Events & events, std::size_t e,
+		Precision t, Precision h, const std::vector<Precision> & y0) {
+	// Illinois variant of regula falsi on theta in [0, 1]
+	Precision lo = 0, hi = 1;
+	Precision gLo = _g[e], gHi = _gNew[e];
+	int side = 0;
+	for (int it = 0; it < 100 && (hi - lo) * h > _eventTol; ++it) {
+		Precision theta = (lo * gHi - hi * gLo) / (gHi - gLo);
+		if (!(theta > lo && theta < hi)) {
+			theta = (lo + hi) / 2;
+		}
+		_interpolate(theta, h, y0, _dense);
+		events.eventValues(t + theta * h, _dense, _gDense);
+		const Precision g = _gDense[e];
+		if (g < 0) {
+			hi = theta;
+			gHi = g;
+			if (side == -1) {
+				gLo /= 2;
+			}
+			side = -1;
+		} else {
+			lo = theta;
+			gLo = g;
+			if (side == 1) {
+				gHi /= 2;
+			}
+			side = 1;
+		}
+	}
+	return hi;
+}
+
+template<class Tableau, class Precision>
+template<class System, class Events>
+inline bool AdaptiveIntegrator<Tableau, Precision>::integrate(System & system, std::vector<Precision> & y,
+		const time_t & t0, const time_t & t1, Events & events) {
+	const int s = Tableau::stages;
+	const Precision exponent = Precision(-1) / Precision(Tableau::errorOrder + 1);
+	const Precision end = t1.value();
+	const std::size_t eventCount = events.eventCount();
+	Precision t = t0.value();
+
+	_k.resize(s);
+	for (int i = 0; i < s; ++i) {
+		_k[i].resize(y.size());
+	}
+	system(t, y, _k[0]);
+	++_evaluations;
+	if (_h <= 0) {
+		_h = _initialStep(end - t, y);
+	}
+	if (eventCount > 0) {
+		events.eventValues(t, y, _g);
+	}
+
+	while (t < end) {
+		Precision h = std::min(std::min(_h, _maxStep), end - t);
+		bool lastStep = (h == end - t);
+		const Precision err = _attempt(system, t, h, y);
+
+		// Grow by at most 5x, shrink by at most 5x per attempt
+		Precision factor = Precision(5);
+		if (err > 0) {
+			factor = std::min(Precision(5), std::max(Precision(0.2), _safety * std::pow(err, exponent)));
+		}
+
+		if (err > 1) {
+			++_rejected;
+			_h = h * std::min(Precision(1), factor);
+			if (_h < _minStep) {
+				return false;
+			}
+			continue;
+		}
+
+		bool truncated = false;
+		if (eventCount > 0) {
+			events.eventValues(t + h, _yNew, _gNew);
+			Precision earliest = 1;
+			for (std::size_t e = 0; e < eventCount; ++e) {
+				if (_g[e] >= 0 && _gNew[e] < 0) {
+					earliest = std::min(earliest, _locateEvent(events, e, t, h, y));
+				}
+			}
+			if (earliest < 1) {
+				// Retake the step to end just past the earliest crossing.
+				// The error estimate need not shrink with the step, so
+				// check it again and retry shorter if it fails.
+				h *= earliest;
+				const Precision retakenErr = _attempt(system, t, h, y);
+				if (retakenErr > 1) {
+					++_rejected;
+					_h = h * std::max(Precision(0.2), _safety * std::pow(retakenErr, exponent));
+					if (_h < _minStep) {
+						return false;
+					}
+					continue;
+				}
+				lastStep = false;
+				truncated = true;
+				events.eventValues(t + h, _yNew, _gNew);
+			}
+		}
+
+		t = lastStep ? end : t + h;
+		y.swap(_yNew);
+		// First-same-as-last: the final stage was evaluated at the new state
+		_k[0].swap(_k[s - 1]);
+		++_accepted;
+		if (!truncated && (!lastStep || factor < 1)) {
+			_h = h * factor;
+		}
+
+		if (eventCount > 0) {
+			bool fired = false, stale = false;
+			for (std::size_t e = 0; e < eventCount; ++e) {
+				if (_g[e] >= 0 && _gNew[e] < 0) {
+					// The derivative is discontinuous here: the handler patches the last stage if it can
+					if (!events.handleEvent(e, t, y, _k[0])) {
+						stale = true;
+					}
+					++_handledEvents;
+					fired = true;
+				}
+			}
+			if (fired) {
+				if (stale) {
+					system(t, y, _k[0]);
+					++_evaluations;
+				}
+				events.eventValues(t, y, _g);
+			} else {
+				_g.swap(_gNew);
+			}
+		}
+	}
+	return true;
+}
+
+template<class Precision>
+inline void SpringNetworkSystem<Precision>::getState(std::vector<Precision> & state) const {
+	const network_t & net = *_net;
+	const std::size_t n = net.nodeCount();
+	state.resize(6 * n);
+	std::copy(net.x.begin(), net.x.end(), state.begin());
+	std::copy(net.y.begin(), net.y.end(), state.begin() + n);
+	std::copy(net.z.begin(), net.z.end(), state.begin() + 2 * n);
+	std::copy(net.vx.begin(), net.vx.end(), state.begin() + 3 * n);
+	std::copy(net.vy.begin(), net.vy.end(), state.begin() + 4 * n);
+	std::copy(net.vz.begin(), net.vz.end(), state.begin() + 5 * n);
+}
+
+template<class Precision>
+inline void SpringNetworkSystem<Precision>::setState(const std::vector<Precision> & state) {
+	network_t & net = *_net;
+	const std::size_t n = net.nodeCount();
+	std::copy(state.begin(), state.begin() + n, net.x.begin());
+	std::copy(state.begin() + n, state.begin() + 2 * n, net.y.begin());
+	std::copy(state.begin() + 2 * n, state.begin() + 3 * n, net.z.begin());
+	std::copy(state.begin() + 3 * n, state.begin() + 4 * n, net.vx.begin());
+	std::copy(state.begin() + 4 * n, state.begin() + 5 * n, net.vy.begin());
+	std::copy(state.begin() + 5 * n, state.begin() + 6 * n, net.vz.begin());
+}
+
+template<class Precision>
+inline void SpringNetworkSystem<Precision>::operator()(Precision, const std::vector<Precision> & state,
+		std::vector<Precision> & rate) const {
+	const network_t & net = *_net;
+	const std::size_t n = net.nodeCount();
+	rate.resize(6 * n);
+	const Precision * px = &state[0];
+	const Precision * py = px + n;
+	const Precision * pz = py + n;
+	const Precision * vx = pz + n;
+	const Precision * vy = vx + n;
+	const Precision * vz = vy + n;
+	Precision * ax = &rate[3 * n];
+	Precision * ay = ax + n;
+	Precision * az = ay + n;
+
+	// Forces first, accumulated in the acceleration slots
+	std::fill(rate.begin() + 3 * n, rate.end(), Precision(0));
+	accumulateSpringForces(net, px, py, pz, vx, vy, vz, ax, ay, az);
+
+	// Only active contacts push; switching happens at located events
+	for (std::size_t c = 0; c < _contactNode.size(); ++c) {
+		if (_contactActive[c]) {
+			const std::size_t i = _contactNode[c];
+			ay[i] += _contactK[c] * (_contactHeight[c] - py[i]) - _contactB[c] * vy[i];
+		}
+	}
+
+	for (std::size_t i = 0; i < n; ++i) {
+		const Precision w = net.invMass[i];
+		if (w > 0) {
+			rate[i] = vx[i];
+			rate[n + i] = vy[i];
+			rate[2 * n + i] = vz[i];
+			ax[i] = w * ax[i] + _gx;
+			ay[i] = w * ay[i] + _gy;
+			az[i] = w * az[i] + _gz;
+		} else {
+			rate[i] = rate[n + i] = rate[2 * n + i] = 0;
+			ax[i] = ay[i] = az[i] = 0;
+		}
+	}
+}
+
+template<class Precision>
+inline void SpringNetworkSystem<Precision>::eventValues(Precision, const std::vector<Precision> & state,
+		std::vector<Precision> & values) const {
+	const std::size_t n = _net->nodeCount();
+	values.resize(_contactNode.size());
+	for (std::size_t c = 0; c < _contactNode.size(); ++c) {
+		const Precision gap = state[n + _contactNode[c]] - _contactHeight[c];
+		values[c] = _contactActive[c] ? -gap : gap;
+	}
+}
+
+template<class Precision>
+inline bool SpringNetworkSystem<Precision>::handleEvent(std::size_t c, Precision, const std::vector<Precision> & state,
+		std::vector<Precision> & rate) {
+	const std::size_t n = _net->nodeCount();
+	const std::size_t i = _contactNode[c];
+	const Precision w = _net->invMass[i];
+	if (w > 0) {
+		const Precision push = w * (_contactK[c] * (_contactHeight[c] - state[n + i]) - _contactB[c] * state[4 * n + i]);
+		rate[4 * n + i] += _contactActive[c] ? -push : push;
+	}
+	_contactActive[c] = !_contactActive[c];
+	return true;
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_ADAPTIVEINTEGRATOR_H_
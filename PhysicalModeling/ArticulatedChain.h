@@ -0,0 +1,476 @@
+/** @file	ArticulatedChain.h
+	@brief	header for articulated-body (Featherstone) dynamics of
+	spring-jointed serial chains
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_ARTICULATEDCHAIN_H_
+#define _PHYSICALMODELING_ARTICULATEDCHAIN_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstddef>
+#include <cmath>
+
+namespace PhysicalModeling {
+
+/** @defgroup gArticulatedBodies Articulated Bodies
+	@brief O(n) dynamics for serial chains of links joined by spring-damper
+	revolute joints.
+
+	Device linkages and arms are modeled as planar serial chains: link 0 is
+	attached to a fixed base by joint 0, and link i is attached to the end of
+	link i-1 by joint i. Every joint carries an angular spring
+	(dims::ang_stiffness) and damper (dims::ang_viscosity) acting about its
+	rest angle, plus an optional applied torque.
+
+	Joint accelerations are computed with Featherstone's articulated-body
+	algorithm using planar (3-component) spatial vectors, so the cost of a
+	step grows linearly with the number of links. All per-step scratch
+	space is allocated when the chain is constructed: stepping never
+	allocates.
+
+	@code
+	namespace dq = PhysicalModeling::DimensionedQuantities;
+	typedef PhysicalModeling::RevoluteJointParameters<> Joint;
+	std::vector<Joint> joints(3, Joint(dq::SI::Kilograms(0.1),
+		dq::SI::Meters(0.2),
+		dq::SI::KilogramMetersSquared(0.0003),
+		dq::SI::NewtonMetersPerRadian(2.0),
+		dq::SI::NewtonMeterSecondsPerRadian(0.01)));
+	PhysicalModeling::ArticulatedChain<> arm(joints);
+	arm.setJointAngle(0, dq::SI::Radians(0.3));
+	arm.step(dq::SI::Seconds(0.001));
+	@endcode
+
+	@{
+*/
+
+/// @brief Dimension-checked parameters of one revolute joint and the link
+/// it drives.
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct RevoluteJointParameters {
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::mass, Precision> mass_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::length, Precision> length_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::moment_of_inertia, Precision> inertia_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::ang_stiffness, Precision> ang_stiffness_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::ang_viscosity, Precision> ang_viscosity_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::angle, Precision> angle_t;
+
+	/** @brief Constructor
+
+		The link's center of mass defaults to its midpoint, and may be
+		changed afterwards through centerOfMass.
+
+		@param mass Mass of the link
+		@param length Distance from this joint to the next joint in the chain
+		@param inertia Moment of inertia of the link about its center of mass
+		@param stiffness Angular spring constant of the joint
+		@param viscosity Angular damping coefficient of the joint
+		@param restAngle Joint angle at which the spring exerts no torque
+	*/
+	RevoluteJointParameters(const mass_t & mass,
+			const length_t & length,
+			const inertia_t & inertia,
+			const ang_stiffness_t & stiffness,
+			const ang_viscosity_t & viscosity = ang_viscosity_t(),
+			const angle_t & restAngle = angle_t()) :
+		linkMass(mass),
+		linkLength(length),
+		centerOfMass(length.value() / Precision(2)),
+		linkInertia(inertia),
+		jointStiffness(stiffness),
+		jointViscosity(viscosity),
+		jointRestAngle(restAngle) {}
+
+	mass_t linkMass;
+	length_t linkLength;
+	/// @brief Distance along the link from this joint to the link's center of mass
+	length_t centerOfMass;
+	inertia_t linkInertia;
+	ang_stiffness_t jointStiffness;
+	ang_viscosity_t jointViscosity;
+	angle_t jointRestAngle;
+};
+
+/** @brief Planar serial chain of links connected by spring-damper revolute
+	joints, simulated with the articulated-body algorithm.
+
+	Each instance owns its state and its workspace, so independent chains
+	may be stepped concurrently from different threads - see stepChains().
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class ArticulatedChain {
+	public:
+		typedef RevoluteJointParameters<Precision> joint_parameters_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::angle, Precision> angle_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::ang_speed, Precision> ang_speed_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::ang_accel, Precision> ang_accel_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::torque, Precision> torque_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::accel, Precision> accel_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::energy, Precision> energy_t;
+
+		/// @brief Constructor: one entry of joints per link, starting at the base.
+		explicit ArticulatedChain(const std::vector<joint_parameters_t> & joints) :
+				_n(joints.size()),
+				_gx(0),
+				_gy(0),
+				_mass(_n),
+				_length(_n),
+				_com(_n),
+				_inertia(_n),
+				_K(_n),
+				_B(_n),
+				_q0(_n),
+				_q(_n),
+				_qd(_n),
+				_qdd(_n),
+				_tau(_n),
+				_X(4 * _n),
+				_v(3 * _n),
+				_c(3 * _n),
+				_a(3 * _n),
+				_IA(9 * _n),
+				_pA(3 * _n),
+				_U(3 * _n),
+				_D(_n),
+				_u(_n) {
+			for (std::size_t i = 0; i < _n; ++i) {
+				_mass[i] = joints[i].linkMass.value();
+				_length[i] = joints[i].linkLength.value();
+				_com[i] = joints[i].centerOfMass.value();
+				_inertia[i] = joints[i].linkInertia.value();
+				_K[i] = joints[i].jointStiffness.value();
+				_B[i] = joints[i].jointViscosity.value();
+				_q0[i] = joints[i].jointRestAngle.value();
+				_q[i] = _q0[i];
+			}
+		}
+
+		/// @brief Number of joints (equivalently, links) in the chain
+		std::size_t size() const { return _n; }
+
+		/// @brief Set the gravitational acceleration, in base coordinates
+		void setGravity(const accel_t & gx, const accel_t & gy) {
+			_gx = gx.value();
+			_gy = gy.value();
+		}
+
+		/// @name Joint state
+		/// @{
+		angle_t jointAngle(std::size_t i) const { return angle_t(_q[i]); }
+		void setJointAngle(std::size_t i, const angle_t & q) { _q[i] = q.value(); }
+
+		ang_speed_t jointVelocity(std::size_t i) const { return ang_speed_t(_qd[i]); }
+		void setJointVelocity(std::size_t i, const ang_speed_t & qd) { _qd[i] = qd.value(); }
+
+		/// @brief Joint acceleration from the most recent computeAccelerations() or step()
+		ang_accel_t jointAcceleration(std::size_t i) const { return ang_accel_t(_qdd[i]); }
+
+		/// @brief Set an applied (actuator) torque on a joint, in addition
+		/// to the joint's spring and damper. Stays in effect until changed.
+		void setJointTorque(std::size_t i, const torque_t & tau) { _tau[i] = tau.value(); }
+		/// @}
+
+		/// @brief Run the articulated-body algorithm for the current state
+		void computeAccelerations();
+
+		/// @brief Advance the chain by dt using semi-implicit (symplectic) Euler
+		void step(const time_t & dt);
+
+		/// @brief Total energy: link kinetic energy, joint spring potential,
+		/// and gravitational potential relative to the base
+		energy_t energy() const;
+
+	private:
+		/// @brief Set up the parent-to-link transform for link i
+		void _updateTransform(std::size_t i);
+
+		/// @brief out = X m for the planar motion transform of link i
+		void _transformMotion(std::size_t i, const Precision * m, Precision * out) const;
+
+		/// @brief out += X^T f: carries a force on link i back to its parent
+		void _accumulateForceToParent(std::size_t i, const Precision * f, Precision * out) const;
+
+		std::size_t _n;
+		Precision _gx;
+		Precision _gy;
+
+		/// @name Joint and link parameters
+		/// @{
+		std::vector<Precision> _mass;
+		std::vector<Precision> _length;
+		std::vector<Precision> _com;
+		std::vector<Precision> _inertia;
+		std::vector<Precision> _K;
+		std::vector<Precision> _B;
+		std::vector<Precision> _q0;
+		/// @}
+
+		/// @name Joint state
+		/// @{
+		std::vector<Precision> _q;
+		std::vector<Precision> _qd;
+		std::vector<Precision> _qdd;
+		std::vector<Precision> _tau;
+		/// @}
+
+		/// @name Preallocated articulated-body workspace
+		/// @{
+
+		/// @brief cos, sin, and parent-frame joint location per link
+		std::vector<Precision> _X;
+		std::vector<Precision> _v;
+		std::vector<Precision> _c;
+		std::vector<Precision> _a;
+		/// @brief Articulated inertias, 3x3 row-major per link
+		std::vector<Precision> _IA;
+		std::vector<Precision> _pA;
+		std::vector<Precision> _U;
+		std::vector<Precision> _D;
+		std::vector<Precision> _u;
+		/// @}
+};
+
+/** @brief Step many independent chains by the same dt, steps times.
+
+	The chains are split into contiguous ranges, one per thread, on up to
+	threads threads (by default, one per hardware thread). Threads are
+	started and joined on every call, so step many time steps per call.
+	Each chain's result does not depend on the thread count.
+*/
+template<class Precision>
+void stepChains(std::vector<ArticulatedChain<Precision> > & chains,
+		const DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> & dt,
+		std::size_t steps = 1, std::size_t threads = 0) {
+	const std::size_t n = chains.size();
+	const auto stepRange = [&chains, &dt, steps](std::size_t first, std::size_t last) {
+		for (std::size_t i = first; i < last; ++i) {
+			for (std::size_t s = 0; s < steps; ++s) {
+				chains[i].step(dt);
+			}
+		}
+	};
+	if (threads == 0) {
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threads = std::max<std::size_t>(1, std::min(threads, n));
+	if (threads == 1) {
+		stepRange(0, n);
+		return;
+	}
+	std::vector<std::thread> workers;
+	for (std::size_t t = 0; t < threads; ++t) {
+		workers.push_back(std::thread(stepRange, n * t / threads, n * (t + 1) / threads));
+	}
+	for (std::size_t t = 0; t < workers.size(); ++t) {
+		workers[t].join();
+	}
+}
+
+// -- inline implementations -- //
+template<class Precision>
+inline void ArticulatedChain<Precision>::_updateTransform(std::size_t i) {
+	Precision * X = &_X[4 * i];
+	X[0] = std::cos(_q[i]);
+	X[1] = std::sin(_q[i]);
+	X[2] = (i == 0) ? Precision(0) : _length[i - 1];
+	X[3] = 0;
+}
+
+template<class Precision>
+inline void ArticulatedChain<Precision>::_transformMotion(std::size_t i, const Precision * m, Precision * out) const {
+	const Precision * X = &_X[4 * i];
+	const Precision c = X[0], s = X[1], rx = X[2], ry = X[3];
+	out[0] = m[0];
+	out[1] = (s * rx - c * ry) * m[0] + c * m[1] + s * m[2];
+	out[2] = (c * rx + s * ry) * m[0] - s * m[1] + c * m[2];
+}
+
+template<class Precision>
+inline void ArticulatedChain<Precision>::_accumulateForceToParent(std::size_t i, const Precision * f, Precision * out) const {
+	const Precision * X = &_X[4 * i];
+	const Precision c = X[0], s = X[1], rx = X[2], ry = X[3];
+	out[0] += f[0] + (s * rx - c * ry) * f[1] + (c * rx + s * ry) * f[2];
+	out[1] += c * f[1] - s * f[2];
+	out[2] += s * f[1] + c * f[2];
+}
+
+template<class Precision>
+inline void ArticulatedChain<Precision>::computeAccelerations() {
+	// Pass 1: velocities, velocity-product accelerations, and rigid-body
+	// inertias/bias forces, from the base outward.
+	for (std::size_t i = 0; i < _n; ++i) {
+		_updateTransform(i);
+		Precision * v = &_v[3 * i];
+		if (i == 0) {
+			v[0] = v[1] = v[2] = 0;
+		} else {
+			_transformMotion(i, &_v[3 * (i - 1)], v);
+		}
+		v[0] += _qd[i];
+
+		// c = v x (S qd), with S = [1 0 0]^T
+		Precision * c = &_c[3 * i];
+		c[0] = 0;
+		c[1] = v[2] * _qd[i];
+		c[2] = -v[1] * _qd[i];
+
+		// Rigid-body inertia about the joint, center of mass on the link's x axis
+		const Precision m = _mass[i];
+		const Precision cx = _com[i];
+		Precision * I = &_IA[9 * i];
+		I[0] = _inertia[i] + m * cx * cx;	I[1] = 0;	I[2] = m * cx;
+		I[3] = 0;	I[4] = m;	I[5] = 0;
+		I[6] = m * cx;	I[7] = 0;	I[8] = m;
+
+		// pA = v x* (I v); the angular component of I v is not needed
+		const Precision h1 = m * v[1];
+		const Precision h2 = I[6] * v[0] + m * v[2];
+		Precision * p = &_pA[3 * i];
+		p[0] = -v[2] * h1 + v[1] * h2;
+		p[1] = -v[0] * h2;
+		p[2] = v[0] * h1;
+	}
+
+	// Pass 2: articulated inertias, from the tip inward.
+	for (std::size_t k = _n; k-- > 0;) {
+		const Precision * IA = &_IA[9 * k];
+		const Precision * pA = &_pA[3 * k];
+		Precision * U = &_U[3 * k];
+		U[0] = IA[0];
+		U[1] = IA[3];
+		U[2] = IA[6];
+		_D[k] = U[0];
+		_u[k] = _tau[k] - _K[k] * (_q[k] - _q0[k]) - _B[k] * _qd[k] - pA[0];
+
+		if (k == 0) {
+			continue;
+		}
+
+		const Precision invD = Precision(1) / _D[k];
+		Precision Ia[9];
+		for (int r = 0; r < 3; ++r) {
+			for (int col = 0; col < 3; ++col) {
+				Ia[3 * r + col] = IA[3 * r + col] - U[r] * U[col] * invD;
+			}
+		}
+
+		const Precision * c = &_c[3 * k];
+		const Precision uD = _u[k] * invD;
+		Precision pa[3];
+		for (int r = 0; r < 3; ++r) {
+			pa[r] = pA[r] + Ia[3 * r + 1] * c[1] + Ia[3 * r + 2] * c[2] + U[r] * uD;
+		}
+		_accumulateForceToParent(k, pa, &_pA[3 * (k - 1)]);
+
+		// IA_parent += X^T Ia X, one column of X at a time
+		Precision * IAp = &_IA[9 * (k - 1)];
+		for (int col = 0; col < 3; ++col) {
+			Precision e[3] = {0, 0, 0};
+			e[col] = 1;
+			Precision Xe[3];
+			_transformMotion(k, e, Xe);
+			Precision IaXe[3];
+			for (int r = 0; r < 3; ++r) {
+				IaXe[r] = Ia[3 * r] * Xe[0] + Ia[3 * r + 1] * Xe[1] + Ia[3 * r + 2] * Xe[2];
+			}
+			Precision column[3] = {0, 0, 0};
+			_accumulateForceToParent(k, IaXe, column);
+			for (int r = 0; r < 3; ++r) {
+				IAp[3 * r + col] += column[r];
+			}
+		}
+	}
+
+	// Pass 3: accelerations, from the base outward. Gravity is applied as
+	// a fictitious upward acceleration of the base.
+	for (std::size_t i = 0; i < _n; ++i) {
+		Precision * a = &_a[3 * i];
+		if (i == 0) {
+			const Precision base[3] = {0, -_gx, -_gy};
+			_transformMotion(i, base, a);
+		} else {
+			_transformMotion(i, &_a[3 * (i - 1)], a);
+		}
+		const Precision * c = &_c[3 * i];
+		a[1] += c[1];
+		a[2] += c[2];
+
+		const Precision * U = &_U[3 * i];
+		_qdd[i] = (_u[i] - (U[0] * a[0] + U[1] * a[1] + U[2] * a[2])) / _D[i];
+		a[0] += _qdd[i];
+	}
+}
+
+template<class Precision>
+inline void ArticulatedChain<Precision>::step(const time_t & dt) {
+	computeAccelerations();
+	const Precision h = dt.value();
+	for (std::size_t i = 0; i < _n; ++i) {
+		_qd[i] += h * _qdd[i];
+		_q[i] += h * _qd[i];
+	}
+}
+
+template<class Precision>
+inline typename ArticulatedChain<Precision>::energy_t ArticulatedChain<Precision>::energy() const {
+	Precision e = 0;
+	Precision theta = 0;
+	Precision px = 0;
+	Precision py = 0;
+	// World-frame angular velocity and joint velocity, accumulated outward
+	Precision omega = 0;
+	Precision vx = 0;
+	Precision vy = 0;
+	for (std::size_t i = 0; i < _n; ++i) {
+		if (i > 0) {
+			// advance to joint i along link i-1
+			const Precision L = _length[i - 1];
+			px += L * std::cos(theta);
+			py += L * std::sin(theta);
+			vx += -omega * L * std::sin(theta);
+			vy += omega * L * std::cos(theta);
+		}
+		theta += _q[i];
+		omega += _qd[i];
+
+		const Precision ct = std::cos(theta), st = std::sin(theta);
+		const Precision cx = _com[i];
+		const Precision comVx = vx - omega * cx * st;
+		const Precision comVy = vy + omega * cx * ct;
+		e += Precision(0.5) * (_mass[i] * (comVx * comVx + comVy * comVy) + _inertia[i] * omega * omega);
+		e -= _mass[i] * (_gx * (px + cx * ct) + _gy * (py + cx * st));
+
+		const Precision dq = _q[i] - _q0[i];
+		e += Precision(0.5) * _K[i] * dq * dq;
+	}
+	return energy_t(e);
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_ARTICULATEDCHAIN_H_
@@ -0,0 +1,245 @@
+/** @file	BiquadFilter.h
+	@brief	header for compiling spring-dampers into biquad filters, and
+	for running many channels of cascaded biquads at once
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_BIQUADFILTER_H_
+#define _PHYSICALMODELING_BIQUADFILTER_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/ImpulseResponse.h>
+#include <PhysicalModeling/LinearSpringDamper.h>
+#include <PhysicalModeling/SimdPack.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSpringDamperSystems Spring-Damper Systems
+	@{
+*/
+
+/// @brief What a compiled spring-damper filter outputs for its force input
+enum SpringDamperResponse {
+	/// @brief Displacement, in m per N
+	DisplacementResponse = 0,
+	/// @brief Velocity, in m/s per N
+	VelocityResponse = 1
+};
+
+/** @brief Compile a spring-damper sampled every dt into biquad
+	coefficients, from force samples (in N) to displacement or velocity.
+
+	The coefficients are the exact zero-order-hold discretization: for
+	force held constant over each period, the filter reproduces the
+	continuous system at the sample instants, at any dt. The output lags
+	the force by one sample, so b0 is zero.
+*/
+template<class Precision>
+inline SecondOrderSection<Precision> compileBiquad(const LinearSpringDamper<Precision> & sd,
+		const DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> & dt,
+		SpringDamperResponse response = DisplacementResponse) {
+	return Internal::zeroOrderHold(sd.mass().value(), sd.stiffness().value(), sd.viscosity().value(), dt.value(),
+		int(response));
+}
+
+namespace Internal {
+	/// @brief Structure-of-arrays view of a bank: per stage, one entry per channel
+	template<class Precision>
+	struct BiquadLanes {
+		std::size_t channels;
+		std::size_t stages;
+		const Precision * b0;
+		const Precision * b1;
+		const Precision * b2;
+		const Precision * a1;
+		const Precision * a2;
+		Precision * z1;
+		Precision * z2;
+		const Precision * input;
+		Precision * output;
+		std::size_t frames;
+	};
+
+	/** @brief Filter channels [first, first + k W) for the largest k that
+		fits in last, returning the first channel not handled.
+
+		Each block of channels runs through every frame before the next,
+		so its coefficients and state stay in the first-level cache.
+	*/
+	template <int W, class Precision>
+	PHYSICALMODELING_SIMD_INLINE std::size_t biquadBlocks(const BiquadLanes<Precision> & lanes,
+			std::size_t first, std::size_t last) {
+		typedef Simd::Pack<Precision, W> pack_t;
+		const std::size_t C = lanes.channels;
+		std::size_t c = first;
+		for (; c + W <= last; c += W) {
+			for (std::size_t n = 0; n < lanes.frames; ++n) {
+				pack_t x = pack_t::load(lanes.input + n * C + c);
+				for (std::size_t s = 0; s < lanes.stages; ++s) {
+					const std::size_t i = s * C + c;
+					// Transposed direct form II
+					const pack_t y = pack_t::load(lanes.b0 + i) * x + pack_t::load(lanes.z1 + i);
+					(pack_t::load(lanes.b1 + i) * x - pack_t::load(lanes.a1 + i) * y + pack_t::load(lanes.z2 + i))
+						.store(lanes.z1 + i);
+					(pack_t::load(lanes.b2 + i) * x - pack_t::load(lanes.a2 + i) * y).store(lanes.z2 + i);
+					x = y;
+				}
+				x.store(lanes.output + n * C + c);
+			}
+		}
+		return c;
+	}
+
+	/// @brief Arguments of biquadBlocks, for Simd::forEachBlock
+	template <class Precision>
+	struct BiquadKernel {
+		const BiquadLanes<Precision> * lanes;
+
+		template <int W>
+		PHYSICALMODELING_SIMD_INLINE std::size_t blocks(std::size_t first, std::size_t last) const {
+			return biquadBlocks<W>(*lanes, first, last);
+		}
+	};
+
+	/// @brief Filter every channel at the widest lane count available
+	template <class Precision>
+	inline void biquadLanes(const BiquadLanes<Precision> & lanes) {
+		const BiquadKernel<Precision> kernel = { &lanes };
+		Simd::forEachBlock<Precision>(kernel, 0, lanes.channels);
+	}
+} // end of Internal namespace
+
+/** @brief Many independent channels, each a cascade of the same number
+	of biquad sections, filtered together several channels at a time.
+
+	Sections run in transposed direct form II. Samples are interleaved by
+	frame: sample n of channel c is at index n * channelCount() + c, so a
+	block of adjacent channels is one vector load per frame.
+
+	@code
+	PhysicalModeling::BiquadBank<> bank(256);
+	for (std::size_t c = 0; c < 256; ++c) {
+		bank.setSection(c, 0, PhysicalModeling::compileBiquad(actuator[c], dq::SI::Seconds(1.0 / 8000)));
+	}
+	bank.process(forces, displacements, 64);
+	@endcode
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class BiquadBank {
+	public:
+		typedef SecondOrderSection<Precision> section_t;
+
+		/// @brief Create channels of stages sections each, initially passing input through unchanged
+		explicit BiquadBank(std::size_t channels, std::size_t stages = 1);
+
+		std::size_t channelCount() const { return _channels; }
+		std::size_t stageCount() const { return _stages; }
+
+		void setSection(std::size_t channel, std::size_t stage, const section_t & section);
+		section_t section(std::size_t channel, std::size_t stage) const;
+
+		/// @brief Filter frames of interleaved input into interleaved output, which may be the same array
+		void process(const Precision * input, Precision * output, std::size_t frames);
+
+		/// @brief Clear every channel's state
+		void reset() {
+			std::fill(_z1.begin(), _z1.end(), Precision(0));
+			std::fill(_z2.begin(), _z2.end(), Precision(0));
+		}
+
+		/// @brief Clear one channel's state
+		void reset(std::size_t channel) {
+			for (std::size_t s = 0; s < _stages; ++s) {
+				_z1[s * _channels + channel] = 0;
+				_z2[s * _channels + channel] = 0;
+			}
+		}
+
+	private:
+		std::size_t _channels;
+		std::size_t _stages;
+		/// @brief Index stage * channels + channel
+		std::vector<Precision> _b0, _b1, _b2, _a1, _a2;
+		std::vector<Precision> _z1, _z2;
+};
+
+// -- inline implementations -- //
+
+template<class Precision>
+inline BiquadBank<Precision>::BiquadBank(std::size_t channels, std::size_t stages) :
+	_channels(channels),
+	_stages(stages),
+	_b0(channels * stages, Precision(1)),
+	_b1(channels * stages, Precision(0)),
+	_b2(channels * stages, Precision(0)),
+	_a1(channels * stages, Precision(0)),
+	_a2(channels * stages, Precision(0)),
+	_z1(channels * stages, Precision(0)),
+	_z2(channels * stages, Precision(0)) {}
+
+template<class Precision>
+inline void BiquadBank<Precision>::setSection(std::size_t channel, std::size_t stage, const section_t & section) {
+	const std::size_t i = stage * _channels + channel;
+	_b0[i] = section.b0;
+	_b1[i] = section.b1;
+	_b2[i] = section.b2;
+	_a1[i] = section.a1;
+	_a2[i] = section.a2;
+}
+
+template<class Precision>
+inline typename BiquadBank<Precision>::section_t BiquadBank<Precision>::section(std::size_t channel, std::size_t stage) const {
+	const std::size_t i = stage * _channels + channel;
+	section_t ret;
+	ret.b0 = _b0[i];
+	ret.b1 = _b1[i];
+	ret.b2 = _b2[i];
+	ret.a1 = _a1[i];
+	ret.a2 = _a2[i];
+	return ret;
+}
+
+template<class Precision>
+inline void BiquadBank<Precision>::process(const Precision * input, Precision * output, std::size_t frames) {
+	Internal::BiquadLanes<Precision> lanes;
+	lanes.channels = _channels;
+	lanes.stages = _stages;
+	lanes.b0 = _b0.data();
+	lanes.b1 = _b1.data();
+	lanes.b2 = _b2.data();
+	lanes.a1 = _a1.data();
+	lanes.a2 = _a2.data();
+	lanes.z1 = _z1.data();
+	lanes.z2 = _z2.data();
+	lanes.input = input;
+	lanes.output = output;
+	lanes.frames = frames;
+	Internal::biquadLanes(lanes);
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_BIQUADFILTER_H_
@@ -0,0 +1,156 @@
+/** @file	DimensionIds.h
+	@brief	header for stable compile-time identifiers of dimensions
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_DIMENSIONIDS_H_
+#define _PHYSICALMODELING_DIMENSIONIDS_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+
+// Library/third-party includes
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/size.hpp>
+
+// Standard includes
+#include <cstdint>
+#include <cstddef>
+
+namespace PhysicalModeling {
+namespace DimensionedQuantities {
+
+/** @addtogroup gDimensionedQuantities Dimensioned Quantities
+	@{
+*/
+
+	/// @brief 32-bit identifier of the time, mass, length, and angle exponents
+	typedef std::uint32_t dimension_id_t;
+	/// @brief 64-bit identifier of the first eight exponents
+	typedef std::uint64_t dimension_id64_t;
+
+	/** @brief Identifier of a dimension given its exponents of time, mass,
+		length, and angle.
+
+		Each exponent occupies one byte, in two's complement, with time in
+		the lowest byte, so the value depends only on the exponents: it is
+		the same on every compiler and platform, and dimensionless is 0.
+		Distinct dimensions get distinct identifiers as long as every
+		exponent lies in [-128, 127].
+	*/
+	constexpr dimension_id_t dimensionId(int t, int m, int l, int a) {
+		return dimension_id_t(std::uint8_t(t))
+			| (dimension_id_t(std::uint8_t(m)) << 8)
+			| (dimension_id_t(std::uint8_t(l)) << 16)
+			| (dimension_id_t(std::uint8_t(a)) << 24);
+	}
+
+	/** @cond innerworkings
+		@{
+	*/
+	namespace Internal {
+		constexpr dimension_id64_t mixStep(dimension_id64_t x, int shift, dimension_id64_t multiplier) {
+			return (x ^ (x >> shift)) * multiplier;
+		}
+
+		constexpr dimension_id64_t finishMix(dimension_id64_t x) {
+			return x ^ (x >> 31);
+		}
+
+		template <class D, int I>
+		struct packed_exponent {
+			static const int value = mpl::at_c<D, I>::type::value;
+			static_assert(value >= -128 && value <= 127, "dimension exponent does not fit in one byte");
+			static const dimension_id64_t bits = dimension_id64_t(std::uint8_t(value)) << (8 * I);
+		};
+
+		/// @brief Check that exponents past the first eight are all zero
+		template <class D, int I, int N = mpl::size<D>::value>
+		struct trailing_exponents_zero {
+			static const bool value = mpl::at_c<D, I>::type::value == 0
+				&& trailing_exponents_zero<D, I + 1, N>::value;
+		};
+
+		template <class D, int N>
+		struct trailing_exponents_zero<D, N, N> {
+			static const bool value = true;
+		};
+	} // end of Internal namespace
+	/**
+		@}
+		@endcond
+	*/
+
+	/// @brief Mix an identifier into a well-distributed hash (the splitmix64 finalizer)
+	constexpr std::size_t dimensionHash(dimension_id64_t id) {
+		return std::size_t(Internal::finishMix(
+			Internal::mixStep(Internal::mixStep(id, 30, 0xbf58476d1ce4e5b9ULL), 27, 0x94d049bb133111ebULL)));
+	}
+
+	/** @brief Stable compile-time identifiers of dimension D.
+
+		@code
+		switch (id) {
+			case dq::dimension_id<dq::dims::force>::value:
+				// ...
+		}
+		@endcode
+		value is the 32-bit dimensionId() of the time, mass, length, and
+		angle exponents; value64 packs the first eight exponents the same
+		way, and equals value when the rest are zero. Equivalent dimension
+		vectors, such as a product of dimensions and the matching dims::
+		typedef, get the same identifiers. hash is value64 mixed for use in
+		hash tables. None of these need RTTI.
+	*/
+	template <class D>
+	struct dimension_id {
+		static_assert(Internal::trailing_exponents_zero<D, 8>::value,
+			"dimension_id only encodes the first eight exponents");
+
+		static constexpr dimension_id64_t value64 =
+			Internal::packed_exponent<D, 0>::bits | Internal::packed_exponent<D, 1>::bits
+			| Internal::packed_exponent<D, 2>::bits | Internal::packed_exponent<D, 3>::bits
+			| Internal::packed_exponent<D, 4>::bits | Internal::packed_exponent<D, 5>::bits
+			| Internal::packed_exponent<D, 6>::bits | Internal::packed_exponent<D, 7>::bits;
+		static constexpr dimension_id_t value = dimension_id_t(value64);
+		static constexpr std::size_t hash = dimensionHash(value64);
+	};
+
+	template <class D>
+	constexpr dimension_id64_t dimension_id<D>::value64;
+	template <class D>
+	constexpr dimension_id_t dimension_id<D>::value;
+	template <class D>
+	constexpr std::size_t dimension_id<D>::hash;
+
+	/// @brief Identifier of a quantity's dimensions
+	template <class D, class T>
+	constexpr dimension_id_t dimensionId(const Quantity<D, T> &) {
+		return dimension_id<D>::value;
+	}
+
+	/// @brief Hash functor for dimension identifiers in unordered containers
+	struct DimensionIdHash {
+		std::size_t operator()(dimension_id64_t id) const {
+			return dimensionHash(id);
+		}
+	};
+
+/// @}
+// end of doxygen module
+
+} // end of DimensionedQuantities namespace
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_DIMENSIONIDS_H_
@@ -0,0 +1,241 @@
+/** @file	DimensionNames.h
+	@brief	header for compile-time unit strings and names of dimensions
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_DIMENSIONNAMES_H_
+#define _PHYSICALMODELING_DIMENSIONNAMES_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+
+// Library/third-party includes
+#include <boost/mpl/at.hpp>
+
+// Standard includes
+#include <cstddef>
+
+namespace PhysicalModeling {
+namespace DimensionedQuantities {
+
+/** @addtogroup gDimensionedQuantities Dimensioned Quantities
+	@{
+*/
+
+	/** @cond innerworkings
+		@{
+	*/
+	namespace Internal {
+		/// @brief Exponent of base dimension I (Time, Mass, Length, Angle) in D
+		template <class D, int I>
+		struct exponent_of {
+			static const int value = mpl::at_c<D, I>::type::value;
+		};
+
+		/// @brief Fixed-capacity character array usable in constant expressions
+		struct unit_string_storage {
+			enum { capacity = 64 };
+			char data[capacity];
+			std::size_t length;
+
+			constexpr unit_string_storage() : data(), length(0) {}
+
+			constexpr void append(char c) {
+				if (length + 1 < capacity) {
+					data[length++] = c;
+					data[length] = '\0';
+				}
+			}
+
+			constexpr void append(const char * s) {
+				while (*s) {
+					append(*s++);
+				}
+			}
+
+			constexpr void appendPower(const char * symbol, int power) {
+				append(symbol);
+				if (power > 1) {
+					append('^');
+					if (power >= 10) {
+						append(char('0' + power / 10));
+					}
+					append(char('0' + power % 10));
+				}
+			}
+		};
+
+		/** @brief Canonical unit string for exponents of time, mass,
+			length, and angle: numerator terms, then a denominator, with
+			units in the order kg, m, s, rad, as in "kg*m/s^2",
+			"kg*m^2/(s^2*rad)", "1/s", or "1" if dimensionless.
+		*/
+		constexpr unit_string_storage make_unit_string(int t, int m, int l, int a) {
+			const int exps[4] = {t, m, l, a};
+			const char * const unit_symbols[4] = {"s", "kg", "m", "rad"};
+			// Order in which base units appear
+			const int unit_order[4] = {1, 2, 0, 3};
+			unit_string_storage s;
+			int numerator = 0, denominator = 0;
+			for (int k = 0; k < 4; ++k) {
+				const int e = exps[unit_order[k]];
+				if (e > 0) {
+					if (numerator++) {
+						s.append('*');
+					}
+					s.appendPower(unit_symbols[unit_order[k]], e);
+				} else if (e < 0) {
+					++denominator;
+				}
+			}
+			if (!numerator) {
+				s.append('1');
+			}
+			if (denominator) {
+				s.append('/');
+				if (denominator > 1) {
+					s.append('(');
+				}
+				int written = 0;
+				for (int k = 0; k < 4; ++k) {
+					const int e = exps[unit_order[k]];
+					if (e < 0) {
+						if (written++) {
+							s.append('*');
+						}
+						s.appendPower(unit_symbols[unit_order[k]], -e);
+					}
+				}
+				if (denominator > 1) {
+					s.append(')');
+				}
+			}
+			return s;
+		}
+
+		/// @brief Name of the dims:: typedef with these exponents, or a null pointer
+		constexpr const char * known_dimension_name(int t, int m, int l, int a) {
+			struct Entry {
+				int t, m, l, a;
+				const char * name;
+			};
+			// dims::torque and dims::energy are the same type, so torque reports as energy
+			const Entry table[] = {
+				{0, 0, 0, 0, "dimensionless"},
+				{1, 0, 0, 0, "time"},
+				{0, 1, 0, 0, "mass"},
+				{0, 0, 1, 0, "length"},
+				{0, 0, 0, 1, "angle"},
+				{0, 0, 2, 0, "area"},
+				{0, 0, 3, 0, "volume"},
+				{0, 1, -3, 0, "density"},
+				{-1, 0, 1, 0, "speed"},
+				{-2, 0, 1, 0, "accel"},
+				{-1, 0, 0, 1, "ang_speed"},
+				{-2, 0, 0, 1, "ang_accel"},
+				{-2, 1, 1, 0, "force"},
+				{-2, 1, 0, 0, "stiffness"},
+				{-1, 1, 0, 0, "viscosity"},
+				{-2, 1, 2, 0, "energy"},
+				{-2, 1, 2, -1, "ang_stiffness"},
+				{-1, 1, 2, -1, "ang_viscosity"},
+				{0, 1, 2, 0, "moment_of_inertia"}
+			};
+			for (std::size_t i = 0; i < sizeof(table) / sizeof(table[0]); ++i) {
+				if (table[i].t == t && table[i].m == m && table[i].l == l && table[i].a == a) {
+					return table[i].name;
+				}
+			}
+			return nullptr;
+		}
+
+		/// @brief Compile-time string comparison
+		constexpr bool equal_strings(const char * a, const char * b) {
+			while (*a && *a == *b) {
+				++a;
+				++b;
+			}
+			return *a == *b;
+		}
+	} // end of Internal namespace
+	/**
+		@}
+		@endcond
+	*/
+
+	/** @brief Canonical SI unit string of dimension D, built at compile time.
+
+		@code
+		// "kg*m/s^2"
+		const char * units = dq::unit_string<dq::dims::force>::value;
+		@endcode
+		The string is a constant expression, so it costs nothing at run
+		time: suitable for tagging logged or recorded channels. Requires a
+		C++14 compiler.
+	*/
+	template <class D>
+	struct unit_string {
+		static constexpr Internal::unit_string_storage storage = Internal::make_unit_string(
+			Internal::exponent_of<D, 0>::value,
+			Internal::exponent_of<D, 1>::value,
+			Internal::exponent_of<D, 2>::value,
+			Internal::exponent_of<D, 3>::value);
+		static constexpr const char * value = storage.data;
+	};
+
+	template <class D>
+	constexpr Internal::unit_string_storage unit_string<D>::storage;
+	template <class D>
+	constexpr const char * unit_string<D>::value;
+
+	/** @brief Short name of dimension D: the name of the matching dims::
+		typedef (such as "force"), or its unit string if there is none.
+	*/
+	template <class D>
+	struct dimension_name {
+		static constexpr const char * value = Internal::known_dimension_name(
+			Internal::exponent_of<D, 0>::value,
+			Internal::exponent_of<D, 1>::value,
+			Internal::exponent_of<D, 2>::value,
+			Internal::exponent_of<D, 3>::value) ?
+			Internal::known_dimension_name(
+				Internal::exponent_of<D, 0>::value,
+				Internal::exponent_of<D, 1>::value,
+				Internal::exponent_of<D, 2>::value,
+				Internal::exponent_of<D, 3>::value) :
+			unit_string<D>::value;
+	};
+
+	template <class D>
+	constexpr const char * dimension_name<D>::value;
+
+	/// @brief Unit string of a quantity's dimensions
+	template <class D, class T>
+	constexpr const char * unitString(const Quantity<D, T> &) {
+		return unit_string<D>::value;
+	}
+
+	/// @brief Short name of a quantity's dimensions
+	template <class D, class T>
+	constexpr const char * dimensionName(const Quantity<D, T> &) {
+		return dimension_name<D>::value;
+	}
+
+/// @}
+// end of doxygen module
+
+} // end of DimensionedQuantities namespace
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_DIMENSIONNAMES_H_
@@ -25,21 +25,25 @@
 // - none
 
 // Library/third-party includes
-#include <boost/static_assert.hpp>
-
 /// @name Boost MPL headers
 /// @{
 #include <boost/mpl/vector_c.hpp>
+#include <boost/mpl/at.hpp>
 #include <boost/mpl/plus.hpp>
 #include <boost/mpl/minus.hpp>
 #include <boost/mpl/divides.hpp>
+#include <boost/mpl/multiplies.hpp>
 #include <boost/mpl/equal.hpp>
+#include <boost/mpl/equal_to.hpp>
 #include <boost/mpl/transform.hpp>
 #include <boost/mpl/placeholders.hpp>
 /// @}
 
 // Standard includes
 #include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace PhysicalModeling {
 
@@ -209,10 +213,10 @@ namespace DimensionedQuantities {
 	typedef mpl::vector_c<int,-2,1,1,0,0,0,0,0, DQ_DIMPAD> force;
 
 	/// @brief Linear stiffness (by convention, in @f$ \frac{N}{m} @f$, equivalent to  @f$ \frac{kg}{s^2} @f$)
-	typedef mpl::vector_c<int,-2,0,1,0,0,0,0,0, DQ_DIMPAD> stiffness;
+	typedef mpl::vector_c<int,-2,1,0,0,0,0,0,0, DQ_DIMPAD> stiffness;
 
 	/// @brief Damping coefficient (viscosity) (by convention, in @f$ \frac{N\cdot s}{m} @f$, equivalent to @f$ \frac{kg}{s} @f$)
-	typedef mpl::vector_c<int,-1,0,1,0,0,0,0,0, DQ_DIMPAD> viscosity;
+	typedef mpl::vector_c<int,-1,1,0,0,0,0,0,0, DQ_DIMPAD> viscosity;
 
 	/// @brief Torque (by convention, in @f$N m @f$)
 	typedef mpl::vector_c<int,-2,1,2,0,0,0,0,0, DQ_DIMPAD> torque;
@@ -226,6 +230,9 @@ namespace DimensionedQuantities {
 	/// @brief Moment of inertia (mass times distance squared) (by convention, in @f$ Kg \cdot m^2 @f$)
 	typedef mpl::vector_c<int,0,1,2,0,0,0,0,0, DQ_DIMPAD> moment_of_inertia;
 
+	/// @brief Energy (by convention, in Joules, equivalent to @f$ \frac{kg \cdot m^2}{s^2} @f$ - dimensionally identical to torque)
+	typedef mpl::vector_c<int,-2,1,2,0,0,0,0,0, DQ_DIMPAD> energy;
+
 	/// @}
 
 	} // end of namespace dims
@@ -263,17 +270,18 @@ namespace DimensionedQuantities {
 		/** @brief Conversion constructor, to handle results of multiplication
 			and division.
 
-			Compile-time assert included to handle dimensions safely:  See
+			This conversion is needed because the dimensions computed by an
+			operation are a different MPL sequence type than the named
+			dimension typedefs, even when equal: See
 			http://www.boost.org/doc/libs/1_43_0/libs/mpl/doc/tutorial/implementing.html
-			for why this conversion and assert is needed.
+			It only takes part in overload resolution when the dimensions are
+			equal, so a mismatch is an ordinary "no conversion" error, and
+			std::is_convertible can detect it.
 		*/
 		template <class OtherDimensions>
-		Quantity(Quantity<OtherDimensions, Precision> const& rhs)
-				: _value(rhs.value()) {
-			BOOST_STATIC_ASSERT((
-				mpl::equal<Dimensions,OtherDimensions>::type::value
-			));
-		}
+		Quantity(Quantity<OtherDimensions, Precision> const& rhs,
+				typename std::enable_if<mpl::equal<Dimensions, OtherDimensions>::type::value>::type * = 0)
+				: _value(rhs.value()) {}
 
 		/// @brief Retrieve the quantity's value without dimensional data.
 		Precision & value() { return _value; }
@@ -352,16 +360,55 @@ namespace DimensionedQuantities {
 		: mpl::transform<D1,D2,mpl::minus<mpl::placeholders::_1,mpl::placeholders::_2> >
 		{};
 
-		/// @todo assert that the dimensions are divisible by 2?
+		/// @brief Half of each exponent, truncated: see even_dimensions
 		template <class D>
 		struct sqrt_dimensions
-		: mpl::transform<D,mpl::int_<2>,mpl::divides<mpl::placeholders::_1,mpl::placeholders::_2> >
+		: mpl::transform<D,mpl::divides<mpl::placeholders::_1,mpl::int_<2> > >
 		{};
 
+		template <class D, int N>
+		struct power_dimensions
+		: mpl::transform<D,mpl::multiplies<mpl::placeholders::_1,mpl::int_<N> > >
+		{};
 
+		/// @brief Whether every exponent of D is even, so sqrt_dimensions is exact
+		template <class D>
+		struct even_dimensions
+		: mpl::equal<typename power_dimensions<typename sqrt_dimensions<D>::type, 2>::type, D,
+			mpl::equal_to<mpl::placeholders::_1,mpl::placeholders::_2> >::type
+		{};
 
+		/// @brief The vector_c spelling of D, so that computed dimensions
+		/// are the same type as the matching dims:: typedef
 		template <class D>
-		struct sqrt_dims : mpl::divides<D, mpl::int_<2>::type > {};
+		struct canonical_dimensions {
+			typedef mpl::vector_c<int,
+				mpl::at_c<D,0>::type::value, mpl::at_c<D,1>::type::value,
+				mpl::at_c<D,2>::type::value, mpl::at_c<D,3>::type::value,
+				mpl::at_c<D,4>::type::value, mpl::at_c<D,5>::type::value,
+				mpl::at_c<D,6>::type::value, mpl::at_c<D,7>::type::value,
+				mpl::at_c<D,8>::type::value, mpl::at_c<D,9>::type::value,
+				mpl::at_c<D,10>::type::value, mpl::at_c<D,11>::type::value,
+				mpl::at_c<D,12>::type::value, mpl::at_c<D,13>::type::value,
+				mpl::at_c<D,14>::type::value, mpl::at_c<D,15>::type::value,
+				mpl::at_c<D,16>::type::value, mpl::at_c<D,17>::type::value,
+				mpl::at_c<D,18>::type::value, mpl::at_c<D,19>::type::value> type;
+		};
+
+		template <class Q>
+		struct quantity_parts;
+
+		template <class D, class T>
+		struct quantity_parts<Quantity<D, T> > {
+			typedef D dimensions;
+			typedef T precision;
+		};
+
+		/// @brief void if every type parameter is well-formed, for detecting valid expressions
+		template <class...>
+		struct make_void {
+			typedef void type;
+		};
 
 		/*
 		double _sqrt(double const& val) {
@@ -383,11 +430,14 @@ namespace DimensionedQuantities {
 	/** @brief Addition operator for quantities with dimensions
 
 		Prevents addition of quantities with incompatible dimensions, and
-		allows addition of quantities with equal dimensions.
+		allows addition of quantities with equal dimensions, including a
+		named dimension and an equal one computed by an operation. The
+		result has the dimension type of the left operand.
 	*/
-	template<class D, class T>
-	Quantity<D, T> operator+(const Quantity<D, T> & l, const Quantity<D, T> & r) {
-		return Quantity<D,T>(l.value() + r.value());
+	template<class D1, class D2, class T>
+	typename std::enable_if<mpl::equal<D1, D2>::type::value, Quantity<D1, T> >::type
+	operator+(const Quantity<D1, T> & l, const Quantity<D2, T> & r) {
+		return Quantity<D1,T>(l.value() + r.value());
 	}
 
 	/** @brief Subtraction operator for quantities with dimensions
@@ -395,9 +445,10 @@ namespace DimensionedQuantities {
 		Prevents subtraction of quantities with incompatible dimensions, and
 		allows subtraction of quantities with equal dimensions.
 	*/
-	template<class D, class T>
-	Quantity<D, T> operator-(const Quantity<D, T> & l, const Quantity<D, T> & r) {
-		return Quantity<D,T>(l.value() - r.value());
+	template<class D1, class D2, class T>
+	typename std::enable_if<mpl::equal<D1, D2>::type::value, Quantity<D1, T> >::type
+	operator-(const Quantity<D1, T> & l, const Quantity<D2, T> & r) {
+		return Quantity<D1,T>(l.value() - r.value());
 	}
 
 	/** @brief Multiplication operator that produces results with new,
@@ -430,13 +481,17 @@ namespace DimensionedQuantities {
 			l.value() / r.value());
 	}
 
-	/** @brief Division operator that produces results with new,
-			appropriate dimensions.
+	/** @brief Square root that produces results with new,
+			appropriate dimensions: half of each exponent.
+
+		Only defined when every exponent is even, so sqrt of a length is
+		a compile error rather than a silently dimensionless result.
 	*/
 	template <class D, class T>
-	Quantity<typename Internal::sqrt_dims<D>::type, T>
+	typename std::enable_if<Internal::even_dimensions<D>::value,
+		Quantity<typename Internal::canonical_dimensions<typename Internal::sqrt_dimensions<D>::type>::type, T> >::type
 	sqrt(Quantity<D, T> const& l) {
-		return Quantity<typename Internal::sqrt_dims<D>::type, T>(
+		return Quantity<typename Internal::canonical_dimensions<typename Internal::sqrt_dimensions<D>::type>::type, T>(
 			std::sqrt(l.value()));
 	}
 
@@ -448,6 +503,137 @@ namespace DimensionedQuantities {
 
 	/// @}
 
+	/** @name Dimensional compatibility traits
+
+		These report whether an operation is valid instead of failing to
+		compile, so generic code can choose an implementation by dimensional
+		compatibility without instantiating the invalid one:
+		@code
+		template <class Q1, class Q2>
+		typename std::enable_if<dq::is_addable<Q1, Q2>::value>::type
+		accumulate(Q1 & total, const Q2 & x);
+		@endcode
+	*/
+	/// @{
+
+	/// @brief Whether T is a Quantity
+	template <class T>
+	struct is_quantity : std::false_type {};
+
+	template <class D, class T>
+	struct is_quantity<Quantity<D, T> > : std::true_type {};
+
+	/// @brief Whether two Quantity types have equal dimensions
+	template <class Q1, class Q2>
+	struct same_dimensions : std::false_type {};
+
+	template <class D1, class T1, class D2, class T2>
+	struct same_dimensions<Quantity<D1, T1>, Quantity<D2, T2> >
+		: std::integral_constant<bool, mpl::equal<D1, D2>::type::value> {};
+
+	/// @brief Whether Q1() + Q2() is valid
+	template <class Q1, class Q2, class = void>
+	struct is_addable : std::false_type {};
+
+	template <class Q1, class Q2>
+	struct is_addable<Q1, Q2,
+		typename Internal::make_void<decltype(std::declval<Q1>() + std::declval<Q2>())>::type>
+		: std::true_type {};
+
+	/// @brief Whether Q1() - Q2() is valid
+	template <class Q1, class Q2, class = void>
+	struct is_subtractable : std::false_type {};
+
+	template <class Q1, class Q2>
+	struct is_subtractable<Q1, Q2,
+		typename Internal::make_void<decltype(std::declval<Q1>() - std::declval<Q2>())>::type>
+		: std::true_type {};
+
+	/// @brief Whether sqrt(Q()) is valid: every exponent of Q is even
+	template <class Q, class = void>
+	struct has_sqrt : std::false_type {};
+
+	template <class Q>
+	struct has_sqrt<Q,
+		typename Internal::make_void<decltype(sqrt(std::declval<Q>()))>::type>
+		: std::true_type {};
+
+	/// @}
+
+	/** @name Dimension algebra on types
+
+		Result types of operations on quantities, for writing code that is
+		generic over dimensions. The results are the same types as the
+		matching dims:: and SI:: typedefs:
+		@code
+		dq::product_t<dq::SI::Kilograms, dq::SI::MetersPerSecondSquared> f; // dq::SI::Newtons
+		dq::integral_t<dq::SI::MetersPerSecondSquared> v; // dq::SI::MetersPerSecond
+		dq::power_t<dq::SI::Meters, 2> a; // dq::Quantity<dq::dims::area>
+		@endcode
+		Both operands of product_t and quotient_t must have the same
+		precision; the result has that precision.
+	*/
+	/// @{
+
+	/// @brief Type of Q1 * Q2
+	template <class Q1, class Q2>
+	using product_t = Quantity<
+		typename Internal::canonical_dimensions<
+			typename Internal::multiply_dimensions<
+				typename Internal::quantity_parts<Q1>::dimensions,
+				typename Internal::quantity_parts<Q2>::dimensions>::type>::type,
+		typename Internal::quantity_parts<Q1>::precision>;
+
+	/// @brief Type of Q1 / Q2
+	template <class Q1, class Q2>
+	using quotient_t = Quantity<
+		typename Internal::canonical_dimensions<
+			typename Internal::divide_dimensions<
+				typename Internal::quantity_parts<Q1>::dimensions,
+				typename Internal::quantity_parts<Q2>::dimensions>::type>::type,
+		typename Internal::quantity_parts<Q1>::precision>;
+
+	/// @brief Type of Q raised to the integer power N (which may be zero or negative)
+	template <class Q, int N>
+	using power_t = Quantity<
+		typename Internal::canonical_dimensions<
+			typename Internal::power_dimensions<
+				typename Internal::quantity_parts<Q>::dimensions, N>::type>::type,
+		typename Internal::quantity_parts<Q>::precision>;
+
+	/// @brief Type of the integral of Q over time, such as length for speed
+	template <class Q>
+	using integral_t = product_t<Q, Quantity<dims::time, typename Internal::quantity_parts<Q>::precision> >;
+
+	/// @brief Type of the time derivative of Q, such as speed for length
+	template <class Q>
+	using derivative_t = quotient_t<Q, Quantity<dims::time, typename Internal::quantity_parts<Q>::precision> >;
+
+	/// @brief One explicit Euler step: the change in the integral of rate over dt
+	template <class Q>
+	integral_t<Q> integrate(const Q & rate, const Quantity<dims::time, typename Internal::quantity_parts<Q>::precision> & dt) {
+		return integral_t<Q>(rate.value() * dt.value());
+	}
+
+	/** @brief Batched explicit Euler step: state[i] += rate[i] * dt.
+
+		One template serves positions from velocities, velocities from
+		accelerations, angles from angular speeds, and so on. Quantity
+		holds nothing but its value, so the loop compiles to the same
+		vectorizable code as one over plain arrays.
+	*/
+	template <class Q>
+	void integrate(integral_t<Q> * state, const Q * rate,
+			const Quantity<dims::time, typename Internal::quantity_parts<Q>::precision> & dt,
+			std::size_t count) {
+		const typename Internal::quantity_parts<Q>::precision h = dt.value();
+		for (std::size_t i = 0; i < count; ++i) {
+			state[i].value() += rate[i].value() * h;
+		}
+	}
+
+	/// @}
+
 	/** @brief Complete type names using SI units
 
 		These are for convenience only - the standard Quantity template may
@@ -473,6 +659,7 @@ namespace DimensionedQuantities {
 		typedef Quantity<dims::ang_viscosity> NewtonMeterSecondsPerRadian;
 
 		typedef Quantity<dims::moment_of_inertia> KilogramMetersSquared;
+		typedef Quantity<dims::energy> Joules;
 	} // end of SI namespace
 
 /// @}
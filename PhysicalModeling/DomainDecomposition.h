@@ -0,0 +1,814 @@
+/** @file	DomainDecomposition.h
+	@brief	header for stepping a spring network split across processes,
+	with halo exchange over a message-passing transport
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_DOMAINDECOMPOSITION_H_
+#define _PHYSICALMODELING_DOMAINDECOMPOSITION_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/SpringNetwork.h>
+#include <PhysicalModeling/SpringForceKernel.h>
+#include <PhysicalModeling/SpringNetworkPartition.h>
+
+// Library/third-party includes
+#ifdef PHYSICALMODELING_USE_MPI
+#	include <mpi.h>
+#endif
+
+// Standard includes
+#include <vector>
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <utility>
+#include <new>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+/** @def PHYSICALMODELING_USE_MPI
+	@brief Optional define to provide MpiTransport; the including project
+	must then find and link MPI.
+*/
+
+#if defined(__unix__) || defined(__APPLE__)
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+/// @brief Defined where SharedMemoryTransport is available (POSIX systems)
+#	define PHYSICALMODELING_HAVE_SHARED_MEMORY_TRANSPORT
+#endif
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSoftBodies Soft Bodies
+	@{
+*/
+
+#ifdef PHYSICALMODELING_HAVE_SHARED_MEMORY_TRANSPORT
+namespace Internal {
+	/// @brief Layout of the start of a SharedMemoryTransport segment
+	struct SharedMemoryHeader {
+		std::uint32_t magic;
+		std::uint32_t ranks;
+		std::uint64_t capacity;
+		std::atomic<std::uint32_t> arrived;
+		std::atomic<std::uint32_t> generation;
+	};
+
+	/// @brief One-chunk mailbox from one rank to another
+	struct SharedMemoryMailbox {
+		std::atomic<std::uint32_t> full;
+		std::uint32_t bytes;
+	};
+
+	enum {
+		SharedMemoryMagic = 0x504d5348,
+		SharedMemoryAlignment = 64
+	};
+
+	inline std::size_t sharedMemoryAlign(std::size_t bytes) {
+		return (bytes + SharedMemoryAlignment - 1) / SharedMemoryAlignment * SharedMemoryAlignment;
+	}
+
+	inline std::size_t sharedMemoryMailboxStride(std::size_t capacity) {
+		return sharedMemoryAlign(sizeof(SharedMemoryMailbox) + capacity);
+	}
+
+	inline std::size_t sharedMemorySegmentSize(std::size_t ranks, std::size_t capacity) {
+		return sharedMemoryAlign(sizeof(SharedMemoryHeader)) + ranks * ranks * sharedMemoryMailboxStride(capacity);
+	}
+} // end of Internal namespace
+
+/** @brief Message passing between processes on one machine through a
+	POSIX shared memory segment, for running and testing domain
+	decompositions without MPI.
+
+	One process calls create() before starting the others (for instance,
+	before fork()); each process, including that one, then opens a
+	transport with its own rank. Each ordered pair of ranks has a
+	mailbox holding one chunk, so messages of any length stream through
+	in chunks of the segment's capacity.
+
+	A rank cannot tell a slow peer from one that has exited, so
+	exchange() and barrier() give up, returning false, after waiting
+	setTimeout() (one minute by default) without progress. The transport
+	then stays failed: the other ranks' messages are out of step.
+*/
+class SharedMemoryTransport {
+	public:
+		/** @brief Create (or replace) the named segment for ranks processes;
+			returns false on failure.
+
+			name must start with '/', as for shm_open().
+		*/
+		static bool create(const std::string & name, int ranks, std::size_t capacity = 65536) {
+			if (ranks < 1 || capacity == 0 || capacity > 0xffffffffu) {
+				return false;
+			}
+			shm_unlink(name.c_str());
+			const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+			if (fd < 0) {
+				return false;
+			}
+			const std::size_t bytes = Internal::sharedMemorySegmentSize(ranks, capacity);
+			void * p = ftruncate(fd, off_t(bytes)) == 0 ?
+				mmap(0, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+			close(fd);
+			if (p == MAP_FAILED) {
+				shm_unlink(name.c_str());
+				return false;
+			}
+			// ftruncate zeroed every mailbox: all empty
+			Internal::SharedMemoryHeader * header = new (p) Internal::SharedMemoryHeader;
+			header->ranks = std::uint32_t(ranks);
+			header->capacity = capacity;
+			header->arrived.store(0);
+			header->generation.store(0);
+			std::atomic_thread_fence(std::memory_order_release);
+			header->magic = Internal::SharedMemoryMagic;
+			munmap(p, bytes);
+			return true;
+		}
+
+		/// @brief Remove the named segment; processes that have it open keep it until they close it
+		static void remove(const std::string & name) {
+			shm_unlink(name.c_str());
+		}
+
+		/// @brief Open the named segment as rank; check valid() before use
+		SharedMemoryTransport(const std::string & name, int rank) :
+				_base(0),
+				_bytes(0),
+				_rank(rank),
+				_ranks(0),
+				_capacity(0),
+				_timeout(std::chrono::minutes(1)),
+				_failed(false) {
+			const int fd = shm_open(name.c_str(), O_RDWR, 0600);
+			if (fd < 0) {
+				return;
+			}
+			struct stat info;
+			if (fstat(fd, &info) == 0 && std::size_t(info.st_size) >= sizeof(Internal::SharedMemoryHeader)) {
+				void * p = mmap(0, std::size_t(info.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+				if (p != MAP_FAILED) {
+					_base = static_cast<char *>(p);
+					_bytes = std::size_t(info.st_size);
+				}
+			}
+			close(fd);
+			if (_base && (_header()->magic != Internal::SharedMemoryMagic || rank < 0
+					|| rank >= int(_header()->ranks)
+					|| _bytes < Internal::sharedMemorySegmentSize(_header()->ranks, _header()->capacity))) {
+				munmap(_base, _bytes);
+				_base = 0;
+			}
+			if (_base) {
+				_ranks = int(_header()->ranks);
+				_capacity = std::size_t(_header()->capacity);
+			}
+		}
+
+		~SharedMemoryTransport() {
+			if (_base) {
+				munmap(_base, _bytes);
+			}
+		}
+
+		/// @brief False if the segment could not be opened, or a wait has timed out
+		bool valid() const { return _base != 0 && !_failed; }
+		int rank() const { return _rank; }
+		int size() const { return _ranks; }
+
+		/// @brief Longest wait without progress before failing; zero waits forever
+		void setTimeout(std::chrono::steady_clock::duration timeout) { _timeout = timeout; }
+
+		/** @brief Send outBytes to peer while receiving inBytes from it;
+			returns false on timeout.
+
+			Both ranks must call with matching sizes. Ranks that each
+			exchange with their peers in increasing rank order cannot
+			deadlock.
+		*/
+		bool exchange(int peer, const void * out, std::size_t outBytes, void * in, std::size_t inBytes) {
+			if (!valid()) {
+				return false;
+			}
+			Internal::SharedMemoryMailbox & outBox = _mailbox(_rank, peer);
+			Internal::SharedMemoryMailbox & inBox = _mailbox(peer, _rank);
+			const char * src = static_cast<const char *>(out);
+			char * dst = static_cast<char *>(in);
+			std::size_t sent = 0, received = 0;
+			std::chrono::steady_clock::time_point lastProgress = std::chrono::steady_clock::now();
+			while (sent < outBytes || received < inBytes) {
+				bool progress = false;
+				if (sent < outBytes && !outBox.full.load(std::memory_order_acquire)) {
+					const std::size_t n = std::min(_capacity, outBytes - sent);
+					std::memcpy(_data(outBox), src + sent, n);
+					outBox.bytes = std::uint32_t(n);
+					outBox.full.store(1, std::memory_order_release);
+					sent += n;
+					progress = true;
+				}
+				if (received < inBytes && inBox.full.load(std::memory_order_acquire)) {
+					const std::size_t n = inBox.bytes;
+					std::memcpy(dst + received, _data(inBox), n);
+					inBox.full.store(0, std::memory_order_release);
+					received += n;
+					progress = true;
+				}
+				if (progress) {
+					lastProgress = std::chrono::steady_clock::now();
+				} else if (!_wait(lastProgress)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/// @brief Wait for every rank to arrive; returns false on timeout
+		bool barrier() {
+			if (!valid()) {
+				return false;
+			}
+			Internal::SharedMemoryHeader * header = _header();
+			const std::uint32_t generation = header->generation.load(std::memory_order_acquire);
+			if (header->arrived.fetch_add(1, std::memory_order_acq_rel) + 1 == std::uint32_t(_ranks)) {
+				header->arrived.store(0, std::memory_order_relaxed);
+				header->generation.fetch_add(1, std::memory_order_acq_rel);
+			} else {
+				const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				while (header->generation.load(std::memory_order_acquire) == generation) {
+					if (!_wait(start)) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+	private:
+		SharedMemoryTransport(const SharedMemoryTransport &);
+		SharedMemoryTransport & operator=(const SharedMemoryTransport &);
+
+		Internal::SharedMemoryHeader * _header() const {
+			return reinterpret_cast<Internal::SharedMemoryHeader *>(_base);
+		}
+
+		Internal::SharedMemoryMailbox & _mailbox(int from, int to) const {
+			return *reinterpret_cast<Internal::SharedMemoryMailbox *>(_base
+				+ Internal::sharedMemoryAlign(sizeof(Internal::SharedMemoryHeader))
+				+ (std::size_t(from) * _ranks + to) * Internal::sharedMemoryMailboxStride(_capacity));
+		}
+
+		static char * _data(Internal::SharedMemoryMailbox & box) {
+			return reinterpret_cast<char *>(&box) + sizeof(Internal::SharedMemoryMailbox);
+		}
+
+		/// @brief Yield, or fail the transport if it has waited since start for longer than the timeout
+		bool _wait(std::chrono::steady_clock::time_point start) {
+			if (_timeout > std::chrono::steady_clock::duration::zero()
+					&& std::chrono::steady_clock::now() - start > _timeout) {
+				_failed = true;
+				return false;
+			}
+			std::this_thread::yield();
+			return true;
+		}
+
+		char * _base;
+		std::size_t _bytes;
+		int _rank;
+		int _ranks;
+		std::size_t _capacity;
+		std::chrono::steady_clock::duration _timeout;
+		bool _failed;
+};
+#endif // PHYSICALMODELING_HAVE_SHARED_MEMORY_TRANSPORT
+
+#ifdef PHYSICALMODELING_USE_MPI
+/// @brief Message passing between the ranks of an MPI communicator
+class MpiTransport {
+	public:
+		explicit MpiTransport(MPI_Comm comm = MPI_COMM_WORLD) : _comm(comm) {
+			MPI_Comm_rank(_comm, &_rank);
+			MPI_Comm_size(_comm, &_ranks);
+		}
+
+		bool valid() const { return true; }
+		int rank() const { return _rank; }
+		int size() const { return _ranks; }
+
+		/// @brief Send outBytes to peer while receiving inBytes from it
+		bool exchange(int peer, const void * out, std::size_t outBytes, void * in, std::size_t inBytes) {
+			return MPI_Sendrecv(const_cast<void *>(out), int(outBytes), MPI_BYTE, peer, 0,
+				in, int(inBytes), MPI_BYTE, peer, 0, _comm, MPI_STATUS_IGNORE) == MPI_SUCCESS;
+		}
+
+		bool barrier() {
+			return MPI_Barrier(_comm) == MPI_SUCCESS;
+		}
+
+	private:
+		MPI_Comm _comm;
+		int _rank;
+		int _ranks;
+};
+#endif // PHYSICALMODELING_USE_MPI
+
+/** @brief What one rank of a DomainDecomposition holds of a spring
+	network, so a rank can be set up without the global network.
+
+	network holds the nodes this rank owns, then halo copies of other
+	ranks' nodes that its springs reach, and the springs this rank
+	evaluates, by index into those nodes. Every spring of the global
+	network must be evaluated by exactly one rank, which holds both of
+	its endpoints. global gives the global index of each node of
+	network, and haloOwner the rank that owns each halo node, in order.
+
+	A per-rank loader (reading a rank's part of a file, say, or
+	generating it) fills one directly; extractSubdomain() cuts one out of
+	a whole network.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct SpringSubdomain {
+	typedef SpringNetwork<Precision> network_t;
+
+	SpringSubdomain() : owned(0) {}
+
+	/// @brief Owned nodes, then halo nodes, and the springs to evaluate
+	network_t network;
+	/// @brief Number of owned nodes, at the front of network
+	std::size_t owned;
+	/// @brief Global index of each node of network
+	std::vector<std::size_t> global;
+	/// @brief Owning rank of each halo node
+	std::vector<int> haloOwner;
+};
+
+/** @brief Cut rank's subdomain out of net, given the rank owning each
+	node.
+
+	Owned nodes keep their order in net, halo nodes are grouped by owner
+	and then ordered by global index, and each spring is evaluated by the
+	owner of its first endpoint. Takes O(nodes + springs) time and a
+	temporary node-sized index.
+*/
+template<class Precision>
+inline SpringSubdomain<Precision> extractSubdomain(const SpringNetwork<Precision> & net,
+		const std::vector<std::size_t> & owner, std::size_t rank) {
+	const std::size_t n = net.nodeCount();
+	SpringSubdomain<Precision> sub;
+	std::vector<std::size_t> local(n, std::size_t(-1));
+	for (std::size_t i = 0; i < n; ++i) {
+		if (owner[i] == rank) {
+			local[i] = sub.global.size();
+			sub.global.push_back(i);
+		}
+	}
+	sub.owned = sub.global.size();
+
+	std::vector<std::pair<std::size_t, std::size_t> > halo;
+	std::vector<std::size_t> springs;
+	for (std::size_t s = 0; s < net.springCount(); ++s) {
+		if (owner[net.a[s]] == rank) {
+			springs.push_back(s);
+			if (owner[net.b[s]] != rank) {
+				halo.push_back(std::make_pair(owner[net.b[s]], net.b[s]));
+			}
+		}
+	}
+	std::sort(halo.begin(), halo.end());
+	halo.erase(std::unique(halo.begin(), halo.end()), halo.end());
+	for (std::size_t k = 0; k < halo.size(); ++k) {
+		local[halo[k].second] = sub.global.size();
+		sub.global.push_back(halo[k].second);
+		sub.haloOwner.push_back(int(halo[k].first));
+	}
+
+	SpringNetwork<Precision> & out = sub.network;
+	out.resizeNodes(sub.global.size());
+	for (std::size_t l = 0; l < sub.global.size(); ++l) {
+		const std::size_t i = sub.global[l];
+		out.x[l] = net.x[i];
+		out.y[l] = net.y[i];
+		out.z[l] = net.z[i];
+		out.vx[l] = net.vx[i];
+		out.vy[l] = net.vy[i];
+		out.vz[l] = net.vz[i];
+		out.invMass[l] = net.invMass[i];
+	}
+	for (std::size_t k = 0; k < springs.size(); ++k) {
+		const std::size_t s = springs[k];
+		out.a.push_back(local[net.a[s]]);
+		out.b.push_back(local[net.b[s]]);
+		out.rest.push_back(net.rest[s]);
+		out.K.push_back(net.K[s]);
+		out.B.push_back(net.B[s]);
+	}
+	return sub;
+}
+
+/** @brief One rank's share of a spring network split across processes,
+	stepped in lockstep with the other ranks.
+
+	Transport moves bytes between ranks: SharedMemoryTransport between
+	processes on one machine, MpiTransport (with
+	PHYSICALMODELING_USE_MPI) across machines, or any class with the same
+	rank(), size(), exchange(), and barrier() members. exchange() and
+	barrier() return false when the transport fails, and so do step()
+	and gather().
+
+	Each rank keeps only its subdomain (see SpringSubdomain): the nodes
+	it owns, then halo copies of the other ranks' nodes that its springs
+	reach. A step is the same semi-implicit Euler step as
+	SoftBody::step:
+	 - compute spring forces, including on halo nodes,
+	 - send halo forces to their owners, which add them to their own,
+	 - integrate owned nodes,
+	 - send new positions and velocities of boundary nodes to the ranks
+	   that keep them as halo nodes.
+
+	For networks too large for one machine, construct each rank from its
+	own SpringSubdomain. At construction every pair of ranks trades the
+	global indices of the halo nodes one keeps of the other's, so each
+	rank learns its boundary nodes without any global table. After that,
+	memory use and messages scale with the subdomain and its boundary.
+	The constructors taking a whole network are a convenience for
+	networks that fit on every rank.
+*/
+template<class Transport, class Precision = DimensionedQuantities::DefaultPrecision>
+class DomainDecomposition {
+	public:
+		typedef SpringNetwork<Precision> network_t;
+		typedef SpringSubdomain<Precision> subdomain_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::accel, Precision> accel_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+
+		/** @brief Take over this rank's subdomain; every rank must
+			construct at the same time. Check valid() before use.
+		*/
+		DomainDecomposition(Transport & transport, subdomain_t subdomain) :
+				_transport(transport) {
+			_connect(subdomain);
+		}
+
+		/// @brief Take this rank's subdomain of net, split with partitionByLocality()
+		DomainDecomposition(Transport & transport, const network_t & net) :
+				_transport(transport) {
+			subdomain_t subdomain = extractSubdomain(net, partitionByLocality(net, std::size_t(transport.size())),
+				std::size_t(transport.rank()));
+			_connect(subdomain);
+		}
+
+		/// @brief Take this rank's subdomain of net, with the rank owning each node given
+		DomainDecomposition(Transport & transport, const network_t & net, const std::vector<std::size_t> & owner) :
+				_transport(transport) {
+			subdomain_t subdomain = extractSubdomain(net, owner, std::size_t(transport.rank()));
+			_connect(subdomain);
+		}
+
+		/** @brief False if this rank's subdomain, or a neighbor's request
+			for its nodes, was inconsistent, or the transport failed
+			during construction.
+		*/
+		bool valid() const { return _valid; }
+
+		std::size_t ownedCount() const { return _owned; }
+		std::size_t haloCount() const { return _net.nodeCount() - _owned; }
+		/// @brief Ranks this rank exchanges halo data with
+		std::size_t neighborCount() const { return _neighbors.size(); }
+		/// @brief Global index of a subdomain node
+		std::size_t globalIndex(std::size_t local) const { return _global[local]; }
+		/// @brief Owned nodes, then halo nodes, and the springs this rank evaluates
+		const network_t & subdomain() const { return _net; }
+
+		/// @brief Set the uniform gravitational acceleration
+		void setGravity(const accel_t & gx, const accel_t & gy, const accel_t & gz) {
+			_g[0] = gx.value();
+			_g[1] = gy.value();
+			_g[2] = gz.value();
+		}
+
+		/** @brief Advance steps time steps of length dt; every rank must
+			call. Returns false, leaving the state undefined, if the
+			transport fails.
+		*/
+		bool step(const time_t & dt, std::size_t steps = 1);
+
+		/** @brief Collect every rank's owned node state into net on rank
+			root, at the nodes' global indices; every rank must call, and
+			only root's net is written. Returns false if the transport
+			fails or a global index is outside net.
+		*/
+		bool gather(network_t & net, int root = 0);
+
+	private:
+		/// @brief Halo nodes shared with one neighboring rank, by subdomain index
+		struct Neighbor {
+			int rank;
+			/// @brief Halo nodes it owns: we receive their state and send their forces
+			std::vector<std::size_t> halo;
+			/// @brief Owned nodes it keeps as halo: we send their state and receive forces
+			std::vector<std::size_t> boundary;
+		};
+
+		void _connect(subdomain_t & subdomain);
+		bool _exchangeForces();
+		bool _exchangeStates();
+
+		Transport & _transport;
+		bool _valid;
+		network_t _net;
+		std::size_t _owned;
+		std::vector<std::size_t> _global;
+		std::vector<Neighbor> _neighbors;
+		std::vector<Precision> _fx, _fy, _fz;
+		std::vector<Precision> _sendBuffer, _receiveBuffer;
+		std::vector<std::uint64_t> _indexBuffer;
+		Precision _g[3];
+};
+
+// -- inline implementations -- //
+
+template<class Transport, class Precision>
+inline void DomainDecomposition<Transport, Precision>::_connect(subdomain_t & subdomain) {
+	_g[0] = _g[1] = _g[2] = 0;
+	const int me = _transport.rank();
+	const int ranks = _transport.size();
+	_net.x.swap(subdomain.network.x);
+	_net.y.swap(subdomain.network.y);
+	_net.z.swap(subdomain.network.z);
+	_net.vx.swap(subdomain.network.vx);
+	_net.vy.swap(subdomain.network.vy);
+	_net.vz.swap(subdomain.network.vz);
+	_net.invMass.swap(subdomain.network.invMass);
+	_net.a.swap(subdomain.network.a);
+	_net.b.swap(subdomain.network.b);
+	_net.rest.swap(subdomain.network.rest);
+	_net.K.swap(subdomain.network.K);
+	_net.B.swap(subdomain.network.B);
+	_global.swap(subdomain.global);
+	const std::size_t n = _net.nodeCount();
+	_owned = std::min(subdomain.owned, n);
+	_valid = _owned == subdomain.owned && _global.size() == n && subdomain.haloOwner.size() == n - _owned;
+	for (std::size_t s = 0; s < _net.springCount(); ++s) {
+		if (_net.a[s] >= n || _net.b[s] >= n) {
+			_valid = false;
+		}
+	}
+
+	// Halo nodes grouped by owner, keeping their order
+	std::vector<std::pair<int, std::size_t> > halo;
+	if (_valid) {
+		for (std::size_t h = _owned; h < n; ++h) {
+			const int r = subdomain.haloOwner[h - _owned];
+			if (r < 0 || r >= ranks || r == me) {
+				_valid = false;
+			}
+			halo.push_back(std::make_pair(r, h));
+		}
+		std::stable_sort(halo.begin(), halo.end(),
+			[](const std::pair<int, std::size_t> & l, const std::pair<int, std::size_t> & r) { return l.first < r.first; });
+	}
+	// Owned nodes by global index, to answer the other ranks' requests
+	std::vector<std::pair<std::size_t, std::size_t> > owned(_owned);
+	for (std::size_t i = 0; i < _owned && i < _global.size(); ++i) {
+		owned[i] = std::make_pair(_global[i], i);
+	}
+	std::sort(owned.begin(), owned.end());
+
+	// Every rank trades requests with every other in increasing rank
+	// order, even when inconsistent, so no peer is left waiting
+	std::vector<std::uint64_t> request, reply;
+	std::size_t next = 0;
+	for (int r = 0; r < ranks; ++r) {
+		if (r == me) {
+			continue;
+		}
+		Neighbor nb;
+		nb.rank = r;
+		request.clear();
+		while (next < halo.size() && halo[next].first < r) {
+			++next;
+		}
+		for (; next < halo.size() && halo[next].first == r; ++next) {
+			nb.halo.push_back(halo[next].second);
+			request.push_back(_global[halo[next].second]);
+		}
+		std::uint64_t count = request.size(), wanted = 0;
+		if (!_transport.exchange(r, &count, sizeof(count), &wanted, sizeof(wanted))) {
+			_valid = false;
+			return;
+		}
+		reply.resize(std::size_t(wanted));
+		if (!_transport.exchange(r, request.data(), request.size() * sizeof(std::uint64_t),
+				reply.data(), reply.size() * sizeof(std::uint64_t))) {
+			_valid = false;
+			return;
+		}
+		for (std::size_t k = 0; k < reply.size(); ++k) {
+			const std::vector<std::pair<std::size_t, std::size_t> >::const_iterator it = std::lower_bound(owned.begin(),
+				owned.end(), std::make_pair(std::size_t(reply[k]), std::size_t(0)));
+			if (it == owned.end() || it->first != reply[k]) {
+				_valid = false;
+				continue;
+			}
+			nb.boundary.push_back(it->second);
+		}
+		if (!nb.halo.empty() || !nb.boundary.empty()) {
+			_neighbors.push_back(nb);
+		}
+	}
+
+	_fx.resize(n);
+	_fy.resize(n);
+	_fz.resize(n);
+}
+
+template<class Transport, class Precision>
+inline bool DomainDecomposition<Transport, Precision>::_exchangeForces() {
+	for (std::size_t k = 0; k < _neighbors.size(); ++k) {
+		const Neighbor & nb = _neighbors[k];
+		_sendBuffer.resize(3 * nb.halo.size());
+		_receiveBuffer.resize(3 * nb.boundary.size());
+		for (std::size_t j = 0; j < nb.halo.size(); ++j) {
+			_sendBuffer[3 * j] = _fx[nb.halo[j]];
+			_sendBuffer[3 * j + 1] = _fy[nb.halo[j]];
+			_sendBuffer[3 * j + 2] = _fz[nb.halo[j]];
+		}
+		if (!_transport.exchange(nb.rank, _sendBuffer.data(), _sendBuffer.size() * sizeof(Precision),
+				_receiveBuffer.data(), _receiveBuffer.size() * sizeof(Precision))) {
+			return false;
+		}
+		for (std::size_t j = 0; j < nb.boundary.size(); ++j) {
+			_fx[nb.boundary[j]] += _receiveBuffer[3 * j];
+			_fy[nb.boundary[j]] += _receiveBuffer[3 * j + 1];
+			_fz[nb.boundary[j]] += _receiveBuffer[3 * j + 2];
+		}
+	}
+	return true;
+}
+
+template<class Transport, class Precision>
+inline bool DomainDecomposition<Transport, Precision>::_exchangeStates() {
+	for (std::size_t k = 0; k < _neighbors.size(); ++k) {
+		const Neighbor & nb = _neighbors[k];
+		_sendBuffer.resize(6 * nb.boundary.size());
+		_receiveBuffer.resize(6 * nb.halo.size());
+		for (std::size_t j = 0; j < nb.boundary.size(); ++j) {
+			const std::size_t i = nb.boundary[j];
+			Precision * out = &_sendBuffer[6 * j];
+			out[0] = _net.x[i];
+			out[1] = _net.y[i];
+			out[2] = _net.z[i];
+			out[3] = _net.vx[i];
+			out[4] = _net.vy[i];
+			out[5] = _net.vz[i];
+		}
+		if (!_transport.exchange(nb.rank, _sendBuffer.data(), _sendBuffer.size() * sizeof(Precision),
+				_receiveBuffer.data(), _receiveBuffer.size() * sizeof(Precision))) {
+			return false;
+		}
+		for (std::size_t j = 0; j < nb.halo.size(); ++j) {
+			const std::size_t i = nb.halo[j];
+			const Precision * in = &_receiveBuffer[6 * j];
+			_net.x[i] = in[0];
+			_net.y[i] = in[1];
+			_net.z[i] = in[2];
+			_net.vx[i] = in[3];
+			_net.vy[i] = in[4];
+			_net.vz[i] = in[5];
+		}
+	}
+	return true;
+}
+
+template<class Transport, class Precision>
+inline bool DomainDecomposition<Transport, Precision>::step(const time_t & dt, std::size_t steps) {
+	if (!_valid) {
+		return false;
+	}
+	const Precision h = dt.value();
+	for (std::size_t k = 0; k < steps; ++k) {
+		for (std::size_t i = 0; i < _net.nodeCount(); ++i) {
+			const Precision m = i < _owned && _net.invMass[i] > 0 ? Precision(1) / _net.invMass[i] : Precision(0);
+			_fx[i] = m * _g[0];
+			_fy[i] = m * _g[1];
+			_fz[i] = m * _g[2];
+		}
+		accumulateSpringForces(_net, _fx.data(), _fy.data(), _fz.data());
+		if (!_exchangeForces()) {
+			return false;
+		}
+
+		for (std::size_t i = 0; i < _owned; ++i) {
+			const Precision hw = h * _net.invMass[i];
+			_net.vx[i] += hw * _fx[i];
+			_net.vy[i] += hw * _fy[i];
+			_net.vz[i] += hw * _fz[i];
+			if (_net.invMass[i] > 0) {
+				_net.x[i] += h * _net.vx[i];
+				_net.y[i] += h * _net.vy[i];
+				_net.z[i] += h * _net.vz[i];
+			}
+		}
+		if (!_exchangeStates()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template<class Transport, class Precision>
+inline bool DomainDecomposition<Transport, Precision>::gather(network_t & net, int root) {
+	if (!_valid) {
+		return false;
+	}
+	// Each rank sends its owned node count, their global indices, then their states
+	const int me = _transport.rank();
+	if (me != root) {
+		_indexBuffer.assign(_global.begin(), _global.begin() + _owned);
+		_sendBuffer.resize(6 * _owned);
+		for (std::size_t i = 0; i < _owned; ++i) {
+			Precision * out = &_sendBuffer[6 * i];
+			out[0] = _net.x[i];
+			out[1] = _net.y[i];
+			out[2] = _net.z[i];
+			out[3] = _net.vx[i];
+			out[4] = _net.vy[i];
+			out[5] = _net.vz[i];
+		}
+		const std::uint64_t count = _owned;
+		return _transport.exchange(root, &count, sizeof(count), 0, 0)
+			&& _transport.exchange(root, _indexBuffer.data(), _indexBuffer.size() * sizeof(std::uint64_t), 0, 0)
+			&& _transport.exchange(root, _sendBuffer.data(), _sendBuffer.size() * sizeof(Precision), 0, 0);
+	}
+	bool ok = true;
+	for (int r = 0; r < _transport.size(); ++r) {
+		if (r == me) {
+			_indexBuffer.assign(_global.begin(), _global.begin() + _owned);
+			_receiveBuffer.resize(6 * _owned);
+			for (std::size_t i = 0; i < _owned; ++i) {
+				Precision * in = &_receiveBuffer[6 * i];
+				in[0] = _net.x[i];
+				in[1] = _net.y[i];
+				in[2] = _net.z[i];
+				in[3] = _net.vx[i];
+				in[4] = _net.vy[i];
+				in[5] = _net.vz[i];
+			}
+		} else {
+			std::uint64_t count = 0;
+			if (!_transport.exchange(r, 0, 0, &count, sizeof(count))) {
+				return false;
+			}
+			_indexBuffer.resize(std::size_t(count));
+			_receiveBuffer.resize(6 * std::size_t(count));
+			if (!_transport.exchange(r, 0, 0, _indexBuffer.data(), _indexBuffer.size() * sizeof(std::uint64_t))
+					|| !_transport.exchange(r, 0, 0, _receiveBuffer.data(), _receiveBuffer.size() * sizeof(Precision))) {
+				return false;
+			}
+		}
+		for (std::size_t j = 0; j < _indexBuffer.size(); ++j) {
+			const std::size_t i = std::size_t(_indexBuffer[j]);
+			if (i >= net.nodeCount()) {
+				ok = false;
+				continue;
+			}
+			const Precision * in = &_receiveBuffer[6 * j];
+			net.x[i] = in[0];
+			net.y[i] = in[1];
+			net.z[i] = in[2];
+			net.vx[i] = in[3];
+			net.vy[i] = in[4];
+			net.vz[i] = in[5];
+		}
+	}
+	return ok;
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_DOMAINDECOMPOSITION_H_
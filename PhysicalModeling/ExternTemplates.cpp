@@ -0,0 +1,32 @@
+/** @file	ExternTemplates.cpp
+	@brief	explicit instantiations for the optional
+	physicalmodeling-compiled library
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Internal Includes
+#include <PhysicalModeling/ExternTemplates.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+#define PHYSICALMODELING_INSTANTIATE_QUANTITY(D) \
+	template class PhysicalModeling::DimensionedQuantities::Quantity< \
+		PhysicalModeling::DimensionedQuantities::dims::D>;
+#define PHYSICALMODELING_INSTANTIATE_SPRING(P) \
+	template class PhysicalModeling::LinearSpringDamper<P>;
+
+PHYSICALMODELING_SI_DIMENSIONS(PHYSICALMODELING_INSTANTIATE_QUANTITY)
+PHYSICALMODELING_SPRING_PRECISIONS(PHYSICALMODELING_INSTANTIATE_SPRING)
@@ -0,0 +1,85 @@
+/** @file	ExternTemplates.h
+	@brief	header declaring the instantiations compiled into the optional
+	physicalmodeling-compiled library
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_EXTERNTEMPLATES_H_
+#define _PHYSICALMODELING_EXTERNTEMPLATES_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/LinearSpringDamper.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+/** @addtogroup gDimensionedQuantities Dimensioned Quantities
+	@{
+*/
+
+/** @brief Apply X to the dims:: typedef of each distinct SI:: quantity type.
+
+	Several SI:: names share a type (NewtonMeters and Joules,
+	NewtonSecondsPerMeter and KilogramsPerSecond), and each type appears
+	only once here.
+*/
+#define PHYSICALMODELING_SI_DIMENSIONS(X) \
+	X(dimensionless) \
+	X(mass) \
+	X(length) \
+	X(force) \
+	X(angle) \
+	X(time) \
+	X(speed) \
+	X(ang_speed) \
+	X(accel) \
+	X(torque) \
+	X(stiffness) \
+	X(ang_stiffness) \
+	X(viscosity) \
+	X(ang_viscosity) \
+	X(moment_of_inertia)
+
+/** @brief Apply X to each precision LinearSpringDamper is compiled for */
+#define PHYSICALMODELING_SPRING_PRECISIONS(X) \
+	X(float) \
+	X(double)
+
+/// @}
+// end of doxygen module
+
+/** @cond innerworkings */
+#define PHYSICALMODELING_EXTERN_QUANTITY(D) \
+	extern template class PhysicalModeling::DimensionedQuantities::Quantity< \
+		PhysicalModeling::DimensionedQuantities::dims::D>;
+#define PHYSICALMODELING_EXTERN_SPRING(P) \
+	extern template class PhysicalModeling::LinearSpringDamper<P>;
+/** @endcond */
+
+/* Including this header, when linking to physicalmodeling-compiled,
+	tells the compiler that the SI:: quantities and the float and double
+	LinearSpringDamper are already instantiated there, so each translation
+	unit can skip instantiating them.
+*/
+PHYSICALMODELING_SI_DIMENSIONS(PHYSICALMODELING_EXTERN_QUANTITY)
+PHYSICALMODELING_SPRING_PRECISIONS(PHYSICALMODELING_EXTERN_SPRING)
+
+#undef PHYSICALMODELING_EXTERN_QUANTITY
+#undef PHYSICALMODELING_EXTERN_SPRING
+
+#endif // _PHYSICALMODELING_EXTERNTEMPLATES_H_
@@ -0,0 +1,458 @@
+/** @file	FrequencyAnalysis.h
+	@brief	header for natural frequencies, damping ratios, and frequency
+	responses of spring-damper systems and spring networks
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_FREQUENCYANALYSIS_H_
+#define _PHYSICALMODELING_FREQUENCYANALYSIS_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/LinearSpringDamper.h>
+#include <PhysicalModeling/SimdPack.h>
+#include <PhysicalModeling/SpringNetwork.h>
+#include <PhysicalModeling/SpringNetworkMatrix.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <complex>
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <cmath>
+#include <cstddef>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSpringDamperSystems Spring-Damper Systems
+	@{
+*/
+
+/// @brief Dimensioned types of frequency-domain results
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct FrequencyTypes {
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::ang_speed, Precision> ang_speed_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::angle, Precision> angle_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::dimensionless, Precision> ratio_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::length, Precision> length_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::force, Precision> force_t;
+	/// @brief Displacement per unit force, in m/N
+	typedef DimensionedQuantities::quotient_t<length_t, force_t> compliance_t;
+};
+
+/// @brief Undamped natural frequency @f$ \omega_n = \sqrt{K / m} @f$
+template<class Precision>
+inline typename FrequencyTypes<Precision>::ang_speed_t naturalFrequency(const LinearSpringDamper<Precision> & sd) {
+	typedef FrequencyTypes<Precision> types;
+	// sqrt(K / m) is per second; one radian per cycle of the phase makes it an angular frequency
+	return typename types::ang_speed_t(DimensionedQuantities::sqrt(sd.stiffness() / sd.mass()) * typename types::angle_t(1));
+}
+
+/// @brief Damping ratio @f$ \zeta = B / (2 \sqrt{K m}) @f$: below 1 the system oscillates
+template<class Precision>
+inline typename FrequencyTypes<Precision>::ratio_t dampingRatio(const LinearSpringDamper<Precision> & sd) {
+	typedef FrequencyTypes<Precision> types;
+	return typename types::ratio_t(sd.viscosity()
+		/ (DimensionedQuantities::sqrt(sd.stiffness() * sd.mass()) * typename types::ratio_t(2)));
+}
+
+/// @brief Damped natural frequency @f$ \omega_n \sqrt{1 - \zeta^2} @f$, or zero if not underdamped
+template<class Precision>
+inline typename FrequencyTypes<Precision>::ang_speed_t dampedFrequency(const LinearSpringDamper<Precision> & sd) {
+	const Precision zeta = dampingRatio(sd).value();
+	return typename FrequencyTypes<Precision>::ang_speed_t(
+		zeta < 1 ? naturalFrequency(sd).value() * std::sqrt(1 - zeta * zeta) : Precision(0));
+}
+
+/** @brief Poles of the system, the roots of @f$ m s^2 + B s + K @f$, in
+	rad/s: a conjugate pair if underdamped, otherwise both real.
+*/
+template<class Precision>
+inline std::pair<std::complex<Precision>, std::complex<Precision> > poles(const LinearSpringDamper<Precision> & sd) {
+	const Precision m = sd.mass().value(), B = sd.viscosity().value(), K = sd.stiffness().value();
+	const Precision center = -B / (2 * m);
+	const Precision disc = center * center - K / m;
+	const Precision root = std::sqrt(std::fabs(disc));
+	if (disc < 0) {
+		return std::make_pair(std::complex<Precision>(center, root), std::complex<Precision>(center, -root));
+	}
+	return std::make_pair(std::complex<Precision>(center + root), std::complex<Precision>(center - root));
+}
+
+/** @brief Complex compliance (receptance) at angular frequency omega:
+	displacement per unit force, @f$ 1 / (K - m \omega^2 + i B \omega) @f$,
+	in m/N.
+*/
+template<class Precision>
+inline std::complex<Precision> compliance(const LinearSpringDamper<Precision> & sd,
+		const typename FrequencyTypes<Precision>::ang_speed_t & omega) {
+	const Precision w = omega.value();
+	return Precision(1) / std::complex<Precision>(sd.stiffness().value() - sd.mass().value() * w * w,
+		sd.viscosity().value() * w);
+}
+
+/// @brief Magnitude of the compliance at angular frequency omega
+template<class Precision>
+inline typename FrequencyTypes<Precision>::compliance_t complianceMagnitude(const LinearSpringDamper<Precision> & sd,
+		const typename FrequencyTypes<Precision>::ang_speed_t & omega) {
+	return typename FrequencyTypes<Precision>::compliance_t(std::abs(compliance(sd, omega)));
+}
+
+/// @brief Phase of displacement relative to force at angular frequency omega, from 0 to -pi
+template<class Precision>
+inline typename FrequencyTypes<Precision>::angle_t compliancePhase(const LinearSpringDamper<Precision> & sd,
+		const typename FrequencyTypes<Precision>::ang_speed_t & omega) {
+	return typename FrequencyTypes<Precision>::angle_t(std::arg(compliance(sd, omega)));
+}
+
+namespace Internal {
+	template <int W, class Precision>
+	PHYSICALMODELING_SIMD_INLINE std::size_t complianceBlocks(Precision m, Precision B, Precision K,
+			const Precision * omega, std::size_t first, std::size_t count, Precision * re, Precision * im) {
+		typedef Simd::Pack<Precision, W> pack_t;
+		typedef Simd::ComplexPack<Precision, W> complex_t;
+		const complex_t one = complex_t::make(pack_t::broadcast(Precision(1)), pack_t::broadcast(Precision(0)));
+		const pack_t mass = pack_t::broadcast(m), damping = pack_t::broadcast(B), stiffness = pack_t::broadcast(K);
+		std::size_t f = first;
+		for (; f + W <= count; f += W) {
+			const pack_t w = pack_t::load(omega + f);
+			const complex_t h = one / complex_t::make(stiffness - mass * w * w, damping * w);
+			h.re.store(re + f);
+			h.im.store(im + f);
+		}
+		return f;
+	}
+
+	template <int W, class Precision>
+	PHYSICALMODELING_SIMD_INLINE std::size_t naturalFrequencyBlocks(const Precision * m, const Precision * K,
+			const Precision * B, std::size_t first, std::size_t count, Precision * omega, Precision * zeta) {
+		typedef Simd::Pack<Precision, W> pack_t;
+		const pack_t half = pack_t::broadcast(Precision(0.5));
+		std::size_t i = first;
+		for (; i + W <= count; i += W) {
+			const pack_t mass = pack_t::load(m + i), stiffness = pack_t::load(K + i);
+			Simd::sqrt(stiffness / mass).store(omega + i);
+			(half * pack_t::load(B + i) / Simd::sqrt(stiffness * mass)).store(zeta + i);
+		}
+		return i;
+	}
+
+	/// @brief Compliance between two points as a sum over modes, at frequencies [first, first + k W)
+	template <int W, class Precision>
+	PHYSICALMODELING_SIMD_INLINE std::size_t modalResponseBlocks(const Precision * gain, const Precision * modeOmega,
+			const Precision * modeZeta, std::size_t modes, const Precision * omega, std::size_t first, std::size_t count,
+			Precision * re, Precision * im) {
+		typedef Simd::Pack<Precision, W> pack_t;
+		typedef Simd::ComplexPack<Precision, W> complex_t;
+		const pack_t zero = pack_t::broadcast(Precision(0));
+		std::size_t f = first;
+		for (; f + W <= count; f += W) {
+			const pack_t w = pack_t::load(omega + f);
+			complex_t sum = complex_t::make(zero, zero);
+			for (std::size_t r = 0; r < modes; ++r) {
+				if (gain[r] == 0) {
+					continue;
+				}
+				const pack_t wr = pack_t::broadcast(modeOmega[r]);
+				const complex_t den = complex_t::make(wr * wr - w * w, pack_t::broadcast(2 * modeZeta[r] * modeOmega[r]) * w);
+				sum = sum + complex_t::make(pack_t::broadcast(gain[r]), zero) / den;
+			}
+			sum.re.store(re + f);
+			sum.im.store(im + f);
+		}
+		return f;
+	}
+
+	/// @brief Arguments of complianceBlocks, for Simd::forEachBlock
+	template <class Precision>
+	struct ComplianceKernel {
+		Precision m;
+		Precision B;
+		Precision K;
+		const Precision * omega;
+		Precision * re;
+		Precision * im;
+
+		template <int W>
+		PHYSICALMODELING_SIMD_INLINE std::size_t blocks(std::size_t first, std::size_t last) const {
+			return complianceBlocks<W>(m, B, K, omega, first, last, re, im);
+		}
+	};
+
+	/// @brief Arguments of naturalFrequencyBlocks, for Simd::forEachBlock
+	template <class Precision>
+	struct NaturalFrequencyKernel {
+		const Precision * m;
+		const Precision * K;
+		const Precision * B;
+		Precision * omega;
+		Precision * zeta;
+
+		template <int W>
+		PHYSICALMODELING_SIMD_INLINE std::size_t blocks(std::size_t first, std::size_t last) const {
+			return naturalFrequencyBlocks<W>(m, K, B, first, last, omega, zeta);
+		}
+	};
+
+	/// @brief Arguments of modalResponseBlocks, for Simd::forEachBlock
+	template <class Precision>
+	struct ModalResponseKernel {
+		const Precision * gain;
+		const Precision * modeOmega;
+		const Precision * modeZeta;
+		std::size_t modes;
+		const Precision * omega;
+		Precision * re;
+		Precision * im;
+
+		template <int W>
+		PHYSICALMODELING_SIMD_INLINE std::size_t blocks(std::size_t first, std::size_t last) const {
+			return modalResponseBlocks<W>(gain, modeOmega, modeZeta, modes, omega, first, last, re, im);
+		}
+	};
+
+	/** @brief Eigenvalues and orthonormal eigenvectors of the symmetric
+		n by n row-major matrix A, by cyclic Jacobi rotations.
+
+		A is destroyed. Eigenvector k is column k of V.
+	*/
+	template<class Precision>
+	void symmetricEigen(std::vector<Precision> & A, std::size_t n,
+			std::vector<Precision> & eigenvalues, std::vector<Precision> & V) {
+		V.assign(n * n, Precision(0));
+		for (std::size_t i = 0; i < n; ++i) {
+			V[i * n + i] = 1;
+		}
+		for (int sweep = 0; sweep < 64; ++sweep) {
+			Precision off = 0, total = 0;
+			for (std::size_t i = 0; i < n; ++i) {
+				for (std::size_t j = 0; j < n; ++j) {
+					total += A[i * n + j] * A[i * n + j];
+					off += i != j ? A[i * n + j] * A[i * n + j] : Precision(0);
+				}
+			}
+			if (off <= total * std::numeric_limits<Precision>::epsilon() * std::numeric_limits<Precision>::epsilon()) {
+				break;
+			}
+			for (std::size_t p = 0; p + 1 < n; ++p) {
+				for (std::size_t q = p + 1; q < n; ++q) {
+					const Precision apq = A[p * n + q];
+					if (apq == 0) {
+						continue;
+					}
+					const Precision theta = (A[q * n + q] - A[p * n + p]) / (2 * apq);
+					const Precision t = (theta >= 0 ? Precision(1) : Precision(-1))
+						/ (std::fabs(theta) + std::sqrt(theta * theta + 1));
+					const Precision c = 1 / std::sqrt(t * t + 1), s = t * c;
+					for (std::size_t k = 0; k < n; ++k) {
+						const Precision akp = A[k * n + p], akq = A[k * n + q];
+						A[k * n + p] = c * akp - s * akq;
+						A[k * n + q] = s * akp + c * akq;
+					}
+					for (std::size_t k = 0; k < n; ++k) {
+						const Precision apk = A[p * n + k], aqk = A[q * n + k];
+						A[p * n + k] = c * apk - s * aqk;
+						A[q * n + k] = s * apk + c * aqk;
+					}
+					for (std::size_t k = 0; k < n; ++k) {
+						const Precision vkp = V[k * n + p], vkq = V[k * n + q];
+						V[k * n + p] = c * vkp - s * vkq;
+						V[k * n + q] = s * vkp + c * vkq;
+					}
+				}
+			}
+		}
+		eigenvalues.resize(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			eigenvalues[i] = A[i * n + i];
+		}
+	}
+} // end of Internal namespace
+
+/** @brief Compliance of a spring-damper at count angular frequencies
+	omega (in rad/s), as real and imaginary parts (in m/N), evaluated
+	several frequencies at a time with Simd::ComplexPack.
+
+	For a Bode plot, the magnitude is @f$ \sqrt{re^2 + im^2} @f$ and the
+	phase @f$ \mathrm{atan2}(im, re) @f$.
+*/
+template<class Precision>
+inline void complianceResponse(const LinearSpringDamper<Precision> & sd,
+		const Precision * omega, std::size_t count, Precision * re, Precision * im) {
+	const Precision m = sd.mass().value(), B = sd.viscosity().value(), K = sd.stiffness().value();
+	const Internal::ComplianceKernel<Precision> kernel = { m, B, K, omega, re, im };
+	Simd::forEachBlock<Precision>(kernel, 0, count);
+}
+
+/** @brief Natural frequencies (in rad/s) and damping ratios of count
+	spring-dampers, given as arrays of mass, stiffness, and damping, such
+	as the lanes of a parameter sweep.
+*/
+template<class Precision>
+inline void naturalFrequencies(const Precision * m, const Precision * K, const Precision * B, std::size_t count,
+		Precision * omega, Precision * zeta) {
+	const Internal::NaturalFrequencyKernel<Precision> kernel = { m, K, B, omega, zeta };
+	Simd::forEachBlock<Precision>(kernel, 0, count);
+}
+
+/** @brief Vibration modes of a spring network, linearized about its
+	current configuration.
+
+	The stiffness and damping matrices are those of assembleSpringSystem()
+	(axial terms only), restricted to the free nodes' coordinates. The
+	modes solve @f$ K \phi = \omega^2 M \phi @f$ and are mass-normalized,
+	@f$ \phi^T M \phi = 1 @f$. Each mode's damping ratio is
+	@f$ \phi^T C \phi / (2 \omega) @f$, which is exact for proportional
+	damping and otherwise neglects coupling between modes. Unconstrained
+	directions give modes of zero frequency.
+
+	The eigenproblem is solved densely, so this suits networks of up to a
+	few hundred nodes. Frequency responses between any two coordinates
+	are then sums over the modes, evaluated several frequencies at a time
+	with Simd::ComplexPack.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class NetworkModes {
+	public:
+		typedef FrequencyTypes<Precision> types;
+		typedef typename types::ang_speed_t ang_speed_t;
+		typedef typename types::ratio_t ratio_t;
+
+		explicit NetworkModes(const SpringNetwork<Precision> & net);
+
+		/// @brief Number of modes: three per free node
+		std::size_t modeCount() const { return _omega.size(); }
+
+		/// @brief Natural frequency of mode r, in increasing order
+		ang_speed_t naturalFrequency(std::size_t r) const { return ang_speed_t(_omega[r]); }
+		/// @brief Damping ratio of mode r
+		ratio_t dampingRatio(std::size_t r) const { return ratio_t(_zeta[r]); }
+		/** @brief Component of mass-normalized mode r at a node's axis
+			(0, 1, 2 for x, y, z); zero for pinned nodes.
+		*/
+		Precision shape(std::size_t r, std::size_t node, int axis) const {
+			const std::size_t row = _dof[node];
+			return row == std::size_t(-1) ? Precision(0) : _shape[(3 * row + axis) * modeCount() + r];
+		}
+
+		/** @brief Compliance from a force on one node's axis to the
+			displacement of another's, at count angular frequencies omega
+			(in rad/s), as real and imaginary parts in m/N:
+			@f[ H(\omega) = \sum_r \frac{\phi_{r,out} \phi_{r,in}}
+				{\omega_r^2 - \omega^2 + 2 i \zeta_r \omega_r \omega} @f]
+		*/
+		void complianceResponse(std::size_t inNode, int inAxis, std::size_t outNode, int outAxis,
+			const Precision * omega, std::size_t count, Precision * re, Precision * im) const;
+
+	private:
+		/// @brief Block row of each node among the free nodes, or -1 if pinned
+		std::vector<std::size_t> _dof;
+		std::vector<Precision> _omega;
+		std::vector<Precision> _zeta;
+		/// @brief Row-major: coordinate by mode
+		std::vector<Precision> _shape;
+};
+
+// -- inline implementations -- //
+
+template<class Precision>
+inline NetworkModes<Precision>::NetworkModes(const SpringNetwork<Precision> & net) {
+	const std::size_t nodes = net.nodeCount();
+	_dof.assign(nodes, std::size_t(-1));
+	std::vector<Precision> scale;
+	for (std::size_t i = 0; i < nodes; ++i) {
+		if (net.invMass[i] > 0) {
+			_dof[i] = scale.size() / 3;
+			for (int axis = 0; axis < 3; ++axis) {
+				scale.push_back(std::sqrt(net.invMass[i]));
+			}
+		}
+	}
+	const std::size_t n = scale.size();
+
+	// Dense M^-1/2 K M^-1/2 and M^-1/2 C M^-1/2 over the free coordinates
+	BlockSparseMatrix<Precision> K, C;
+	assembleSpringSystem(net, Precision(0), Precision(0), Precision(1), K);
+	assembleSpringSystem(net, Precision(0), Precision(1), Precision(0), C);
+	std::vector<Precision> A(n * n, Precision(0)), D(n * n, Precision(0));
+	for (std::size_t i = 0; i < nodes; ++i) {
+		if (_dof[i] == std::size_t(-1)) {
+			continue;
+		}
+		for (std::size_t k = K.rowStart[i]; k < K.rowStart[i + 1]; ++k) {
+			const std::size_t j = K.col[k];
+			if (_dof[j] == std::size_t(-1)) {
+				continue;
+			}
+			const std::size_t ck = C.find(i, j);
+			for (int r = 0; r < 3; ++r) {
+				for (int c = 0; c < 3; ++c) {
+					const std::size_t row = 3 * _dof[i] + r, col = 3 * _dof[j] + c;
+					const Precision s = scale[row] * scale[col];
+					A[row * n + col] = s * K.val[9 * k + 3 * r + c];
+					D[row * n + col] = ck < C.blockCount() ? s * C.val[9 * ck + 3 * r + c] : Precision(0);
+				}
+			}
+		}
+	}
+
+	std::vector<Precision> lambda, V;
+	Internal::symmetricEigen(A, n, lambda, V);
+	std::vector<std::size_t> order(n);
+	for (std::size_t r = 0; r < n; ++r) {
+		order[r] = r;
+	}
+	std::sort(order.begin(), order.end(), [&](std::size_t l, std::size_t r) { return lambda[l] < lambda[r]; });
+
+	_omega.resize(n);
+	_zeta.resize(n);
+	_shape.resize(n * n);
+	for (std::size_t r = 0; r < n; ++r) {
+		const std::size_t e = order[r];
+		_omega[r] = std::sqrt(std::max(lambda[e], Precision(0)));
+		Precision modalDamping = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			Precision sum = 0;
+			for (std::size_t j = 0; j < n; ++j) {
+				sum += D[i * n + j] * V[j * n + e];
+			}
+			modalDamping += V[i * n + e] * sum;
+			_shape[i * n + r] = scale[i] * V[i * n + e];
+		}
+		_zeta[r] = _omega[r] > 0 ? modalDamping / (2 * _omega[r]) : Precision(0);
+	}
+}
+
+template<class Precision>
+inline void NetworkModes<Precision>::complianceResponse(std::size_t inNode, int inAxis, std::size_t outNode, int outAxis,
+		const Precision * omega, std::size_t count, Precision * re, Precision * im) const {
+	std::vector<Precision> gain(modeCount());
+	for (std::size_t r = 0; r < modeCount(); ++r) {
+		gain[r] = shape(r, outNode, outAxis) * shape(r, inNode, inAxis);
+	}
+	const Internal::ModalResponseKernel<Precision> kernel = { gain.data(), _omega.data(), _zeta.data(), modeCount(),
+		omega, re, im };
+	Simd::forEachBlock<Precision>(kernel, 0, count);
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_FREQUENCYANALYSIS_H_
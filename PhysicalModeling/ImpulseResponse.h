@@ -0,0 +1,437 @@
+/** @file	ImpulseResponse.h
+	@brief	header for evaluating linear spring-damper systems by
+	convolution with a sampled impulse response
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_IMPULSERESPONSE_H_
+#define _PHYSICALMODELING_IMPULSERESPONSE_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/FrequencyAnalysis.h>
+#include <PhysicalModeling/LinearSpringDamper.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <complex>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstddef>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSpringDamperSystems Spring-Damper Systems
+	@{
+*/
+
+/** @brief Coefficients of a second-order recursion, normalized so
+	@f$ a_0 = 1 @f$:
+	@f[ y[n] = b_0 u[n] + b_1 u[n-1] + b_2 u[n-2] - a_1 y[n-1] - a_2 y[n-2] @f]
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct SecondOrderSection {
+	SecondOrderSection() : b0(0), b1(0), b2(0), a1(0), a2(0) {}
+
+	Precision b0, b1, b2;
+	Precision a1, a2;
+};
+
+namespace Internal {
+	/// @brief exp(A) of a 3 by 3 row-major matrix, by scaling and squaring a Taylor series
+	template<class Precision>
+	void matrixExponential3(const Precision * A, Precision * E) {
+		Precision norm = 0;
+		for (int r = 0; r < 3; ++r) {
+			norm = std::max(norm, std::fabs(A[3 * r]) + std::fabs(A[3 * r + 1]) + std::fabs(A[3 * r + 2]));
+		}
+		int squarings = 0;
+		Precision scale = 1;
+		while (norm * scale > Precision(0.5)) {
+			scale /= 2;
+			++squarings;
+		}
+		Precision term[9] = {1, 0, 0, 0, 1, 0, 0, 0, 1};
+		for (int i = 0; i < 9; ++i) {
+			E[i] = term[i];
+		}
+		for (int k = 1; k <= 18; ++k) {
+			Precision next[9];
+			for (int r = 0; r < 3; ++r) {
+				for (int c = 0; c < 3; ++c) {
+					next[3 * r + c] = (term[3 * r] * A[c] + term[3 * r + 1] * A[3 + c] + term[3 * r + 2] * A[6 + c])
+						* scale / k;
+				}
+			}
+			for (int i = 0; i < 9; ++i) {
+				term[i] = next[i];
+				E[i] += term[i];
+			}
+		}
+		for (int s = 0; s < squarings; ++s) {
+			Precision square[9];
+			for (int r = 0; r < 3; ++r) {
+				for (int c = 0; c < 3; ++c) {
+					square[3 * r + c] = E[3 * r] * E[c] + E[3 * r + 1] * E[3 + c] + E[3 * r + 2] * E[6 + c];
+				}
+			}
+			for (int i = 0; i < 9; ++i) {
+				E[i] = square[i];
+			}
+		}
+	}
+
+	/** @brief Exact discretization of @f$ m \ddot{x} + B \dot{x} + K x = f @f$
+		for force held constant over each period h (zero-order hold),
+		from force samples to samples of displacement (state 0) or
+		velocity (state 1).
+
+		The state advances by @f$ \Phi = e^{A h} @f$ and the held force
+		enters through @f$ \Gamma = \int_0^h e^{A s} ds \, (0, 1/m)^T @f$;
+		both come from one exponential of the augmented matrix. The output
+		then responds one sample after the force.
+	*/
+	template<class Precision>
+	SecondOrderSection<Precision> zeroOrderHold(Precision m, Precision K, Precision B, Precision h, int state = 0) {
+		const Precision A[9] = {
+			0, h, 0,
+			-h * K / m, -h * B / m, h / m,
+			0, 0, 0};
+		Precision E[9];
+		matrixExponential3(A, E);
+		const Precision p11 = E[0], p12 = E[1], p21 = E[3], p22 = E[4];
+		const Precision g1 = E[2], g2 = E[5];
+		SecondOrderSection<Precision> section;
+		// Numerator of row state of adj(zI - Phi) Gamma
+		if (state == 0) {
+			section.b1 = g1;
+			section.b2 = p12 * g2 - p22 * g1;
+		} else {
+			section.b1 = g2;
+			section.b2 = p21 * g1 - p11 * g2;
+		}
+		section.a1 = -(p11 + p22);
+		section.a2 = p11 * p22 - p12 * p21;
+		return section;
+	}
+
+	/// @brief In-place radix-2 FFT of a power-of-two length, with a precomputed twiddle table
+	template<class Precision>
+	class FourierTransform {
+		public:
+			typedef std::complex<Precision> complex_t;
+
+			explicit FourierTransform(std::size_t n = 1) : _n(n), _twiddle(n / 2) {
+				const Precision pi = std::acos(Precision(-1));
+				for (std::size_t k = 0; k < n / 2; ++k) {
+					const Precision angle = -2 * pi * Precision(k) / Precision(n);
+					_twiddle[k] = complex_t(std::cos(angle), std::sin(angle));
+				}
+			}
+
+			std::size_t size() const { return _n; }
+
+			/// @brief Forward transform, or the inverse scaled by 1/n
+			void operator()(complex_t * data, bool inverse) const {
+				for (std::size_t i = 1, j = 0; i < _n; ++i) {
+					std::size_t bit = _n >> 1;
+					for (; j & bit; bit >>= 1) {
+						j ^= bit;
+					}
+					j ^= bit;
+					if (i < j) {
+						std::swap(data[i], data[j]);
+					}
+				}
+				for (std::size_t len = 2; len <= _n; len <<= 1) {
+					const std::size_t stride = _n / len;
+					for (std::size_t start = 0; start < _n; start += len) {
+						for (std::size_t k = 0; k < len / 2; ++k) {
+							const complex_t w = inverse ? std::conj(_twiddle[k * stride]) : _twiddle[k * stride];
+							const complex_t odd = w * data[start + k + len / 2];
+							data[start + k + len / 2] = data[start + k] - odd;
+							data[start + k] += odd;
+						}
+					}
+				}
+				if (inverse) {
+					const Precision scale = Precision(1) / Precision(_n);
+					for (std::size_t i = 0; i < _n; ++i) {
+						data[i] *= scale;
+					}
+				}
+			}
+
+		private:
+			std::size_t _n;
+			std::vector<complex_t> _twiddle;
+	};
+} // end of Internal namespace
+
+/** @brief Sampled displacement response of a linear system to a unit
+	force held for one sample period, for evaluating long force traces by
+	convolution.
+
+	A sampled response is computed once per parameter set, exactly for
+	force held constant over each sample period, and evaluated two ways:
+	 - convolve() applies it offline to a whole input trace by uniformly
+	   partitioned FFT convolution (overlap-save), in O(log P + L / P)
+	   operations per sample for partitions of P samples and a response
+	   of L samples.
+	 - ResponseFilter applies it online, a sample at a time, through the
+	   equivalent second-order recursions: one for a spring-damper, one
+	   per vibration mode for a spring network. These are not truncated.
+
+	Either is exact at the sample instants, unlike stepping an integrator,
+	which needs steps much shorter than the period of the system to be
+	accurate. Responses are from rest at equilibrium.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class ImpulseResponse {
+	public:
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+		typedef SecondOrderSection<Precision> section_t;
+
+		/// @brief Response of a spring-damper, truncated to length samples
+		ImpulseResponse(const LinearSpringDamper<Precision> & sd, const time_t & dt, std::size_t length);
+
+		/** @brief Response of a spring network at one node's axis to force on
+			another's, as a sum of its vibration modes, truncated to length
+			samples.
+
+			Zero-frequency modes drift without bound under a net force; their
+			contribution is truncated along with the rest.
+		*/
+		ImpulseResponse(const NetworkModes<Precision> & modes, std::size_t inNode, int inAxis,
+			std::size_t outNode, int outAxis, const time_t & dt, std::size_t length);
+
+		/// @brief A measured or otherwise precomputed response, with no recursive equivalent
+		ImpulseResponse(const std::vector<Precision> & samples, const time_t & dt);
+
+		/** @brief Samples after which a spring-damper's response envelope
+			has decayed to relativeTolerance of its start, or maxLength if
+			it never does.
+		*/
+		static std::size_t decayLength(const LinearSpringDamper<Precision> & sd, const time_t & dt,
+			Precision relativeTolerance, std::size_t maxLength = 1 << 20);
+
+		time_t samplePeriod() const { return time_t(_dt); }
+		std::size_t length() const { return _samples.size(); }
+		/// @brief Displacement k periods after a unit force pulse began, in m/N
+		Precision operator[](std::size_t k) const { return _samples[k]; }
+
+		/// @brief Whether sections() reproduces the response, so a ResponseFilter can be made
+		bool recursive() const { return !_sections.empty(); }
+		/// @brief Second-order recursions whose outputs sum to the untruncated response
+		const std::vector<section_t> & sections() const { return _sections; }
+
+		/** @brief Displacements for count force samples (in N), from rest,
+			by partitioned FFT convolution with the truncated response.
+
+			@param blockSize partition length, rounded up to a power of two
+			(at least 1). Longer partitions cost more latency and less
+			computation, up to about the response length.
+		*/
+		void convolve(const Precision * force, std::size_t count, Precision * displacement,
+			std::size_t blockSize = 256) const;
+
+	private:
+		void _sampleSections(std::size_t length);
+
+		Precision _dt;
+		std::vector<Precision> _samples;
+		std::vector<section_t> _sections;
+};
+
+/** @brief Streaming evaluation of a recursive ImpulseResponse, one force
+	sample in and one displacement sample out at a time, from rest.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class ResponseFilter {
+	public:
+		explicit ResponseFilter(const ImpulseResponse<Precision> & response) :
+			_sections(response.sections()),
+			_state(4 * _sections.size(), Precision(0)) {}
+
+		/// @brief Displacement (in m) for the next force sample (in N)
+		Precision process(Precision force);
+
+		/// @brief Displacements for the next count force samples
+		void process(const Precision * force, std::size_t count, Precision * displacement) {
+			for (std::size_t n = 0; n < count; ++n) {
+				displacement[n] = process(force[n]);
+			}
+		}
+
+		/// @brief Return to rest
+		void reset() { std::fill(_state.begin(), _state.end(), Precision(0)); }
+
+	private:
+		std::vector<SecondOrderSection<Precision> > _sections;
+		/// @brief Per section: u[n-1], u[n-2], y[n-1], y[n-2]
+		std::vector<Precision> _state;
+};
+
+// -- inline implementations -- //
+
+template<class Precision>
+inline ImpulseResponse<Precision>::ImpulseResponse(const LinearSpringDamper<Precision> & sd, const time_t & dt,
+		std::size_t length) :
+	_dt(dt.value()) {
+	_sections.push_back(Internal::zeroOrderHold(sd.mass().value(), sd.stiffness().value(), sd.viscosity().value(), _dt));
+	_sampleSections(length);
+}
+
+template<class Precision>
+inline ImpulseResponse<Precision>::ImpulseResponse(const NetworkModes<Precision> & modes, std::size_t inNode, int inAxis,
+		std::size_t outNode, int outAxis, const time_t & dt, std::size_t length) :
+	_dt(dt.value()) {
+	for (std::size_t r = 0; r < modes.modeCount(); ++r) {
+		// Mass-normalized modes are unit-mass oscillators, scaled by how much each node takes part
+		const Precision gain = modes.shape(r, outNode, outAxis) * modes.shape(r, inNode, inAxis);
+		if (gain == 0) {
+			continue;
+		}
+		const Precision omega = modes.naturalFrequency(r).value();
+		section_t section = Internal::zeroOrderHold(Precision(1), omega * omega,
+			2 * modes.dampingRatio(r).value() * omega, _dt);
+		section.b1 *= gain;
+		section.b2 *= gain;
+		_sections.push_back(section);
+	}
+	_sampleSections(length);
+}
+
+template<class Precision>
+inline ImpulseResponse<Precision>::ImpulseResponse(const std::vector<Precision> & samples, const time_t & dt) :
+	_dt(dt.value()),
+	_samples(samples) {}
+
+template<class Precision>
+inline std::size_t ImpulseResponse<Precision>::decayLength(const LinearSpringDamper<Precision> & sd, const time_t & dt,
+		Precision relativeTolerance, std::size_t maxLength) {
+	// The slowest-decaying pole sets the envelope
+	const std::pair<std::complex<Precision>, std::complex<Precision> > p = poles(sd);
+	const Precision rate = -std::max(p.first.real(), p.second.real());
+	if (!(rate > 0)) {
+		return maxLength;
+	}
+	const Precision samples = std::log(1 / relativeTolerance) / (rate * dt.value());
+	return samples < Precision(maxLength) ? std::size_t(std::ceil(samples)) + 1 : maxLength;
+}
+
+template<class Precision>
+inline void ImpulseResponse<Precision>::_sampleSections(std::size_t length) {
+	_samples.assign(length, Precision(0));
+	for (std::size_t s = 0; s < _sections.size(); ++s) {
+		const section_t & c = _sections[s];
+		Precision u1 = 0, u2 = 0, y1 = 0, y2 = 0;
+		for (std::size_t n = 0; n < length; ++n) {
+			const Precision u = n == 0 ? Precision(1) : Precision(0);
+			const Precision y = c.b0 * u + c.b1 * u1 + c.b2 * u2 - c.a1 * y1 - c.a2 * y2;
+			u2 = u1;
+			u1 = u;
+			y2 = y1;
+			y1 = y;
+			_samples[n] += y;
+		}
+	}
+}
+
+template<class Precision>
+inline void ImpulseResponse<Precision>::convolve(const Precision * force, std::size_t count, Precision * displacement,
+		std::size_t blockSize) const {
+	typedef std::complex<Precision> complex_t;
+	// The FFT is radix-2
+	std::size_t P = 1;
+	while (P < blockSize) {
+		P *= 2;
+	}
+	const std::size_t L = length();
+	if (L == 0) {
+		std::fill(displacement, displacement + count, Precision(0));
+		return;
+	}
+	const Internal::FourierTransform<Precision> fft(2 * P);
+	const std::size_t partitions = (L + P - 1) / P;
+
+	// Spectrum of each partition of the response, zero-padded to 2P
+	std::vector<complex_t> H(partitions * 2 * P, complex_t(0));
+	for (std::size_t j = 0; j < partitions; ++j) {
+		complex_t * Hj = &H[j * 2 * P];
+		for (std::size_t k = 0; k < P && j * P + k < L; ++k) {
+			Hj[k] = _samples[j * P + k];
+		}
+		fft(Hj, false);
+	}
+
+	// Frequency-domain delay line of the most recent input frames, as a ring
+	std::vector<complex_t> delay(partitions * 2 * P, complex_t(0));
+	std::vector<complex_t> frame(2 * P), sum(2 * P);
+	std::vector<Precision> previous(P, Precision(0));
+	const std::size_t blocks = (count + P - 1) / P;
+	for (std::size_t i = 0; i < blocks; ++i) {
+		// Overlap-save: each frame is the previous block followed by this one
+		for (std::size_t k = 0; k < P; ++k) {
+			const std::size_t n = i * P + k;
+			const Precision x = n < count ? force[n] : Precision(0);
+			frame[k] = previous[k];
+			frame[P + k] = x;
+			previous[k] = x;
+		}
+		fft(&frame[0], false);
+		const std::size_t slot = i % partitions;
+		std::copy(frame.begin(), frame.end(), delay.begin() + slot * 2 * P);
+
+		std::fill(sum.begin(), sum.end(), complex_t(0));
+		for (std::size_t j = 0; j < partitions && j <= i; ++j) {
+			const complex_t * Xj = &delay[((i - j) % partitions) * 2 * P];
+			const complex_t * Hj = &H[j * 2 * P];
+			for (std::size_t k = 0; k < 2 * P; ++k) {
+				sum[k] += Xj[k] * Hj[k];
+			}
+		}
+		fft(&sum[0], true);
+		for (std::size_t k = 0; k < P && i * P + k < count; ++k) {
+			displacement[i * P + k] = sum[P + k].real();
+		}
+	}
+}
+
+template<class Precision>
+inline Precision ResponseFilter<Precision>::process(Precision force) {
+	Precision y = 0;
+	for (std::size_t s = 0; s < _sections.size(); ++s) {
+		const SecondOrderSection<Precision> & c = _sections[s];
+		Precision * z = &_state[4 * s];
+		const Precision out = c.b0 * force + c.b1 * z[0] + c.b2 * z[1] - c.a1 * z[2] - c.a2 * z[3];
+		z[1] = z[0];
+		z[0] = force;
+		z[3] = z[2];
+		z[2] = out;
+		y += out;
+	}
+	return y;
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_IMPULSERESPONSE_H_
@@ -37,28 +37,43 @@ namespace PhysicalModeling {
 	@{
  */
 
-template<class Precision = DefaultPrecision>
+/** @brief A mass on a linear spring and damper, driven by displacement.
+
+	The force computed is the spring-damper force acting on the mass:
+	@f$ F = -K x - B v @f$
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
 class LinearSpringDamper {
 	public:
 		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::mass, Precision> mass_t;
 		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::length, Precision> length_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::speed, Precision> speed_t;
 		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::stiffness, Precision> stiffness_t;
 		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::viscosity, Precision> viscosity_t;
 		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::force, Precision> force_t;
 
-		LinearSpringDamper(const mass_t & mass, const stiffness_t & stiffness, const viscosity_t & viscosity = 0) :
+		LinearSpringDamper(const mass_t & mass, const stiffness_t & stiffness, const viscosity_t & viscosity = viscosity_t()) :
 				_m(mass),
 				_K(stiffness),
 				_B(viscosity),
 				_xValid(false),
 				_x(std::numeric_limits<Precision>::max()),
+				_v(),
 				_fValid(false),
 				_f(std::numeric_limits<Precision>::max()) {}
 
 		void setDisplacement(const length_t & displacement);
 
+		void setVelocity(const speed_t & velocity);
+
 		const force_t & force();
 
+		/// @name Parameter access
+		/// @{
+		const mass_t & mass() const { return _m; }
+		const stiffness_t & stiffness() const { return _K; }
+		const viscosity_t & viscosity() const { return _B; }
+		/// @}
 
 	protected:
 		/// @name parameters for spring-damper system
@@ -75,28 +90,45 @@ class LinearSpringDamper {
 		bool _xValid;
 		length_t _x;
 
+		/// @brief velocity
+		speed_t _v;
+
 		/// @}
 
 		/// @name Cached results of computation, to be able to return const &
 		/// @{
 		bool _fValid;
 		force_t _f;
-		/// @{
+		/// @}
 
 
 };
 
 // -- inline implementations -- //
+template<class Precision>
 inline void LinearSpringDamper<Precision>::setDisplacement(const length_t & displacement) {
 	_x = displacement;
+	_xValid = true;
+	_fValid = false;
 }
 
-inline const force_t & LinearSpringDamper<Precision>::force() {
+template<class Precision>
+inline void LinearSpringDamper<Precision>::setVelocity(const speed_t & velocity) {
+	_v = velocity;
+	_fValid = false;
+}
 
+template<class Precision>
+inline const typename LinearSpringDamper<Precision>::force_t & LinearSpringDamper<Precision>::force() {
+	if (!_fValid && _xValid) {
+		_f = force_t(-(_K.value() * _x.value() + _B.value() * _v.value()));
+		_fValid = true;
+	}
+	return _f;
 }
 /// @}
 // end of doxygen module
 
 } // end of PhysicalModeling namespace
 
-#endif // _PHYSICALMODELING_DIMENSIONEDQUANTITIES_H_
+#endif // _PHYSICALMODELING_LINEARSPRINGDAMPER_H_
@@ -0,0 +1,519 @@
+/** @file	ModalReduction.h
+	@brief	header for simulating linear spring networks in a reduced basis
+	of their lowest vibration modes
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_MODALREDUCTION_H_
+#define _PHYSICALMODELING_MODALREDUCTION_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/FrequencyAnalysis.h>
+#include <PhysicalModeling/SimdPack.h>
+#include <PhysicalModeling/SpringForceKernel.h>
+#include <PhysicalModeling/SpringNetwork.h>
+#include <PhysicalModeling/SpringNetworkMatrix.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSoftBodies Soft Bodies
+	@{
+*/
+
+namespace Internal {
+	/// @brief Scrambled start vector for Lanczos over the free coordinates, so no mode is missed by symmetry
+	template<class Precision>
+	inline void lanczosStart(std::size_t seed, const std::vector<Precision> & sqrtMass, std::vector<Precision> & q) {
+		q.resize(sqrtMass.size());
+		std::uint32_t state = 2463534242u + 7919u * std::uint32_t(seed);
+		for (std::size_t i = 0; i < q.size(); ++i) {
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			q[i] = sqrtMass[i] > 0 ? Precision(state) / Precision(4294967296.0) - Precision(0.5) : Precision(0);
+		}
+	}
+
+	/** @brief Remove from w its components along the orthonormal basis,
+		twice over for stability, accumulating them in coefficients.
+	*/
+	template<class Precision>
+	inline void orthogonalize(const std::vector<std::vector<Precision> > & basis, std::vector<Precision> & w,
+			std::vector<Precision> & coefficients) {
+		coefficients.assign(basis.size(), Precision(0));
+		for (int pass = 0; pass < 2; ++pass) {
+			for (std::size_t j = 0; j < basis.size(); ++j) {
+				const Precision c = dot(basis[j], w);
+				coefficients[j] += c;
+				for (std::size_t i = 0; i < w.size(); ++i) {
+					w[i] -= c * basis[j][i];
+				}
+			}
+		}
+	}
+
+	/** @brief The count lowest vibration modes of a spring network, by
+		shift-invert Lanczos.
+
+		Lanczos runs on @f$ M^{1/2} (K + \sigma M)^{-1} M^{1/2} @f$, whose
+		largest eigenvalues @f$ 1 / (\lambda + \sigma) @f$ belong to the
+		lowest modes, with each application a conjugate gradient solve
+		against the sparse matrix from assembleSpringSystem(). The basis is
+		fully reorthogonalized. A single Krylov sequence finds each repeated
+		eigenvalue only once, so the iteration restarts from a new vector
+		whenever it spans an invariant subspace, and accepts converged
+		values only once a restart leaves them unchanged.
+
+		@returns the number of modes found: count, unless the network has
+		fewer free coordinates. Eigenvalues (squared angular frequencies)
+		are in increasing order; mode r's mass-normalized shape at
+		coordinate c is shapes[c * found + r], for found the return value.
+	*/
+	template<class Precision>
+	std::size_t lowestModes(const SpringNetwork<Precision> & net, std::size_t count,
+			std::vector<Precision> & eigenvalues, std::vector<Precision> & shapes) {
+		const std::size_t n = net.nodeCount();
+		const std::size_t dim = 3 * n;
+		std::vector<Precision> sqrtMass(dim, Precision(0));
+		std::size_t free = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			if (net.invMass[i] > 0) {
+				sqrtMass[3 * i] = sqrtMass[3 * i + 1] = sqrtMass[3 * i + 2] = 1 / std::sqrt(net.invMass[i]);
+				free += 3;
+			}
+		}
+		count = std::min(count, free);
+		eigenvalues.clear();
+		shapes.clear();
+		if (count == 0) {
+			return 0;
+		}
+
+		// A shift well below the largest eigenvalue (bounded by Gershgorin) keeps zero-frequency modes solvable
+		BlockSparseMatrix<Precision> K, S;
+		assembleSpringSystem(net, Precision(0), Precision(0), Precision(1), K);
+		Precision bound = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			if (net.invMass[i] > 0) {
+				for (int r = 0; r < 3; ++r) {
+					Precision row = 0;
+					for (std::size_t k = K.rowStart[i]; k < K.rowStart[i + 1]; ++k) {
+						for (int c = 0; c < 3; ++c) {
+							row += std::fabs(K.val[9 * k + 3 * r + c]);
+						}
+					}
+					bound = std::max(bound, row * net.invMass[i]);
+				}
+			}
+		}
+		const Precision sigma = bound > 0 ? Precision(1e-3) * bound : Precision(1);
+		assembleSpringSystem(net, sigma, Precision(0), Precision(1), S);
+		BlockJacobiPreconditioner<Precision> preconditioner;
+		preconditioner.setup(S);
+		ConjugateGradientWorkspace<Precision> ws;
+
+		// Full reorthogonalization records every projection, so T is exactly Q^T A Q even across restarts
+		std::vector<std::vector<Precision> > Q, projections;
+		std::vector<Precision> q, w, b, x, T, ritz, V, top, previous;
+		std::vector<std::size_t> order;
+		const auto rayleighRitz = [&]() {
+			const std::size_t m = Q.size();
+			T.assign(m * m, Precision(0));
+			for (std::size_t j = 0; j < m; ++j) {
+				for (std::size_t i = 0; i <= j; ++i) {
+					T[i * m + j] = T[j * m + i] = projections[j][i];
+				}
+			}
+			symmetricEigen(T, m, ritz, V);
+			order.resize(m);
+			for (std::size_t j = 0; j < m; ++j) {
+				order[j] = j;
+			}
+			std::sort(order.begin(), order.end(), [&](std::size_t l, std::size_t r) { return ritz[l] > ritz[r]; });
+		};
+
+		// Each Krylov sequence ends in a residual left out of the basis, which bounds the Ritz residuals
+		std::vector<std::size_t> sequenceEnd;
+		std::vector<Precision> sequenceResidual;
+		std::size_t restarts = 0;
+		lanczosStart(restarts, sqrtMass, q);
+		const Precision q0 = std::sqrt(dot(q, q));
+		for (std::size_t i = 0; i < dim; ++i) {
+			q[i] /= q0;
+		}
+		const Precision breakdown = std::sqrt(std::numeric_limits<Precision>::epsilon()) / sigma;
+		for (;;) {
+			Q.push_back(q);
+			b.resize(dim);
+			for (std::size_t i = 0; i < dim; ++i) {
+				b[i] = sqrtMass[i] * q[i];
+			}
+			x.assign(dim, Precision(0));
+			conjugateGradient(S, b, x, preconditioner, Precision(1e-12), 10 * dim, ws);
+			w.resize(dim);
+			for (std::size_t i = 0; i < dim; ++i) {
+				w[i] = sqrtMass[i] * x[i];
+			}
+			projections.push_back(std::vector<Precision>());
+			orthogonalize(Q, w, projections.back());
+			const Precision residual = std::sqrt(dot(w, w));
+			const std::size_t m = Q.size();
+			if (m == free) {
+				break;
+			}
+			// An invariant subspace: continue from a fresh direction
+			bool restart = residual <= breakdown;
+
+			if (m >= count && (m - count) % 4 == 0) {
+				rayleighRitz();
+				const Precision tolerance = Precision(1e-10) * ritz[order[0]];
+				bool converged = true;
+				top.resize(count);
+				for (std::size_t r = 0; r < count; ++r) {
+					Precision bound = std::fabs(residual * V[(m - 1) * m + order[r]]);
+					for (std::size_t k = 0; k < sequenceEnd.size(); ++k) {
+						bound += std::fabs(sequenceResidual[k] * V[sequenceEnd[k] * m + order[r]]);
+					}
+					converged = converged && bound <= tolerance;
+					top[r] = ritz[order[r]];
+				}
+				if (converged) {
+					// Repeated eigenvalues appear once per Krylov sequence, so probe from a fresh direction before accepting
+					bool unchanged = previous.size() == count;
+					for (std::size_t r = 0; r < count && unchanged; ++r) {
+						unchanged = std::fabs(top[r] - previous[r]) <= tolerance;
+					}
+					if (unchanged) {
+						break;
+					}
+					previous = top;
+					restart = true;
+				}
+			}
+
+			if (restart) {
+				sequenceEnd.push_back(m - 1);
+				sequenceResidual.push_back(residual);
+				lanczosStart(++restarts, sqrtMass, w);
+				const Precision raw = std::sqrt(dot(w, w));
+				orthogonalize(Q, w, b);
+				const Precision norm = std::sqrt(dot(w, w));
+				if (norm <= std::sqrt(std::numeric_limits<Precision>::epsilon()) * raw) {
+					// Only possible once the basis spans every free coordinate
+					break;
+				}
+				for (std::size_t i = 0; i < dim; ++i) {
+					q[i] = w[i] / norm;
+				}
+			} else {
+				for (std::size_t i = 0; i < dim; ++i) {
+					q[i] = w[i] / residual;
+				}
+			}
+		}
+		rayleighRitz();
+
+		// Ritz vectors, mapped back from mass-scaled coordinates
+		const std::size_t m = Q.size();
+		const std::size_t found = std::min(count, m);
+		shapes.assign(dim * found, Precision(0));
+		eigenvalues.resize(found);
+		std::vector<Precision> phi(dim), Kphi;
+		for (std::size_t r = 0; r < found; ++r) {
+			std::fill(phi.begin(), phi.end(), Precision(0));
+			for (std::size_t j = 0; j < m; ++j) {
+				const Precision s = V[j * m + order[r]];
+				for (std::size_t i = 0; i < dim; ++i) {
+					phi[i] += s * Q[j][i];
+				}
+			}
+			for (std::size_t i = 0; i < dim; ++i) {
+				phi[i] = sqrtMass[i] > 0 ? phi[i] / sqrtMass[i] : Precision(0);
+				shapes[i * found + r] = phi[i];
+			}
+			// The Rayleigh quotient is more accurate than 1 / ritz - sigma
+			K.multiply(phi, Kphi);
+			eigenvalues[r] = std::max(dot(phi, Kphi), Precision(0));
+		}
+		return found;
+	}
+
+	/// @brief Advance modes [first, first + k W) by semi-implicit Euler, returning the first mode not handled
+	template <int W, class Precision>
+	PHYSICALMODELING_SIMD_INLINE std::size_t modalStepBlocks(const Precision * stiffness, const Precision * damping,
+			const Precision * force, Precision * q, Precision * qdot, std::size_t first, std::size_t count, Precision h) {
+		typedef Simd::Pack<Precision, W> pack_t;
+		const pack_t dt = pack_t::broadcast(h);
+		std::size_t r = first;
+		for (; r + W <= count; r += W) {
+			pack_t v = pack_t::load(qdot + r);
+			pack_t d = pack_t::load(q + r);
+			v = v + dt * (pack_t::load(force + r) - (pack_t::load(stiffness + r) * d + pack_t::load(damping + r) * v));
+			d = d + dt * v;
+			v.store(qdot + r);
+			d.store(q + r);
+		}
+		return r;
+	}
+
+	/// @brief Arguments of modalStepBlocks, for Simd::forEachBlock
+	template <class Precision>
+	struct ModalStepKernel {
+		const Precision * stiffness;
+		const Precision * damping;
+		const Precision * force;
+		Precision * q;
+		Precision * qdot;
+		Precision h;
+
+		template <int W>
+		PHYSICALMODELING_SIMD_INLINE std::size_t blocks(std::size_t first, std::size_t last) const {
+			return modalStepBlocks<W>(stiffness, damping, force, q, qdot, first, last, h);
+		}
+	};
+} // end of Internal namespace
+
+/** @brief A spring network linearized about a reference configuration
+	and simulated in the basis of its lowest vibration modes.
+
+	Construction finds the lowest modes once, by shift-invert Lanczos
+	(see NetworkModes for the linearization and damping model). Each
+	step then advances only the modal coordinates, decoupled oscillators
+	integrated by semi-implicit Euler as SoftBody does, so it costs O(k)
+	in the number of modes k rather than O(springs). Node positions are
+	reconstructed only when asked for: one node costs O(k), the whole
+	network O(k n).
+
+	Forces at the reference configuration, such as those of springs not
+	at rest length, are included as a constant load, so the model is exact
+	for small motions about any configuration. Large rotations are not
+	captured: for those, step the full network.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class ModalSpringNetwork {
+	public:
+		typedef FrequencyTypes<Precision> types;
+		typedef typename types::ang_speed_t ang_speed_t;
+		typedef typename types::ratio_t ratio_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::length, Precision> length_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::speed, Precision> speed_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::accel, Precision> accel_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::force, Precision> force_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+
+		/// @brief Reduce net to its modes lowest modes, starting from its current positions and velocities
+		ModalSpringNetwork(const SpringNetwork<Precision> & net, std::size_t modes);
+
+		std::size_t nodeCount() const { return _mass.size(); }
+		/// @brief Modes retained: those requested, unless the network has fewer free coordinates
+		std::size_t modeCount() const { return _stiffness.size(); }
+
+		/// @brief Natural frequency of mode r, in increasing order
+		ang_speed_t naturalFrequency(std::size_t r) const { return ang_speed_t(std::sqrt(_stiffness[r])); }
+		/// @brief Damping ratio of mode r
+		ratio_t dampingRatio(std::size_t r) const {
+			return ratio_t(_stiffness[r] > 0 ? _damping[r] / (2 * std::sqrt(_stiffness[r])) : Precision(0));
+		}
+		/// @brief Component of mass-normalized mode r at a node's axis (0, 1, 2 for x, y, z)
+		Precision shape(std::size_t r, std::size_t node, int axis) const {
+			return _shape[(3 * node + axis) * modeCount() + r];
+		}
+		/// @brief Current amplitude of mode r
+		Precision modalDisplacement(std::size_t r) const { return _q[r]; }
+
+		/// @brief Set the gravitational acceleration; reprojects the load, costing O(k n)
+		void setGravity(const accel_t & gx, const accel_t & gy, const accel_t & gz);
+		/// @brief Set the external force on a node, replacing any previous one; costs O(k)
+		void setExternalForce(std::size_t node, const force_t & fx, const force_t & fy, const force_t & fz);
+
+		/// @brief Advance the modal coordinates by one step
+		void step(const time_t & dt);
+
+		/// @brief Reconstruct one node's position
+		void position(std::size_t node, length_t & px, length_t & py, length_t & pz) const {
+			px = length_t(_reference[3 * node] + _combine(_q, 3 * node));
+			py = length_t(_reference[3 * node + 1] + _combine(_q, 3 * node + 1));
+			pz = length_t(_reference[3 * node + 2] + _combine(_q, 3 * node + 2));
+		}
+		/// @brief Reconstruct one node's velocity
+		void velocity(std::size_t node, speed_t & vx, speed_t & vy, speed_t & vz) const {
+			vx = speed_t(_combine(_qdot, 3 * node));
+			vy = speed_t(_combine(_qdot, 3 * node + 1));
+			vz = speed_t(_combine(_qdot, 3 * node + 2));
+		}
+		/// @brief Write every node's position and velocity into net, which must have the reduced network's nodes
+		void reconstruct(SpringNetwork<Precision> & net) const;
+
+	private:
+		/// @brief Sum of the modes at coordinate c, weighted by the given modal amplitudes
+		Precision _combine(const std::vector<Precision> & amplitudes, std::size_t c) const;
+		void _projectLoad();
+
+		/// @brief Per coordinate: reference position and loads
+		std::vector<Precision> _reference;
+		std::vector<Precision> _referenceForce;
+		std::vector<Precision> _external;
+		std::vector<Precision> _mass;
+		Precision _gx, _gy, _gz;
+
+		/// @brief Per mode
+		std::vector<Precision> _stiffness;
+		std::vector<Precision> _damping;
+		std::vector<Precision> _force;
+		std::vector<Precision> _q;
+		std::vector<Precision> _qdot;
+		/// @brief Row-major: coordinate by mode
+		std::vector<Precision> _shape;
+};
+
+// -- inline implementations -- //
+
+template<class Precision>
+inline ModalSpringNetwork<Precision>::ModalSpringNetwork(const SpringNetwork<Precision> & net, std::size_t modes) :
+	_gx(0),
+	_gy(0),
+	_gz(0) {
+	const std::size_t n = net.nodeCount();
+	std::vector<Precision> eigenvalues;
+	const std::size_t k = Internal::lowestModes(net, modes, eigenvalues, _shape);
+	_stiffness = eigenvalues;
+	_damping.resize(k);
+	_force.assign(k, Precision(0));
+	_q.assign(k, Precision(0));
+	_qdot.assign(k, Precision(0));
+
+	BlockSparseMatrix<Precision> C;
+	assembleSpringSystem(net, Precision(0), Precision(1), Precision(0), C);
+	std::vector<Precision> phi(3 * n), Cphi;
+	for (std::size_t r = 0; r < k; ++r) {
+		Precision momentum = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			const Precision m = net.invMass[i] > 0 ? 1 / net.invMass[i] : Precision(0);
+			phi[3 * i] = shape(r, i, 0);
+			phi[3 * i + 1] = shape(r, i, 1);
+			phi[3 * i + 2] = shape(r, i, 2);
+			momentum += m * (phi[3 * i] * net.vx[i] + phi[3 * i + 1] * net.vy[i] + phi[3 * i + 2] * net.vz[i]);
+		}
+		C.multiply(phi, Cphi);
+		_damping[r] = Internal::dot(phi, Cphi);
+		_qdot[r] = momentum;
+	}
+
+	_reference.resize(3 * n);
+	_mass.resize(n);
+	std::vector<Precision> fx(n, Precision(0)), fy(n, Precision(0)), fz(n, Precision(0));
+	const std::vector<Precision> still(n, Precision(0));
+	accumulateSpringForces(net, net.x.data(), net.y.data(), net.z.data(),
+		still.data(), still.data(), still.data(), fx.data(), fy.data(), fz.data());
+	_referenceForce.resize(3 * n);
+	_external.assign(3 * n, Precision(0));
+	for (std::size_t i = 0; i < n; ++i) {
+		_reference[3 * i] = net.x[i];
+		_reference[3 * i + 1] = net.y[i];
+		_reference[3 * i + 2] = net.z[i];
+		_referenceForce[3 * i] = fx[i];
+		_referenceForce[3 * i + 1] = fy[i];
+		_referenceForce[3 * i + 2] = fz[i];
+		_mass[i] = net.invMass[i] > 0 ? 1 / net.invMass[i] : Precision(0);
+	}
+	_projectLoad();
+}
+
+template<class Precision>
+inline void ModalSpringNetwork<Precision>::_projectLoad() {
+	const std::size_t k = modeCount();
+	const Precision g[3] = {_gx, _gy, _gz};
+	std::fill(_force.begin(), _force.end(), Precision(0));
+	for (std::size_t c = 0; c < _reference.size(); ++c) {
+		const Precision f = _referenceForce[c] + _mass[c / 3] * g[c % 3] + _external[c];
+		const Precision * row = _shape.data() + c * k;
+		for (std::size_t r = 0; r < k; ++r) {
+			_force[r] += row[r] * f;
+		}
+	}
+}
+
+template<class Precision>
+inline void ModalSpringNetwork<Precision>::setGravity(const accel_t & gx, const accel_t & gy, const accel_t & gz) {
+	_gx = gx.value();
+	_gy = gy.value();
+	_gz = gz.value();
+	_projectLoad();
+}
+
+template<class Precision>
+inline void ModalSpringNetwork<Precision>::setExternalForce(std::size_t node,
+		const force_t & fx, const force_t & fy, const force_t & fz) {
+	const std::size_t k = modeCount();
+	const Precision f[3] = {fx.value(), fy.value(), fz.value()};
+	for (int axis = 0; axis < 3; ++axis) {
+		const std::size_t c = 3 * node + axis;
+		const Precision change = f[axis] - _external[c];
+		_external[c] = f[axis];
+		const Precision * row = _shape.data() + c * k;
+		for (std::size_t r = 0; r < k; ++r) {
+			_force[r] += row[r] * change;
+		}
+	}
+}
+
+template<class Precision>
+inline void ModalSpringNetwork<Precision>::step(const time_t & dt) {
+	const Precision h = dt.value();
+	const Internal::ModalStepKernel<Precision> kernel = { _stiffness.data(), _damping.data(), _force.data(),
+		_q.data(), _qdot.data(), h };
+	Simd::forEachBlock<Precision>(kernel, 0, modeCount());
+}
+
+template<class Precision>
+inline Precision ModalSpringNetwork<Precision>::_combine(const std::vector<Precision> & amplitudes, std::size_t c) const {
+	const std::size_t k = modeCount();
+	const Precision * row = _shape.data() + c * k;
+	Precision sum = 0;
+	for (std::size_t r = 0; r < k; ++r) {
+		sum += row[r] * amplitudes[r];
+	}
+	return sum;
+}
+
+template<class Precision>
+inline void ModalSpringNetwork<Precision>::reconstruct(SpringNetwork<Precision> & net) const {
+	for (std::size_t i = 0; i < nodeCount(); ++i) {
+		net.x[i] = _reference[3 * i] + _combine(_q, 3 * i);
+		net.y[i] = _reference[3 * i + 1] + _combine(_q, 3 * i + 1);
+		net.z[i] = _reference[3 * i + 2] + _combine(_q, 3 * i + 2);
+		net.vx[i] = _combine(_qdot, 3 * i);
+		net.vy[i] = _combine(_qdot, 3 * i + 1);
+		net.vz[i] = _combine(_qdot, 3 * i + 2);
+	}
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_MODALREDUCTION_H_
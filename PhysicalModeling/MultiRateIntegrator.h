@@ -0,0 +1,325 @@
+/** @file	MultiRateIntegrator.h
+	@brief	header for multi-rate explicit stepping of spring networks
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_MULTIRATEINTEGRATOR_H_
+#define _PHYSICALMODELING_MULTIRATEINTEGRATOR_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/SpringNetwork.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+#include <cmath>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSoftBodies Soft Bodies
+	@{
+*/
+
+/** @brief Explicit stepping of a SpringNetwork in which each spring is
+	advanced at its own rate.
+
+	Springs are sorted into rate classes by their stability-limited time
+	step: class @e c is stepped at @f$ H / 2^c @f$, where H is the coarse
+	step, so a few stiff springs no longer force the whole network onto
+	the smallest step. The classes are nested as in r-RESPA: each class
+	applies a half-step velocity kick at the start and end of its step,
+	with two steps of the next faster class in between, and every class
+	synchronizes at each coarse step. Each class uses velocity Verlet, so
+	the scheme is symplectic for undamped springs.
+
+	Node positions are drifted lazily: a node is only brought forward to
+	the current time when a spring touching it is evaluated, so the cost
+	of a coarse step is proportional to the number of spring evaluations
+	rather than to the node count times the finest rate.
+
+	The stable step of a spring is estimated from a Gershgorin bound on
+	@f$ M^{-1} K @f$ and @f$ M^{-1} B @f$ at its endpoints, scaled by a
+	safety factor. Gravity is applied at the coarse rate.
+
+	The integrator keeps a pointer to the network it was constructed
+	with, which must outlive it. Call rebuild() after changing the
+	network's springs, stiffnesses, or masses.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class MultiRateIntegrator {
+	public:
+		typedef SpringNetwork<Precision> network_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::accel, Precision> accel_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+
+		MultiRateIntegrator(network_t & network, const time_t & coarseStep, std::size_t maxClasses = 16) :
+				_net(&network),
+				_coarseStep(coarseStep.value()),
+				_maxClasses(maxClasses),
+				_safety(Precision(0.9)),
+				_gx(0),
+				_gy(0),
+				_gz(0),
+				_tick(0),
+				_lastEvaluations(0) {
+			rebuild();
+		}
+
+		void setGravity(const accel_t & gx, const accel_t & gy, const accel_t & gz) {
+			_gx = gx.value();
+			_gy = gy.value();
+			_gz = gz.value();
+		}
+
+		/// @brief Change the coarse step, reclassifying the springs
+		void setCoarseStep(const time_t & dt) {
+			_coarseStep = dt.value();
+			rebuild();
+		}
+		time_t coarseStep() const { return time_t(_coarseStep); }
+
+		/// @brief Fraction of the estimated stability limit each class may use
+		void setSafetyFactor(Precision safety) {
+			_safety = safety;
+			rebuild();
+		}
+
+		/// @brief Reclassify the springs from the current network
+		void rebuild();
+
+		/// @name Rate classes
+		/// @{
+		std::size_t classCount() const { return _classStart.size() - 1; }
+		std::size_t classSize(std::size_t c) const { return _classStart[c + 1] - _classStart[c]; }
+		std::size_t springClass(std::size_t s) const { return _class[s]; }
+		/// @brief Step used by class c
+		time_t classStep(std::size_t c) const { return time_t(_coarseStep / Precision(std::size_t(1) << c)); }
+		/// @brief Estimated largest stable step of spring s
+		time_t stableStep(std::size_t s) const { return time_t(_stable[s]); }
+		/// @}
+
+		/// @brief Advance the network by one coarse step
+		void step();
+
+		/// @brief Spring force evaluations made by the most recent step
+		std::size_t lastSpringEvaluations() const { return _lastEvaluations; }
+
+		/// @brief Spring force evaluations a single-rate integrator would
+		/// need per coarse step to be stable for every spring
+		std::size_t uniformSpringEvaluations() const {
+			return 2 * _net->springCount() * (std::size_t(1) << (classCount() - 1));
+		}
+
+	private:
+		void _advance(std::size_t c);
+		void _kick(std::size_t c, Precision h);
+		void _gravity(Precision h);
+		void _drift(std::size_t i);
+		void _syncAll();
+
+		network_t * _net;
+		Precision _coarseStep;
+		std::size_t _maxClasses;
+		Precision _safety;
+		Precision _gx, _gy, _gz;
+
+		/// @brief Current time, in steps of the fastest class
+		std::size_t _tick;
+		std::size_t _lastEvaluations;
+
+		std::vector<Precision> _stable;
+		std::vector<std::size_t> _class;
+		/// @brief Spring indices grouped by class
+		std::vector<std::size_t> _order;
+		/// @brief Offsets of each class in _order, plus the end
+		std::vector<std::size_t> _classStart;
+		/// @brief Tick each node's position was last drifted to
+		std::vector<std::size_t> _nodeTick;
+};
+
+// -- inline implementations -- //
+template<class Precision>
+inline void MultiRateIntegrator<Precision>::rebuild() {
+	const network_t & net = *_net;
+	const std::size_t springs = net.springCount();
+	const std::size_t nodes = net.nodeCount();
+
+	// Gershgorin row sums of M^-1 K and M^-1 B at each node
+	std::vector<Precision> sumK(nodes, Precision(0));
+	std::vector<Precision> sumB(nodes, Precision(0));
+	for (std::size_t s = 0; s < springs; ++s) {
+		sumK[net.a[s]] += net.K[s];
+		sumK[net.b[s]] += net.K[s];
+		sumB[net.a[s]] += net.B[s];
+		sumB[net.b[s]] += net.B[s];
+	}
+
+	_stable.assign(springs, std::numeric_limits<Precision>::max());
+	_class.assign(springs, 0);
+	std::size_t classes = 1;
+	for (std::size_t s = 0; s < springs; ++s) {
+		Precision omega2 = 0, rate = 0;
+		const std::size_t ends[2] = {net.a[s], net.b[s]};
+		for (int e = 0; e < 2; ++e) {
+			const std::size_t i = ends[e];
+			omega2 = std::max(omega2, 2 * net.invMass[i] * sumK[i]);
+			rate = std::max(rate, 2 * net.invMass[i] * sumB[i]);
+		}
+		// Verlet is stable for h omega < 2; explicit damping for h rate < 2
+		Precision limit = std::numeric_limits<Precision>::max();
+		if (omega2 > 0) {
+			limit = std::min(limit, 2 / std::sqrt(omega2));
+		}
+		if (rate > 0) {
+			limit = std::min(limit, 2 / rate);
+		}
+		_stable[s] = limit;
+
+		std::size_t c = 0;
+		Precision h = _coarseStep;
+		while (h > _safety * limit && c + 1 < _maxClasses) {
+			h /= 2;
+			++c;
+		}
+		_class[s] = c;
+		classes = std::max(classes, c + 1);
+	}
+
+	// Counting sort of springs by class, preserving spring order within a class
+	_classStart.assign(classes + 1, 0);
+	for (std::size_t s = 0; s < springs; ++s) {
+		_classStart[_class[s] + 1]++;
+	}
+	for (std::size_t c = 0; c < classes; ++c) {
+		_classStart[c + 1] += _classStart[c];
+	}
+	std::vector<std::size_t> fill(_classStart.begin(), _classStart.end() - 1);
+	_order.resize(springs);
+	for (std::size_t s = 0; s < springs; ++s) {
+		_order[fill[_class[s]]++] = s;
+	}
+
+	_tick = 0;
+	_nodeTick.assign(nodes, 0);
+}
+
+template<class Precision>
+inline void MultiRateIntegrator<Precision>::_drift(std::size_t i) {
+	network_t & net = *_net;
+	if (_nodeTick[i] == _tick) {
+		return;
+	}
+	const Precision h = _coarseStep / Precision(std::size_t(1) << (classCount() - 1))
+		* Precision(_tick - _nodeTick[i]);
+	net.x[i] += h * net.vx[i];
+	net.y[i] += h * net.vy[i];
+	net.z[i] += h * net.vz[i];
+	_nodeTick[i] = _tick;
+}
+
+template<class Precision>
+inline void MultiRateIntegrator<Precision>::_syncAll() {
+	for (std::size_t i = 0; i < _nodeTick.size(); ++i) {
+		_drift(i);
+	}
+}
+
+template<class Precision>
+inline void MultiRateIntegrator<Precision>::_kick(std::size_t c, Precision h) {
+	network_t & net = *_net;
+	for (std::size_t k = _classStart[c]; k < _classStart[c + 1]; ++k) {
+		const std::size_t s = _order[k];
+		const std::size_t a = net.a[s];
+		const std::size_t b = net.b[s];
+		_drift(a);
+		_drift(b);
+		const Precision dx = net.x[b] - net.x[a];
+		const Precision dy = net.y[b] - net.y[a];
+		const Precision dz = net.z[b] - net.z[a];
+		const Precision len = std::sqrt(dx * dx + dy * dy + dz * dz);
+		if (len <= std::numeric_limits<Precision>::min()) {
+			continue;
+		}
+		const Precision nx = dx / len, ny = dy / len, nz = dz / len;
+		const Precision relVel = (net.vx[b] - net.vx[a]) * nx
+			+ (net.vy[b] - net.vy[a]) * ny
+			+ (net.vz[b] - net.vz[a]) * nz;
+		// Impulse on a along n; b receives the opposite
+		const Precision j = h * (net.K[s] * (len - net.rest[s]) + net.B[s] * relVel);
+		net.vx[a] += net.invMass[a] * j * nx;
+		net.vy[a] += net.invMass[a] * j * ny;
+		net.vz[a] += net.invMass[a] * j * nz;
+		net.vx[b] -= net.invMass[b] * j * nx;
+		net.vy[b] -= net.invMass[b] * j * ny;
+		net.vz[b] -= net.invMass[b] * j * nz;
+	}
+	_lastEvaluations += _classStart[c + 1] - _classStart[c];
+}
+
+template<class Precision>
+inline void MultiRateIntegrator<Precision>::_gravity(Precision h) {
+	network_t & net = *_net;
+	for (std::size_t i = 0; i < net.nodeCount(); ++i) {
+		if (net.invMass[i] > 0) {
+			net.vx[i] += h * _gx;
+			net.vy[i] += h * _gy;
+			net.vz[i] += h * _gz;
+		}
+	}
+}
+
+template<class Precision>
+inline void MultiRateIntegrator<Precision>::_advance(std::size_t c) {
+	const Precision h = _coarseStep / Precision(std::size_t(1) << c);
+	_kick(c, h / 2);
+	if (c == 0) {
+		_gravity(h / 2);
+	}
+	if (c + 1 < classCount()) {
+		_advance(c + 1);
+		_advance(c + 1);
+	} else {
+		// Positions catch up lazily in _drift
+		++_tick;
+	}
+	if (c == 0) {
+		// Every node must be at the end of the step before gravity changes its velocity
+		_syncAll();
+	}
+	_kick(c, h / 2);
+	if (c == 0) {
+		_gravity(h / 2);
+	}
+}
+
+template<class Precision>
+inline void MultiRateIntegrator<Precision>::step() {
+	_lastEvaluations = 0;
+	_tick = 0;
+	std::fill(_nodeTick.begin(), _nodeTick.end(), std::size_t(0));
+	_advance(0);
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_MULTIRATEINTEGRATOR_H_
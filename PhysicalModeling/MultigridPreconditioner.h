@@ -0,0 +1,488 @@
+/** @file	MultigridPreconditioner.h
+	@brief	header for a smoothed-aggregation algebraic multigrid
+	preconditioner for spring network matrices
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_MULTIGRIDPRECONDITIONER_H_
+#define _PHYSICALMODELING_MULTIGRIDPRECONDITIONER_H_
+
+// Internal Includes
+#include <PhysicalModeling/SpringNetworkMatrix.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <utility>
+#include <limits>
+#include <cstddef>
+#include <cmath>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSparseSolvers Sparse Solvers
+	@{
+*/
+
+/** @brief Smoothed-aggregation algebraic multigrid preconditioner for
+	block-sparse spring network matrices, for use with conjugateGradient().
+
+	Nodes are grouped into aggregates of strongly-coupled neighbors, which
+	become the nodes of the next coarser level; the tentative piecewise
+	constant prolongator is smoothed with one damped Jacobi step, and
+	coarse matrices are formed by Galerkin products. apply() performs one
+	symmetric V-cycle with damped block Jacobi smoothing and a dense
+	Cholesky solve on the coarsest level.
+
+	When the matrix changes from step to step, or the network gains a few
+	springs or nodes, call update() rather than setup(): it keeps the
+	aggregates of every level - new nodes join a neighboring aggregate -
+	and only recomputes the smoothers, prolongators, and Galerkin products
+	for the new values. A full setup() is done automatically after a
+	configurable number of incremental updates, so aggregates follow
+	large deformations, or when the change cannot be absorbed (nodes
+	removed, or a new node with no aggregated neighbor).
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class MultigridPreconditioner {
+	public:
+		typedef BlockSparseMatrix<Precision> matrix_t;
+
+		MultigridPreconditioner() :
+			_coarsestSize(64),
+			_maxLevels(10),
+			_smoothingSweeps(2),
+			_strengthThreshold(Precision(0.08)),
+			_maxStaleUpdates(16),
+			_staleUpdates(0),
+			_fullSetups(0) {}
+
+		/// @name Configuration, taking effect at the next full setup
+		/// @{
+
+		/// @brief Stop coarsening once a level has at most this many nodes
+		void setCoarsestSize(std::size_t n) { _coarsestSize = n; }
+		void setMaxLevels(std::size_t n) { _maxLevels = n; }
+		/// @brief Jacobi sweeps before and after each coarse correction
+		void setSmoothingSweeps(std::size_t n) { _smoothingSweeps = n; }
+		/// @brief Incremental updates allowed before a full setup is forced
+		void setMaxStaleUpdates(std::size_t n) { _maxStaleUpdates = n; }
+		/// @}
+
+		/// @brief Build the complete hierarchy for A
+		void setup(const matrix_t & A);
+
+		/// @brief Refresh the hierarchy for a changed A, incrementally if possible
+		void update(const matrix_t & A);
+
+		/// @brief z = one V-cycle applied to r
+		void apply(const std::vector<Precision> & r, std::vector<Precision> & z);
+
+		/// @name Hierarchy information
+		/// @{
+		std::size_t levelCount() const { return _levels.size(); }
+		std::size_t levelSize(std::size_t level) const { return _levels[level].A.rows; }
+		/// @brief Coarse node that a node of the given level belongs to
+		std::size_t aggregateOf(std::size_t level, std::size_t node) const { return _levels[level].aggregate[node]; }
+		/// @brief Number of full setups performed, including those forced by update()
+		std::size_t fullSetupCount() const { return _fullSetups; }
+		/// @}
+
+	private:
+		struct Level {
+			matrix_t A;
+			/// @brief Prolongator from the next coarser level, and its transpose
+			matrix_t P;
+			matrix_t R;
+			std::vector<Precision> Dinv;
+			Precision omega;
+			std::vector<std::size_t> aggregate;
+			std::vector<Precision> x, b, r;
+		};
+
+		bool _isStrong(const matrix_t & A, std::size_t k, std::size_t i, std::size_t j) const;
+		std::size_t _aggregate(const matrix_t & A, std::vector<std::size_t> & aggregate) const;
+		void _prepareSmoother(Level & level);
+		void _buildProlongator(Level & level, std::size_t coarseSize);
+		void _factorCoarsest();
+		void _smooth(Level & level);
+		void _vcycle(std::size_t l);
+
+		std::size_t _coarsestSize;
+		std::size_t _maxLevels;
+		std::size_t _smoothingSweeps;
+		Precision _strengthThreshold;
+		std::size_t _maxStaleUpdates;
+		std::size_t _staleUpdates;
+		std::size_t _fullSetups;
+
+		std::vector<Level> _levels;
+		/// @brief Dense lower Cholesky factor of the coarsest matrix, or empty
+		/// if the coarsest level is solved by smoothing
+		std::vector<Precision> _cholesky;
+};
+
+// -- inline implementations -- //
+template<class Precision>
+inline bool MultigridPreconditioner<Precision>::_isStrong(const matrix_t & A, std::size_t k, std::size_t i, std::size_t j) const {
+	const Precision * aij = &A.val[9 * k];
+	const Precision * aii = &A.val[9 * A.find(i, i)];
+	const Precision * ajj = &A.val[9 * A.find(j, j)];
+	Precision nij = 0, nii = 0, njj = 0;
+	for (int e = 0; e < 9; ++e) {
+		nij += aij[e] * aij[e];
+		nii += aii[e] * aii[e];
+		njj += ajj[e] * ajj[e];
+	}
+	// ||A_ij||^2 >= theta^2 ||A_ii|| ||A_jj|| (Frobenius norms)
+	return nij >= _strengthThreshold * _strengthThreshold * std::sqrt(nii * njj);
+}
+
+template<class Precision>
+inline std::size_t MultigridPreconditioner<Precision>::_aggregate(const matrix_t & A, std::vector<std::size_t> & aggregate) const {
+	const std::size_t none = std::numeric_limits<std::size_t>::max();
+	const std::size_t n = A.rows;
+	aggregate.assign(n, none);
+	std::size_t count = 0;
+
+	// Phase 1: seed aggregates from nodes whose strong neighborhood is untouched
+	for (std::size_t i = 0; i < n; ++i) {
+		if (aggregate[i] != none) {
+			continue;
+		}
+		bool free = true;
+		bool anyStrong = false;
+		for (std::size_t k = A.rowStart[i]; k < A.rowStart[i + 1] && free; ++k) {
+			const std::size_t j = A.col[k];
+			if (j != i && _isStrong(A, k, i, j)) {
+				anyStrong = true;
+				free = aggregate[j] == none;
+			}
+		}
+		if (!free || !anyStrong) {
+			continue;
+		}
+		aggregate[i] = count;
+		for (std::size_t k = A.rowStart[i]; k < A.rowStart[i + 1]; ++k) {
+			const std::size_t j = A.col[k];
+			if (j != i && _isStrong(A, k, i, j)) {
+				aggregate[j] = count;
+			}
+		}
+		++count;
+	}
+
+	// Phase 2: attach leftovers to a strongly-connected aggregate
+	std::vector<std::size_t> phase2(aggregate);
+	for (std::size_t i = 0; i < n; ++i) {
+		if (aggregate[i] != none) {
+			continue;
+		}
+		for (std::size_t k = A.rowStart[i]; k < A.rowStart[i + 1]; ++k) {
+			const std::size_t j = A.col[k];
+			if (j != i && aggregate[j] != none && _isStrong(A, k, i, j)) {
+				phase2[i] = aggregate[j];
+				break;
+			}
+		}
+	}
+	aggregate.swap(phase2);
+
+	// Phase 3: anything still alone becomes its own aggregate
+	for (std::size_t i = 0; i < n; ++i) {
+		if (aggregate[i] == none) {
+			aggregate[i] = count++;
+		}
+	}
+	return count;
+}
+
+template<class Precision>
+inline void MultigridPreconditioner<Precision>::_prepareSmoother(Level & level) {
+	const matrix_t & A = level.A;
+	const std::size_t n = A.rows;
+	level.Dinv.assign(9 * n, Precision(0));
+	for (std::size_t i = 0; i < n; ++i) {
+		const std::size_t k = A.find(i, i);
+		Precision * inv = &level.Dinv[9 * i];
+		if (k == A.blockCount() || !Internal::blockInverse(&A.val[9 * k], inv)) {
+			inv[0] = inv[4] = inv[8] = 1;
+		}
+	}
+
+	// Estimate the spectral radius of D^-1 A by power iteration
+	std::vector<Precision> v(3 * n), Av;
+	for (std::size_t i = 0; i < v.size(); ++i) {
+		v[i] = Precision(1) + Precision(i % 7) / Precision(7);
+	}
+	Precision rho = 1;
+	for (int it = 0; it < 15; ++it) {
+		const Precision norm = std::sqrt(Internal::dot(v, v));
+		if (norm <= 0) {
+			break;
+		}
+		for (std::size_t i = 0; i < v.size(); ++i) {
+			v[i] /= norm;
+		}
+		A.multiply(v, Av);
+		for (std::size_t i = 0; i < n; ++i) {
+			Precision * vi = &v[3 * i];
+			vi[0] = vi[1] = vi[2] = 0;
+			Internal::blockApplyAdd(&level.Dinv[9 * i], &Av[3 * i], vi);
+		}
+		rho = std::sqrt(Internal::dot(v, v));
+	}
+	level.omega = Precision(4) / (Precision(3) * (rho > 0 ? rho : Precision(1)));
+
+	level.x.resize(3 * n);
+	level.b.resize(3 * n);
+	level.r.resize(3 * n);
+}
+
+template<class Precision>
+inline void MultigridPreconditioner<Precision>::_buildProlongator(Level & level, std::size_t coarseSize) {
+	// P = (I - omega D^-1 A) P_tent, with P_tent mapping each aggregate's
+	// x/y/z to those of its members. Row i of A P_tent sums the blocks of
+	// row i of A by aggregate.
+	const matrix_t & A = level.A;
+	std::vector<std::pair<std::size_t, std::size_t> > entries;
+	entries.reserve(A.blockCount());
+	for (std::size_t i = 0; i < A.rows; ++i) {
+		entries.push_back(std::make_pair(i, level.aggregate[i]));
+		for (std::size_t k = A.rowStart[i]; k < A.rowStart[i + 1]; ++k) {
+			entries.push_back(std::make_pair(i, level.aggregate[A.col[k]]));
+		}
+	}
+	matrix_t & P = level.P;
+	P.setPattern(A.rows, coarseSize, entries);
+
+	for (std::size_t i = 0; i < A.rows; ++i) {
+		Precision * own = &P.val[9 * P.find(i, level.aggregate[i])];
+		own[0] += 1;
+		own[4] += 1;
+		own[8] += 1;
+		const Precision * dinv = &level.Dinv[9 * i];
+		for (std::size_t k = A.rowStart[i]; k < A.rowStart[i + 1]; ++k) {
+			Precision scaled[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+			Internal::blockMultiplyAdd(dinv, &A.val[9 * k], scaled);
+			Precision * p = &P.val[9 * P.find(i, level.aggregate[A.col[k]])];
+			for (int e = 0; e < 9; ++e) {
+				p[e] -= level.omega * scaled[e];
+			}
+		}
+	}
+	transpose(P, level.R);
+}
+
+template<class Precision>
+inline void MultigridPreconditioner<Precision>::_factorCoarsest() {
+	const matrix_t & A = _levels.back().A;
+	const std::size_t n = 3 * A.rows;
+	_cholesky.clear();
+	if (A.rows > _coarsestSize) {
+		return;
+	}
+	_cholesky.assign(n * n, Precision(0));
+	for (std::size_t r = 0; r < A.rows; ++r) {
+		for (std::size_t k = A.rowStart[r]; k < A.rowStart[r + 1]; ++k) {
+			for (int i = 0; i < 3; ++i) {
+				for (int j = 0; j < 3; ++j) {
+					_cholesky[(3 * r + i) * n + 3 * A.col[k] + j] = A.val[9 * k + 3 * i + j];
+				}
+			}
+		}
+	}
+	for (std::size_t j = 0; j < n; ++j) {
+		Precision d = _cholesky[j * n + j];
+		for (std::size_t k = 0; k < j; ++k) {
+			d -= _cholesky[j * n + k] * _cholesky[j * n + k];
+		}
+		if (d <= 0) {
+			// Not numerically positive definite: fall back to smoothing
+			_cholesky.clear();
+			return;
+		}
+		d = std::sqrt(d);
+		_cholesky[j * n + j] = d;
+		for (std::size_t i = j + 1; i < n; ++i) {
+			Precision s = _cholesky[i * n + j];
+			for (std::size_t k = 0; k < j; ++k) {
+				s -= _cholesky[i * n + k] * _cholesky[j * n + k];
+			}
+			_cholesky[i * n + j] = s / d;
+		}
+	}
+}
+
+template<class Precision>
+inline void MultigridPreconditioner<Precision>::setup(const matrix_t & A) {
+	_levels.clear();
+	_levels.push_back(Level());
+	_levels.back().A = A;
+	while (true) {
+		Level & fine = _levels.back();
+		_prepareSmoother(fine);
+		if (fine.A.rows <= _coarsestSize || _levels.size() >= _maxLevels) {
+			break;
+		}
+		const std::size_t coarseSize = _aggregate(fine.A, fine.aggregate);
+		if (coarseSize * 10 > fine.A.rows * 9) {
+			// Coarsening has stalled: solve this level by smoothing
+			break;
+		}
+		_buildProlongator(fine, coarseSize);
+		matrix_t AP;
+		multiply(fine.A, fine.P, AP);
+		Level coarse;
+		multiply(fine.R, AP, coarse.A);
+		_levels.push_back(coarse);
+	}
+	_levels.back().aggregate.clear();
+	_factorCoarsest();
+	_staleUpdates = 0;
+	++_fullSetups;
+}
+
+template<class Precision>
+inline void MultigridPreconditioner<Precision>::update(const matrix_t & A) {
+	if (_levels.size() < 2 || A.rows < _levels[0].A.rows || _staleUpdates >= _maxStaleUpdates) {
+		setup(A);
+		return;
+	}
+	Level & fine = _levels[0];
+	const std::size_t oldRows = fine.A.rows;
+
+	// New nodes join the aggregate of their strongest aggregated neighbor
+	fine.aggregate.resize(A.rows, std::numeric_limits<std::size_t>::max());
+	for (std::size_t i = oldRows; i < A.rows; ++i) {
+		Precision best = 0;
+		for (std::size_t k = A.rowStart[i]; k < A.rowStart[i + 1]; ++k) {
+			const std::size_t j = A.col[k];
+			if (j >= oldRows) {
+				continue;
+			}
+			Precision norm = 0;
+			for (int e = 0; e < 9; ++e) {
+				norm += A.val[9 * k + e] * A.val[9 * k + e];
+			}
+			if (norm > best) {
+				best = norm;
+				fine.aggregate[i] = fine.aggregate[j];
+			}
+		}
+		if (best <= 0) {
+			setup(A);
+			return;
+		}
+	}
+
+	// Keep every level's aggregates; redo the numeric work only
+	fine.A = A;
+	for (std::size_t l = 0; l + 1 < _levels.size(); ++l) {
+		Level & level = _levels[l];
+		_prepareSmoother(level);
+		_buildProlongator(level, _levels[l + 1].A.rows);
+		matrix_t AP;
+		multiply(level.A, level.P, AP);
+		multiply(level.R, AP, _levels[l + 1].A);
+	}
+	_prepareSmoother(_levels.back());
+	_factorCoarsest();
+	++_staleUpdates;
+}
+
+template<class Precision>
+inline void MultigridPreconditioner<Precision>::_smooth(Level & level) {
+	const std::size_t n = level.A.rows;
+	for (std::size_t sweep = 0; sweep < _smoothingSweeps; ++sweep) {
+		level.A.multiply(level.x, level.r);
+		for (std::size_t i = 0; i < n; ++i) {
+			Precision res[3] = {level.b[3 * i] - level.r[3 * i],
+				level.b[3 * i + 1] - level.r[3 * i + 1],
+				level.b[3 * i + 2] - level.r[3 * i + 2]};
+			Precision corr[3] = {0, 0, 0};
+			Internal::blockApplyAdd(&level.Dinv[9 * i], res, corr);
+			level.x[3 * i] += level.omega * corr[0];
+			level.x[3 * i + 1] += level.omega * corr[1];
+			level.x[3 * i + 2] += level.omega * corr[2];
+		}
+	}
+}
+
+template<class Precision>
+inline void MultigridPreconditioner<Precision>::_vcycle(std::size_t l) {
+	Level & level = _levels[l];
+	std::fill(level.x.begin(), level.x.end(), Precision(0));
+
+	if (l + 1 == _levels.size()) {
+		if (_cholesky.empty()) {
+			// Coarsening stalled: approximate the solve with extra smoothing
+			_smooth(level);
+			_smooth(level);
+			return;
+		}
+		const std::size_t n = level.b.size();
+		for (std::size_t i = 0; i < n; ++i) {
+			Precision s = level.b[i];
+			for (std::size_t k = 0; k < i; ++k) {
+				s -= _cholesky[i * n + k] * level.x[k];
+			}
+			level.x[i] = s / _cholesky[i * n + i];
+		}
+		for (std::size_t i = n; i-- > 0;) {
+			Precision s = level.x[i];
+			for (std::size_t k = i + 1; k < n; ++k) {
+				s -= _cholesky[k * n + i] * level.x[k];
+			}
+			level.x[i] = s / _cholesky[i * n + i];
+		}
+		return;
+	}
+
+	_smooth(level);
+
+	Level & coarse = _levels[l + 1];
+	level.A.multiply(level.x, level.r);
+	for (std::size_t i = 0; i < level.r.size(); ++i) {
+		level.r[i] = level.b[i] - level.r[i];
+	}
+	level.R.multiply(level.r, coarse.b);
+	_vcycle(l + 1);
+	level.P.multiply(coarse.x, level.r);
+	for (std::size_t i = 0; i < level.x.size(); ++i) {
+		level.x[i] += level.r[i];
+	}
+
+	_smooth(level);
+}
+
+template<class Precision>
+inline void MultigridPreconditioner<Precision>::apply(const std::vector<Precision> & r, std::vector<Precision> & z) {
+	if (_levels.empty()) {
+		z = r;
+		return;
+	}
+	_levels[0].b = r;
+	_vcycle(0);
+	z = _levels[0].x;
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_MULTIGRIDPRECONDITIONER_H_
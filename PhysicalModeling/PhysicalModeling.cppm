@@ -0,0 +1,51 @@
+/** @file	PhysicalModeling.cppm
+	@brief	C++20 module interface for dimensioned quantities and
+	spring-damper elements
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+// Everything the exported headers include goes in the global module
+// fragment, so that their include guards keep third-party and standard
+// declarations out of the module purview below.
+
+// Library/third-party includes
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/divides.hpp>
+#include <boost/mpl/equal.hpp>
+#include <boost/mpl/minus.hpp>
+#include <boost/mpl/multiplies.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/mpl/plus.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/mpl/transform.hpp>
+#include <boost/mpl/vector_c.hpp>
+#include <boost/static_assert.hpp>
+
+// Standard includes
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+export module physical_modeling;
+
+export {
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/DimensionNames.h>
+#include <PhysicalModeling/DimensionIds.h>
+#include <PhysicalModeling/LinearSpringDamper.h>
+}
@@ -23,6 +23,28 @@
 
 // Internal Includes
 #include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/DimensionNames.h>
+#include <PhysicalModeling/DimensionIds.h>
+#include <PhysicalModeling/ArticulatedChain.h>
+#include <PhysicalModeling/LinearSpringDamper.h>
+#include <PhysicalModeling/SpringDamperBatch.h>
+#include <PhysicalModeling/FrequencyAnalysis.h>
+#include <PhysicalModeling/ImpulseResponse.h>
+#include <PhysicalModeling/BiquadFilter.h>
+#include <PhysicalModeling/VibrationSynthesis.h>
+#include <PhysicalModeling/SimdPack.h>
+#include <PhysicalModeling/SpringForceKernel.h>
+#include <PhysicalModeling/SoftBody.h>
+#include <PhysicalModeling/PositionBasedSolver.h>
+#include <PhysicalModeling/MultiRateIntegrator.h>
+#include <PhysicalModeling/SpringNetworkSnapshot.h>
+#include <PhysicalModeling/RollbackSimulator.h>
+#include <PhysicalModeling/SpringNetworkMatrix.h>
+#include <PhysicalModeling/MultigridPreconditioner.h>
+#include <PhysicalModeling/ImplicitSpringSolver.h>
+#include <PhysicalModeling/AdaptiveIntegrator.h>
+#include <PhysicalModeling/ModalReduction.h>
+#include <PhysicalModeling/WaveVariables.h>
 
 // Library/third-party includes
 // - none
@@ -39,9 +61,8 @@ namespace PhysicalModeling {}
 @section intro_sec Introduction
 
 This package will contain a number of utilities (mostly headers) to support
-the development of applications that perform physical modeling tasks. Currently,
-only the @ref gDimensionedQuantities "Dimensioned Quantities" module exists,
-but as modular functionality is developed, it will be included.
+the development of applications that perform physical modeling tasks. As
+modular functionality is developed, it will be included and listed below.
 
 The goal is to use modern C++ design and practices to facilitate simpler
 implementation of physical modeling tasks. Templates will be used extensively.
@@ -51,7 +72,70 @@ not be exposed to the developer-user.
 @section module_sec Modules of Functionality
  - @ref gDimensionedQuantities "Dimensioned Quantities": Assign dimensions
  	(mass, length, speed) to your variables, and let the compiler support and
- 	enforce dimensional compatibility.
+ 	enforce dimensional compatibility. Unit strings, dimension names, and
+ 	stable dimension IDs for dispatch are generated at compile time.
+ - @ref gArticulatedBodies "Articulated Bodies": O(n) Featherstone dynamics
+ 	for serial chains with spring-damper joints.
+ - @ref gSpringDamperSystems "Spring-Damper Systems": Linear spring-damper
+ 	elements, and batched simulation of thousands of them at once for
+ 	parameter sweeps, summarized as overshoot, settling time, and energy.
+ 	Natural frequencies, damping ratios, poles, and compliance (Bode)
+ 	responses are computed analytically for single systems, and from
+ 	vibration modes for spring networks. Long force traces are evaluated
+ 	through exactly sampled impulse responses, by FFT convolution offline
+ 	or by the equivalent recursions online. Spring-dampers compile to
+ 	biquad filters, run many channels at a time in a vectorized bank, and
+ 	banks of them struck by sparse contact events synthesize vibration
+ 	at audio rates.
+ - @ref gSoftBodies "Soft Bodies": Cloth and deformables built from
+ 	spring-damper elements, with cache-friendly node ordering, an
+ 	unconditionally stable position-based (XPBD) solver for them, and
+ 	multi-rate explicit stepping that steps each spring at its own rate,
+ 	full or incremental copy-on-write snapshots, rollback and
+ 	resimulation when inputs arrive late, parallel stepping of large
+ 	networks as locality-based partitions with NUMA-local storage, and
+ 	domain decomposition across processes with halo exchange over shared
+ 	memory or MPI, and model reduction that steps only a network's lowest
+ 	vibration modes. The partitioned and domain-decomposed solvers use
+ 	operating-system threading and shared-memory headers, so this header
+ 	leaves them out: include SpringNetworkPartition.h or
+ 	DomainDecomposition.h directly.
+ - @ref gSparseSolvers "Sparse Solvers": Implicit integration of large
+ 	spring networks with multigrid-preconditioned conjugate gradients.
+ - @ref gIntegrators "Integrators": Adaptive Runge-Kutta integration of
+ 	spring networks with dimensioned error tolerances, and event location
+ 	for contact onset and release.
+ - @ref gTeleoperation "Teleoperation": Wave-variable transformations
+ 	that keep spring-damper couplings passive over delayed links.
+ - @ref gVectorization "Vectorization": A portable SIMD vector type, so
+ 	batched kernels such as the spring force kernel are written once and
+ 	compiled for SSE, AVX2, AVX-512, or NEON, with optional run-time
+ 	dispatch to the widest instruction set available.
+
+@section requirements_sec Requirements
+The headers need Boost and a C++14 compiler. DimensionedQuantities.h
+itself needs C++11, for the enable_if and decltype that detect dimension
+mismatches, and DimensionNames.h builds its unit strings and dimension
+names in C++14 constexpr functions. The CMake build asks for C++14
+unless CMAKE_CXX_STANDARD is already set; projects using the headers
+directly must do the same.
+
+@section build_sec Compiled Library
+Everything is usable from the headers alone. Large projects can configure
+with BUILD_COMPILED_LIBRARY, link to the physicalmodeling-compiled library,
+and include PhysicalModeling/ExternTemplates.h: the SI:: quantities and
+LinearSpringDamper are then instantiated once, in the library, and the
+library's headers are precompiled for each consuming target.
+
+@section module_sec_cxx20 C++20 Module
+With BUILD_CXX_MODULE (currently GCC 11 or newer), the dimensioned
+quantities, SI:: and dims:: typedefs, and spring-dampers are also built as
+the named module physical_modeling, so a translation unit can write
+@code
+import physical_modeling;
+@endcode
+instead of including the headers, and the template machinery is parsed
+once per build. Textual includes must come before the import.
 
 */
 
@@ -0,0 +1,314 @@
+/** @file	PositionBasedSolver.h
+	@brief	header for an extended position-based dynamics (XPBD) solver
+	for spring networks
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_POSITIONBASEDSOLVER_H_
+#define _PHYSICALMODELING_POSITIONBASEDSOLVER_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/SpringNetwork.h>
+#include <PhysicalModeling/StepBarrier.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+#include <cmath>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSoftBodies Soft Bodies
+	@{
+*/
+
+/** @brief Extended position-based dynamics (XPBD) solver for a
+	SpringNetwork, an unconditionally stable alternative to stepping the
+	springs explicitly.
+
+	Each spring becomes a compliant distance constraint with compliance
+	@f$ \alpha = 1/K @f$ and damping derived from B, so the solution
+	converges to the same physics as the spring-damper network while
+	remaining stable at large time steps (such as 60 Hz) regardless of
+	stiffness. Springs with zero stiffness are ignored.
+
+	Constraints are solved with a fixed number of Gauss-Seidel sweeps per
+	step, so the cost per step is predictable. Springs are partitioned
+	into colors such that no two springs of a color share a node; springs
+	within a color are independent, so with setThreads() each color is
+	split across threads that meet at a barrier before the next color.
+	Results do not depend on the thread count. The threads are started
+	and joined on every step, which pays off only for large networks.
+
+	The solver keeps a pointer to the network it was constructed with,
+	which must outlive it. Call rebuild() after changing the network's
+	springs.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class XpbdSolver {
+	public:
+		typedef SpringNetwork<Precision> network_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::length, Precision> length_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::accel, Precision> accel_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+
+		explicit XpbdSolver(network_t & network, std::size_t iterations = 10) :
+				_net(&network),
+				_iterations(iterations),
+				_gx(0),
+				_gy(0),
+				_gz(0),
+				_threads(1),
+				_maxError(0) {
+			rebuild();
+		}
+
+		/// @brief Number of Gauss-Seidel sweeps per step
+		std::size_t iterations() const { return _iterations; }
+		void setIterations(std::size_t n) { _iterations = n; }
+
+		void setGravity(const accel_t & gx, const accel_t & gy, const accel_t & gz) {
+			_gx = gx.value();
+			_gy = gy.value();
+			_gz = gz.value();
+		}
+
+		/// @brief Number of threads each step's sweeps are split across; 1 by default
+		std::size_t threads() const { return _threads; }
+		void setThreads(std::size_t n) { _threads = std::max<std::size_t>(1, n); }
+
+		/// @brief Recompute the spring coloring and resize the workspace
+		void rebuild();
+
+		/// @name Coloring
+		/// @{
+		std::size_t colorCount() const { return _colorStart.size() - 1; }
+		std::size_t colorSize(std::size_t c) const { return _colorStart[c + 1] - _colorStart[c]; }
+		std::size_t springColor(std::size_t s) const { return _color[s]; }
+		/// @}
+
+		/// @brief Advance the network by dt
+		void step(const time_t & dt);
+
+		/// @brief Largest deviation of a spring from its rest length seen
+		/// in the final sweep of the most recent step
+		length_t maxConstraintError() const { return length_t(_maxError); }
+
+	private:
+		Precision _solveSpring(std::size_t s, Precision h, Precision invH2);
+		/// @brief This thread's share of every color in every sweep, returning its largest final-sweep error
+		Precision _sweeps(std::size_t thread, std::size_t threads, Precision h, Precision invH2,
+			Internal::StepBarrier * barrier);
+
+		network_t * _net;
+		std::size_t _iterations;
+		Precision _gx, _gy, _gz;
+		std::size_t _threads;
+		Precision _maxError;
+
+		/// @brief Spring indices grouped by color
+		std::vector<std::size_t> _order;
+		/// @brief Offsets of each color in _order, plus the end
+		std::vector<std::size_t> _colorStart;
+		std::vector<std::size_t> _color;
+
+		/// @name Preallocated per-step workspace
+		/// @{
+		std::vector<Precision> _lambda;
+		std::vector<Precision> _px, _py, _pz;
+		/// @}
+};
+
+// -- inline implementations -- //
+template<class Precision>
+inline void XpbdSolver<Precision>::rebuild() {
+	const network_t & net = *_net;
+	const std::size_t springs = net.springCount();
+	const std::size_t nodes = net.nodeCount();
+
+	// Greedy edge coloring: lowest color not yet used at either endpoint
+	std::vector<std::vector<std::size_t> > nodeColors(nodes);
+	std::vector<bool> used;
+	std::size_t colors = 0;
+	_color.assign(springs, 0);
+	for (std::size_t s = 0; s < springs; ++s) {
+		used.assign(colors + 1, false);
+		const std::vector<std::size_t> & ca = nodeColors[net.a[s]];
+		const std::vector<std::size_t> & cb = nodeColors[net.b[s]];
+		for (std::size_t k = 0; k < ca.size(); ++k) {
+			used[ca[k]] = true;
+		}
+		for (std::size_t k = 0; k < cb.size(); ++k) {
+			used[cb[k]] = true;
+		}
+		const std::size_t c = std::find(used.begin(), used.end(), false) - used.begin();
+		_color[s] = c;
+		colors = std::max(colors, c + 1);
+		nodeColors[net.a[s]].push_back(c);
+		nodeColors[net.b[s]].push_back(c);
+	}
+
+	// Counting sort of springs by color, preserving spring order within a color
+	_colorStart.assign(colors + 1, 0);
+	for (std::size_t s = 0; s < springs; ++s) {
+		_colorStart[_color[s] + 1]++;
+	}
+	for (std::size_t c = 0; c < colors; ++c) {
+		_colorStart[c + 1] += _colorStart[c];
+	}
+	std::vector<std::size_t> fill(_colorStart.begin(), _colorStart.end() - 1);
+	_order.resize(springs);
+	for (std::size_t s = 0; s < springs; ++s) {
+		_order[fill[_color[s]]++] = s;
+	}
+
+	_lambda.assign(springs, 0);
+	_px.resize(nodes);
+	_py.resize(nodes);
+	_pz.resize(nodes);
+}
+
+template<class Precision>
+inline Precision XpbdSolver<Precision>::_solveSpring(std::size_t s, Precision h, Precision invH2) {
+	network_t & net = *_net;
+	if (net.K[s] <= 0) {
+		return 0;
+	}
+	const std::size_t a = net.a[s];
+	const std::size_t b = net.b[s];
+	const Precision wa = net.invMass[a];
+	const Precision wb = net.invMass[b];
+	const Precision w = wa + wb;
+	if (w <= 0) {
+		return 0;
+	}
+	const Precision dx = net.x[b] - net.x[a];
+	const Precision dy = net.y[b] - net.y[a];
+	const Precision dz = net.z[b] - net.z[a];
+	const Precision len = std::sqrt(dx * dx + dy * dy + dz * dz);
+	if (len <= std::numeric_limits<Precision>::min()) {
+		return 0;
+	}
+	const Precision inv = Precision(1) / len;
+	const Precision nx = dx * inv, ny = dy * inv, nz = dz * inv;
+	const Precision C = len - net.rest[s];
+
+	// alpha~ = 1 / (K h^2); gamma = alpha~ * (B h^2) / h = B / (K h)
+	const Precision alphaTilde = invH2 / net.K[s];
+	const Precision gamma = net.B[s] / (net.K[s] * h);
+	const Precision relMove = nx * ((net.x[b] - _px[b]) - (net.x[a] - _px[a]))
+		+ ny * ((net.y[b] - _py[b]) - (net.y[a] - _py[a]))
+		+ nz * ((net.z[b] - _pz[b]) - (net.z[a] - _pz[a]));
+	const Precision dLambda = (-C - alphaTilde * _lambda[s] - gamma * relMove)
+		/ ((Precision(1) + gamma) * w + alphaTilde);
+	_lambda[s] += dLambda;
+
+	net.x[a] -= wa * dLambda * nx;
+	net.y[a] -= wa * dLambda * ny;
+	net.z[a] -= wa * dLambda * nz;
+	net.x[b] += wb * dLambda * nx;
+	net.y[b] += wb * dLambda * ny;
+	net.z[b] += wb * dLambda * nz;
+	return std::fabs(C);
+}
+
+template<class Precision>
+inline Precision XpbdSolver<Precision>::_sweeps(std::size_t thread, std::size_t threads, Precision h, Precision invH2,
+		Internal::StepBarrier * barrier) {
+	Precision maxError = 0;
+	for (std::size_t it = 0; it < _iterations; ++it) {
+		const bool lastSweep = (it + 1 == _iterations);
+		for (std::size_t c = 0; c + 1 < _colorStart.size(); ++c) {
+			const std::size_t size = _colorStart[c + 1] - _colorStart[c];
+			const std::size_t begin = _colorStart[c] + size * thread / threads;
+			const std::size_t end = _colorStart[c] + size * (thread + 1) / threads;
+			for (std::size_t k = begin; k < end; ++k) {
+				const Precision err = _solveSpring(_order[k], h, invH2);
+				if (lastSweep) {
+					maxError = std::max(maxError, err);
+				}
+			}
+			// The next color may touch nodes this one moved
+			if (barrier) {
+				barrier->wait();
+			}
+		}
+	}
+	return maxError;
+}
+
+template<class Precision>
+inline void XpbdSolver<Precision>::step(const time_t & dt) {
+	network_t & net = *_net;
+	const Precision h = dt.value();
+	const Precision invH2 = Precision(1) / (h * h);
+	const std::size_t nodes = net.nodeCount();
+
+	// Predict positions from velocities and external acceleration
+	for (std::size_t i = 0; i < nodes; ++i) {
+		_px[i] = net.x[i];
+		_py[i] = net.y[i];
+		_pz[i] = net.z[i];
+		if (net.invMass[i] > 0) {
+			net.vx[i] += h * _gx;
+			net.vy[i] += h * _gy;
+			net.vz[i] += h * _gz;
+			net.x[i] += h * net.vx[i];
+			net.y[i] += h * net.vy[i];
+			net.z[i] += h * net.vz[i];
+		}
+	}
+	std::fill(_lambda.begin(), _lambda.end(), Precision(0));
+
+	if (_threads == 1) {
+		_maxError = _sweeps(0, 1, h, invH2, NULL);
+	} else {
+		Internal::StepBarrier barrier(_threads);
+		std::vector<Precision> errors(_threads);
+		std::vector<std::thread> workers;
+		for (std::size_t t = 0; t < _threads; ++t) {
+			workers.push_back(std::thread([this, t, h, invH2, &barrier, &errors] {
+				errors[t] = _sweeps(t, _threads, h, invH2, &barrier);
+			}));
+		}
+		for (std::size_t t = 0; t < workers.size(); ++t) {
+			workers[t].join();
+		}
+		_maxError = *std::max_element(errors.begin(), errors.end());
+	}
+
+	// Velocities from the corrected positions
+	const Precision invH = Precision(1) / h;
+	for (std::size_t i = 0; i < nodes; ++i) {
+		if (net.invMass[i] > 0) {
+			net.vx[i] = (net.x[i] - _px[i]) * invH;
+			net.vy[i] = (net.y[i] - _py[i]) * invH;
+			net.vz[i] = (net.z[i] - _pz[i]) * invH;
+		}
+	}
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_POSITIONBASEDSOLVER_H_
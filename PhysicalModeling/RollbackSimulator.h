@@ -0,0 +1,238 @@
+/** @file	RollbackSimulator.h
+	@brief	header for rollback and resimulation of soft bodies when
+	delayed inputs arrive
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_ROLLBACKSIMULATOR_H_
+#define _PHYSICALMODELING_ROLLBACKSIMULATOR_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/SoftBody.h>
+#include <PhysicalModeling/SpringNetworkSnapshot.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSoftBodies Soft Bodies
+	@{
+*/
+
+/** @brief Fixed-step driver for a SoftBody that can take inputs late.
+
+	Inputs are external forces on nodes. A force set for frame f applies
+	from the step out of frame f onward, until changed, so a remote input
+	that has not arrived yet is predicted by holding the last one. When
+	an input arrives for a frame that has already been simulated, the
+	next advance() (or an explicit resimulate()) restores the state
+	snapshot taken at the start of that frame and steps forward again
+	with the corrected inputs, giving exactly the state that on-time
+	inputs would have.
+
+	The state at the start of each of the last historyFrames frames, and
+	the input changes made in them, are kept in ring buffers allocated at
+	construction; inputs older than that are rejected. Resimulation runs
+	the body's ordinary batched step, so its throughput is that of
+	SoftBody::step() plus one snapshot capture per frame.
+
+	The simulator keeps a reference to the body, which must outlive it.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class RollbackSimulator {
+	public:
+		typedef SoftBody<Precision> body_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::force, Precision> force_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+
+		RollbackSimulator(body_t & body, const time_t & dt, std::size_t historyFrames = 64);
+
+		/// @brief Frame the body is at: the number of steps taken
+		std::size_t frame() const { return _frame; }
+
+		/// @brief Earliest frame whose input can still be changed
+		std::size_t oldestFrame() const {
+			return _frame + 1 >= _slots.size() ? _frame + 1 - _slots.size() : 0;
+		}
+
+		/** @brief Set the force on a node (by original mesh index) from
+			frame f onward.
+
+			@returns false, ignoring the input, if f is in the future or
+			older than oldestFrame().
+		*/
+		bool setInput(std::size_t f, std::size_t node, const force_t & fx, const force_t & fy, const force_t & fz);
+
+		/// @brief Resimulate if needed, then take one step
+		void advance();
+
+		/// @brief Bring the state up to date with late inputs, returning
+		/// the number of steps resimulated
+		std::size_t resimulate();
+
+		/// @name Statistics of the most recent resimulation
+		/// @{
+		std::size_t lastResimulatedSteps() const { return _lastSteps; }
+		time_t lastResimulationTime() const { return _lastTime; }
+		/// @}
+
+	private:
+		struct Input {
+			std::size_t node;
+			Precision f[3];
+		};
+
+		struct Slot {
+			std::size_t frame;
+			/// @brief Forces in effect entering the frame
+			std::vector<Input> held;
+			/// @brief Forces set for this frame
+			std::vector<Input> changes;
+			/// @brief State at the start of the frame
+			NetworkSnapshot<Precision> state;
+		};
+
+		static void _set(std::vector<Input> & inputs, const Input & input);
+		Slot & _slot(std::size_t f) { return _slots[f % _slots.size()]; }
+		void _enter(std::size_t f);
+		void _step(std::size_t f);
+
+		body_t & _body;
+		time_t _dt;
+		std::size_t _frame;
+		/// @brief Earliest frame with a late input, or _frame if none
+		std::size_t _dirty;
+		std::vector<Slot> _slots;
+		std::vector<Input> _held;
+
+		std::size_t _lastSteps;
+		time_t _lastTime;
+};
+
+// -- inline implementations -- //
+template<class Precision>
+inline RollbackSimulator<Precision>::RollbackSimulator(body_t & body, const time_t & dt, std::size_t historyFrames) :
+		_body(body),
+		_dt(dt),
+		_frame(0),
+		_dirty(0),
+		_slots(std::max(historyFrames, std::size_t(1))),
+		_lastSteps(0),
+		_lastTime(0) {
+	const SpringNetwork<Precision> & net = body.network();
+	for (std::size_t i = 0; i < _slots.size(); ++i) {
+		// Marks the slot as holding no frame yet
+		_slots[i].frame = i + 1;
+		_slots[i].state.reserve(net.nodeCount(), net.springCount());
+	}
+	_enter(0);
+}
+
+template<class Precision>
+inline void RollbackSimulator<Precision>::_set(std::vector<Input> & inputs, const Input & input) {
+	for (std::size_t k = 0; k < inputs.size(); ++k) {
+		if (inputs[k].node == input.node) {
+			inputs[k] = input;
+			return;
+		}
+	}
+	inputs.push_back(input);
+}
+
+template<class Precision>
+inline bool RollbackSimulator<Precision>::setInput(std::size_t f, std::size_t node,
+		const force_t & fx, const force_t & fy, const force_t & fz) {
+	if (f > _frame || f < oldestFrame()) {
+		return false;
+	}
+	Input input;
+	input.node = node;
+	input.f[0] = fx.value();
+	input.f[1] = fy.value();
+	input.f[2] = fz.value();
+	_set(_slot(f).changes, input);
+	_dirty = std::min(_dirty, f);
+	return true;
+}
+
+template<class Precision>
+inline void RollbackSimulator<Precision>::_enter(std::size_t f) {
+	Slot & slot = _slot(f);
+	if (slot.frame != f) {
+		// First visit: the slot held an expired frame
+		slot.frame = f;
+		slot.changes.clear();
+	}
+	slot.held = _held;
+	slot.state.capture(_body.network());
+}
+
+template<class Precision>
+inline void RollbackSimulator<Precision>::_step(std::size_t f) {
+	const Slot & slot = _slot(f);
+	_held = slot.held;
+	for (std::size_t k = 0; k < slot.changes.size(); ++k) {
+		_set(_held, slot.changes[k]);
+	}
+	_body.clearExternalForces();
+	for (std::size_t k = 0; k < _held.size(); ++k) {
+		_body.setExternalForce(_held[k].node,
+			force_t(_held[k].f[0]), force_t(_held[k].f[1]), force_t(_held[k].f[2]));
+	}
+	_body.step(_dt);
+	_enter(f + 1);
+}
+
+template<class Precision>
+inline std::size_t RollbackSimulator<Precision>::resimulate() {
+	if (_dirty >= _frame) {
+		_dirty = _frame;
+		return 0;
+	}
+	typedef std::chrono::steady_clock clock;
+	const clock::time_point start = clock::now();
+
+	_slot(_dirty).state.restore(_body.network());
+	for (std::size_t f = _dirty; f < _frame; ++f) {
+		_step(f);
+	}
+	_lastSteps = _frame - _dirty;
+	_dirty = _frame;
+
+	_lastTime = time_t(std::chrono::duration<Precision>(clock::now() - start).count());
+	return _lastSteps;
+}
+
+template<class Precision>
+inline void RollbackSimulator<Precision>::advance() {
+	resimulate();
+	_step(_frame);
+	++_frame;
+	_dirty = _frame;
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_ROLLBACKSIMULATOR_H_
@@ -0,0 +1,388 @@
+/** @file	SimdPack.h
+	@brief	header for a portable fixed-width vector of values, used to
+	write batched kernels once for every instruction set
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_SIMDPACK_H_
+#define _PHYSICALMODELING_SIMDPACK_H_
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <cstddef>
+#include <cmath>
+
+/** @def PHYSICALMODELING_SIMD_SCALAR
+	@brief Optional define to make Simd::NativeWidth 1, turning every
+	batched kernel into plain scalar code.
+*/
+
+/** @def PHYSICALMODELING_SIMD_DISPATCH
+	@brief Optional define to select the widest instruction set the
+	running processor supports (AVX-512, AVX2, or the compile-time
+	baseline) when a batched kernel is first called.
+
+	Only has an effect with GCC or Clang on x86-64; elsewhere kernels
+	always use the compile-time width. The AVX2 and AVX-512 versions are
+	compiled without FMA contraction, so they round like the baseline.
+	The CMake cache variable PHYSICALMODELING_SIMD sets this and the
+	other options.
+*/
+
+/// @cond innerworkings
+#if defined(__GNUC__) && !defined(PHYSICALMODELING_SIMD_SCALAR)
+#	define PHYSICALMODELING_SIMD_VECTOR_EXTENSIONS
+#endif
+
+#if defined(__GNUC__)
+#	define PHYSICALMODELING_SIMD_INLINE inline __attribute__((always_inline))
+#else
+#	define PHYSICALMODELING_SIMD_INLINE inline
+#endif
+
+#if defined(PHYSICALMODELING_SIMD_DISPATCH) && defined(__GNUC__) && defined(__x86_64__) && !defined(PHYSICALMODELING_SIMD_SCALAR)
+#	define PHYSICALMODELING_SIMD_RUNTIME_DISPATCH
+#endif
+
+// Dispatched clones must round like the baseline: GCC would otherwise
+// contract a * b + c into an FMA only in the AVX2/AVX-512 clones, making
+// results depend on the processor. Clang only contracts within a single
+// expression, which Pack's operators never form.
+#if defined(PHYSICALMODELING_SIMD_RUNTIME_DISPATCH) && defined(__clang__)
+#	define PHYSICALMODELING_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#	define PHYSICALMODELING_SIMD_TARGET_AVX512 __attribute__((target("avx512f")))
+#elif defined(PHYSICALMODELING_SIMD_RUNTIME_DISPATCH)
+#	define PHYSICALMODELING_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma"), optimize("fp-contract=off")))
+#	define PHYSICALMODELING_SIMD_TARGET_AVX512 __attribute__((target("avx512f"), optimize("fp-contract=off")))
+#endif
+
+#if defined(PHYSICALMODELING_SIMD_SCALAR)
+#	define PHYSICALMODELING_SIMD_BYTES 0
+#elif defined(__AVX512F__)
+#	define PHYSICALMODELING_SIMD_BYTES 64
+#elif defined(__AVX__)
+#	define PHYSICALMODELING_SIMD_BYTES 32
+#elif defined(__SSE2__) || defined(__ARM_NEON) || defined(__ALTIVEC__)
+#	define PHYSICALMODELING_SIMD_BYTES 16
+#else
+#	define PHYSICALMODELING_SIMD_BYTES 0
+#endif
+/// @endcond
+
+namespace PhysicalModeling {
+
+/** @defgroup gVectorization Vectorization
+	@brief Portable SIMD building blocks for batched kernels.
+
+	A kernel is written once in terms of Simd::Pack<T, W>, a vector of W
+	values, and instantiated with the lane width the target supports.
+	With GCC or Clang, Pack is a compiler vector type, so the same source
+	becomes SSE, AVX2, AVX-512, or NEON code depending on the compile
+	flags; other compilers get a loop over an array. With
+	PHYSICALMODELING_SIMD_DISPATCH, kernels are also compiled for AVX2
+	and AVX-512 and chosen at run time, so one binary runs well on every
+	x86-64 machine; Simd::forEachBlock does the choosing.
+	@{
+*/
+
+/// @brief Portable vector types and instruction-set selection
+namespace Simd {
+
+	/// @brief Lanes of T in the widest vector the compile-time target has
+	template <class T>
+	struct NativeWidth {
+		enum { value = PHYSICALMODELING_SIMD_BYTES > sizeof(T) ? PHYSICALMODELING_SIMD_BYTES / sizeof(T) : 1 };
+	};
+
+	/// @brief Instruction sets a kernel can be dispatched to
+	enum Isa {
+		/// @brief Whatever the compile flags allow
+		IsaBaseline,
+		IsaAvx2,
+		IsaAvx512
+	};
+
+	/// @brief Instruction set batched kernels will use on this processor
+	inline Isa runtimeIsa() {
+#ifdef PHYSICALMODELING_SIMD_RUNTIME_DISPATCH
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f")) {
+			return IsaAvx512;
+		}
+		if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+			return IsaAvx2;
+		}
+#endif
+		return IsaBaseline;
+	}
+
+	/// @brief Readable name of an instruction set, for logs
+	inline const char * isaName(Isa isa) {
+		switch (isa) {
+			case IsaAvx512:
+				return "avx512";
+			case IsaAvx2:
+				return "avx2";
+			default:
+				break;
+		}
+		switch (int(PHYSICALMODELING_SIMD_BYTES)) {
+			case 64:
+				return "baseline (512-bit)";
+			case 32:
+				return "baseline (256-bit)";
+			case 16:
+				return "baseline (128-bit)";
+			default:
+				return "baseline (scalar)";
+		}
+	}
+
+	/** @brief W values of type T, operated on together.
+
+		W must be a power of two. Loads and stores are unaligned, so data
+		need not be padded; kernels handle the remainder of an array with
+		a Pack of width 1.
+	*/
+	template <class T, int W>
+	struct Pack {
+		typedef T value_type;
+		enum { width = W };
+
+#ifdef PHYSICALMODELING_SIMD_VECTOR_EXTENSIONS
+		typedef T native_type __attribute__((vector_size(sizeof(T) * W)));
+#else
+		struct native_type {
+			T lane[W];
+			T & operator[](int i) { return lane[i]; }
+			const T & operator[](int i) const { return lane[i]; }
+		};
+#endif
+
+		native_type v;
+
+		T operator[](int i) const { return v[i]; }
+
+		static PHYSICALMODELING_SIMD_INLINE Pack broadcast(T x) {
+			Pack r;
+			for (int i = 0; i < W; ++i) {
+				r.v[i] = x;
+			}
+			return r;
+		}
+
+		static PHYSICALMODELING_SIMD_INLINE Pack load(const T * p) {
+			Pack r;
+			for (int i = 0; i < W; ++i) {
+				r.v[i] = p[i];
+			}
+			return r;
+		}
+
+		/// @brief Lane i gets p[index[i]]
+		template <class Index>
+		static PHYSICALMODELING_SIMD_INLINE Pack gather(const T * p, const Index * index) {
+			Pack r;
+			for (int i = 0; i < W; ++i) {
+				r.v[i] = p[index[i]];
+			}
+			return r;
+		}
+
+		PHYSICALMODELING_SIMD_INLINE void store(T * p) const {
+			for (int i = 0; i < W; ++i) {
+				p[i] = v[i];
+			}
+		}
+	};
+
+	/// @cond innerworkings
+#ifdef PHYSICALMODELING_SIMD_VECTOR_EXTENSIONS
+#	define PHYSICALMODELING_SIMD_BINARY(OP) \
+	template <class T, int W> \
+	PHYSICALMODELING_SIMD_INLINE Pack<T, W> operator OP(const Pack<T, W> & l, const Pack<T, W> & r) { \
+		Pack<T, W> out; \
+		out.v = l.v OP r.v; \
+		return out; \
+	}
+#else
+#	define PHYSICALMODELING_SIMD_BINARY(OP) \
+	template <class T, int W> \
+	PHYSICALMODELING_SIMD_INLINE Pack<T, W> operator OP(const Pack<T, W> & l, const Pack<T, W> & r) { \
+		Pack<T, W> out; \
+		for (int i = 0; i < W; ++i) { \
+			out.v[i] = l.v[i] OP r.v[i]; \
+		} \
+		return out; \
+	}
+#endif
+	/// @endcond
+
+	/// @name Lane-wise arithmetic
+	/// @{
+	PHYSICALMODELING_SIMD_BINARY(+)
+	PHYSICALMODELING_SIMD_BINARY(-)
+	PHYSICALMODELING_SIMD_BINARY(*)
+	PHYSICALMODELING_SIMD_BINARY(/)
+	/// @}
+
+#undef PHYSICALMODELING_SIMD_BINARY
+
+	template <class T, int W>
+	PHYSICALMODELING_SIMD_INLINE Pack<T, W> sqrt(const Pack<T, W> & x) {
+		Pack<T, W> out;
+		for (int i = 0; i < W; ++i) {
+			out.v[i] = std::sqrt(x.v[i]);
+		}
+		return out;
+	}
+
+	/// @brief Lane-wise (x > threshold ? a : b)
+	template <class T, int W>
+	PHYSICALMODELING_SIMD_INLINE Pack<T, W> selectGreater(const Pack<T, W> & x, const Pack<T, W> & threshold,
+			const Pack<T, W> & a, const Pack<T, W> & b) {
+		Pack<T, W> out;
+#ifdef PHYSICALMODELING_SIMD_VECTOR_EXTENSIONS
+		out.v = x.v > threshold.v ? a.v : b.v;
+#else
+		for (int i = 0; i < W; ++i) {
+			out.v[i] = x.v[i] > threshold.v[i] ? a.v[i] : b.v[i];
+		}
+#endif
+		return out;
+	}
+
+	/** @brief W complex values, stored as a pack of real parts and a
+		pack of imaginary parts, so complex arithmetic is lane-wise.
+	*/
+	template <class T, int W>
+	struct ComplexPack {
+		typedef Pack<T, W> pack_type;
+
+		pack_type re;
+		pack_type im;
+
+		static PHYSICALMODELING_SIMD_INLINE ComplexPack make(const pack_type & re, const pack_type & im) {
+			ComplexPack r;
+			r.re = re;
+			r.im = im;
+			return r;
+		}
+	};
+
+	/// @name Lane-wise complex arithmetic
+	/// @{
+	template <class T, int W>
+	PHYSICALMODELING_SIMD_INLINE ComplexPack<T, W> operator+(const ComplexPack<T, W> & l, const ComplexPack<T, W> & r) {
+		return ComplexPack<T, W>::make(l.re + r.re, l.im + r.im);
+	}
+
+	template <class T, int W>
+	PHYSICALMODELING_SIMD_INLINE ComplexPack<T, W> operator-(const ComplexPack<T, W> & l, const ComplexPack<T, W> & r) {
+		return ComplexPack<T, W>::make(l.re - r.re, l.im - r.im);
+	}
+
+	template <class T, int W>
+	PHYSICALMODELING_SIMD_INLINE ComplexPack<T, W> operator*(const ComplexPack<T, W> & l, const ComplexPack<T, W> & r) {
+		return ComplexPack<T, W>::make(l.re * r.re - l.im * r.im, l.re * r.im + l.im * r.re);
+	}
+
+	/// @brief Complex times real
+	template <class T, int W>
+	PHYSICALMODELING_SIMD_INLINE ComplexPack<T, W> operator*(const ComplexPack<T, W> & l, const Pack<T, W> & r) {
+		return ComplexPack<T, W>::make(l.re * r, l.im * r);
+	}
+
+	/// @brief Quotient by the textbook formula: no scaling against overflow
+	template <class T, int W>
+	PHYSICALMODELING_SIMD_INLINE ComplexPack<T, W> operator/(const ComplexPack<T, W> & l, const ComplexPack<T, W> & r) {
+		const Pack<T, W> inv = Pack<T, W>::broadcast(T(1)) / (r.re * r.re + r.im * r.im);
+		return ComplexPack<T, W>::make((l.re * r.re + l.im * r.im) * inv, (l.im * r.re - l.re * r.im) * inv);
+	}
+
+	/// @brief Squared magnitude
+	template <class T, int W>
+	PHYSICALMODELING_SIMD_INLINE Pack<T, W> norm(const ComplexPack<T, W> & z) {
+		return z.re * z.re + z.im * z.im;
+	}
+	/// @}
+
+	/// @cond innerworkings
+	template <class T, class Kernel>
+	inline void blocksBaseline(const Kernel & kernel, std::size_t first, std::size_t last) {
+		kernel.template blocks<1>(kernel.template blocks<NativeWidth<T>::value>(first, last), last);
+	}
+
+#ifdef PHYSICALMODELING_SIMD_RUNTIME_DISPATCH
+	template <class T, class Kernel>
+	PHYSICALMODELING_SIMD_TARGET_AVX2 void blocksAvx2(const Kernel & kernel, std::size_t first, std::size_t last) {
+		kernel.template blocks<1>(kernel.template blocks<int(32 / sizeof(T))>(first, last), last);
+	}
+
+	template <class T, class Kernel>
+	PHYSICALMODELING_SIMD_TARGET_AVX512 void blocksAvx512(const Kernel & kernel, std::size_t first, std::size_t last) {
+		kernel.template blocks<1>(kernel.template blocks<int(64 / sizeof(T))>(first, last), last);
+	}
+
+	/// @brief runtimeIsa(), looked up once per process
+	inline Isa dispatchIsa() {
+		static const Isa isa = runtimeIsa();
+		return isa;
+	}
+#endif
+	/// @endcond
+
+	/** @brief Run a batched kernel over [first, last) at the widest lane
+		count of T available, then one lane at a time over the remainder.
+
+		Kernel provides
+		@code
+		template <int W>
+		PHYSICALMODELING_SIMD_INLINE std::size_t blocks(std::size_t first, std::size_t last) const;
+		@endcode
+		which handles [first, first + k W) for the largest k that fits in
+		last and returns first + k W. The width is chosen at compile time,
+		or at the first call when built with PHYSICALMODELING_SIMD_DISPATCH;
+		blocks must be inlined for the AVX2 and AVX-512 versions to use
+		those instructions.
+	*/
+	template <class T, class Kernel>
+	inline void forEachBlock(const Kernel & kernel, std::size_t first, std::size_t last) {
+#ifdef PHYSICALMODELING_SIMD_RUNTIME_DISPATCH
+		const Isa isa = dispatchIsa();
+		if (isa == IsaAvx512) {
+			blocksAvx512<T>(kernel, first, last);
+			return;
+		}
+		if (isa == IsaAvx2) {
+			blocksAvx2<T>(kernel, first, last);
+			return;
+		}
+#endif
+		blocksBaseline<T>(kernel, first, last);
+	}
+
+} // end of Simd namespace
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_SIMDPACK_H_
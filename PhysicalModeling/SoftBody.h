@@ -0,0 +1,645 @@
+/** @file	SoftBody.h
+	@brief	header for mass-spring soft bodies and cloth
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_SOFTBODY_H_
+#define _PHYSICALMODELING_SOFTBODY_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/LinearSpringDamper.h>
+#include <PhysicalModeling/SpringNetwork.h>
+#include <PhysicalModeling/SpringForceKernel.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <map>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+#include <cmath>
+#include <chrono>
+
+namespace PhysicalModeling {
+
+/** @defgroup gSoftBodies Soft Bodies
+	@brief Deformable bodies and cloth built from linear spring-damper elements.
+
+	A SoftBodyMesh describes geometry: point masses and the triangles and
+	quads connecting them. A SoftBody is built from a mesh by generating
+	three classes of springs:
+	 - structural springs along every polygon edge,
+	 - shear springs along quad diagonals,
+	 - bend springs connecting the vertices on either side of each
+	   interior edge, resisting folding.
+
+	During construction, nodes are renumbered (by default with reverse
+	Cuthill-McKee) and springs sorted by their endpoints, so force
+	accumulation walks memory nearly sequentially. Node indices passed to
+	and returned from SoftBody always refer to the original mesh
+	numbering.
+
+	@code
+	namespace dq = PhysicalModeling::DimensionedQuantities;
+	PhysicalModeling::SoftBodyMesh<> mesh =
+		PhysicalModeling::SoftBodyMesh<>::grid(32, 32, dq::SI::Meters(0.01), dq::SI::Kilograms(0.2));
+	PhysicalModeling::SpringParameters<> structural(dq::SI::NewtonsPerMeter(500), dq::SI::NewtonSecondsPerMeter(0.05));
+	PhysicalModeling::SpringParameters<> shear(dq::SI::NewtonsPerMeter(100), dq::SI::NewtonSecondsPerMeter(0.01));
+	PhysicalModeling::SpringParameters<> bend(dq::SI::NewtonsPerMeter(20), dq::SI::NewtonSecondsPerMeter(0.01));
+	PhysicalModeling::SoftBody<> cloth(mesh, structural, shear, bend);
+	cloth.pin(0);
+	cloth.setGravity(dq::SI::MetersPerSecondSquared(0), dq::SI::MetersPerSecondSquared(-9.81), dq::SI::MetersPerSecondSquared(0));
+	cloth.step(dq::SI::Seconds(0.0005));
+	@endcode
+	@{
+*/
+
+/// @brief The classes of spring generated from a mesh
+enum SpringType {
+	StructuralSpring = 0,
+	ShearSpring = 1,
+	BendSpring = 2
+};
+
+/// @brief Node renumbering strategies for cache locality
+enum NodeOrdering {
+	/// @brief Keep the mesh's node order
+	OriginalOrder,
+	/// @brief Sort nodes along a 3D Morton (Z-order) space-filling curve
+	MortonOrder,
+	/// @brief Reverse Cuthill-McKee: minimizes spring index bandwidth
+	ReverseCuthillMcKeeOrder
+};
+
+/// @brief Stiffness and damping shared by a class of springs
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct SpringParameters {
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::stiffness, Precision> stiffness_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::viscosity, Precision> viscosity_t;
+
+	SpringParameters(const stiffness_t & K, const viscosity_t & B = viscosity_t()) :
+		stiffness(K),
+		viscosity(B) {}
+
+	/// @brief Take stiffness and damping from an existing spring-damper element
+	explicit SpringParameters(const LinearSpringDamper<Precision> & element) :
+		stiffness(element.stiffness()),
+		viscosity(element.viscosity()) {}
+
+	stiffness_t stiffness;
+	viscosity_t viscosity;
+};
+
+/// @brief Point masses and the polygons connecting them
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct SoftBodyMesh {
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::length, Precision> length_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::mass, Precision> mass_t;
+
+	/// @brief Add a node, returning its index
+	std::size_t addNode(const length_t & px, const length_t & py, const length_t & pz, const mass_t & m) {
+		x.push_back(px.value());
+		y.push_back(py.value());
+		z.push_back(pz.value());
+		mass.push_back(m.value());
+		return mass.size() - 1;
+	}
+
+	void addTriangle(std::size_t a, std::size_t b, std::size_t c) {
+		triangles.push_back(a);
+		triangles.push_back(b);
+		triangles.push_back(c);
+	}
+
+	/// @brief Add a quad, with vertices given in order around its boundary
+	void addQuad(std::size_t a, std::size_t b, std::size_t c, std::size_t d) {
+		quads.push_back(a);
+		quads.push_back(b);
+		quads.push_back(c);
+		quads.push_back(d);
+	}
+
+	std::size_t nodeCount() const { return mass.size(); }
+
+	/// @brief Build a flat rows x cols grid of quads in the x-z plane,
+	/// with the total mass spread evenly over the nodes.
+	static SoftBodyMesh grid(std::size_t rows, std::size_t cols, const length_t & spacing, const mass_t & totalMass) {
+		SoftBodyMesh ret;
+		const mass_t nodeMass(totalMass.value() / Precision(rows * cols));
+		for (std::size_t r = 0; r < rows; ++r) {
+			for (std::size_t c = 0; c < cols; ++c) {
+				ret.addNode(length_t(spacing.value() * c), length_t(), length_t(spacing.value() * r), nodeMass);
+			}
+		}
+		for (std::size_t r = 0; r + 1 < rows; ++r) {
+			for (std::size_t c = 0; c + 1 < cols; ++c) {
+				const std::size_t n = r * cols + c;
+				ret.addQuad(n, n + 1, n + 1 + cols, n + cols);
+			}
+		}
+		return ret;
+	}
+
+	/// @name Node positions and masses, in SI units
+	/// @{
+	std::vector<Precision> x;
+	std::vector<Precision> y;
+	std::vector<Precision> z;
+	std::vector<Precision> mass;
+	/// @}
+
+	/// @brief Three node indices per triangle
+	std::vector<std::size_t> triangles;
+	/// @brief Four node indices per quad
+	std::vector<std::size_t> quads;
+};
+
+/// @brief Wall-clock time spent in the phases of the most recent step
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct SoftBodyTiming {
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+	time_t forces;
+	time_t integration;
+	time_t total() const { return forces + integration; }
+};
+
+/** @brief Mass-spring soft body stepped with semi-implicit Euler.
+
+	Node and spring data are stored in a SpringNetwork, in the
+	cache-friendly order chosen at construction. Stepping does not
+	allocate.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class SoftBody {
+	public:
+		typedef SoftBodyMesh<Precision> mesh_t;
+		typedef SpringParameters<Precision> spring_parameters_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::length, Precision> length_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::speed, Precision> speed_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::accel, Precision> accel_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::force, Precision> force_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+
+		SoftBody(const mesh_t & mesh,
+				const spring_parameters_t & structural,
+				const spring_parameters_t & shear,
+				const spring_parameters_t & bend,
+				NodeOrdering ordering = ReverseCuthillMcKeeOrder);
+
+		std::size_t nodeCount() const { return _net.invMass.size(); }
+		std::size_t springCount() const { return _net.a.size(); }
+		std::size_t springCount(SpringType type) const { return _typeCounts[type]; }
+
+		/// @brief Fix a node (by original mesh index) in place
+		void pin(std::size_t node) { _net.invMass[_rank[node]] = 0; }
+
+		void setGravity(const accel_t & gx, const accel_t & gy, const accel_t & gz) {
+			_gx = gx.value();
+			_gy = gy.value();
+			_gz = gz.value();
+		}
+
+		/// @brief Apply a constant external force to a node (by original
+		/// mesh index) until it is changed or cleared
+		void setExternalForce(std::size_t node, const force_t & fx, const force_t & fy, const force_t & fz);
+
+		/// @brief Remove all external forces
+		void clearExternalForces() { _external.clear(); }
+
+		/// @brief Get a node's position, by original mesh index
+		void position(std::size_t node, length_t & px, length_t & py, length_t & pz) const {
+			const std::size_t i = _rank[node];
+			px = length_t(_net.x[i]);
+			py = length_t(_net.y[i]);
+			pz = length_t(_net.z[i]);
+		}
+
+		/// @brief Set a node's position, by original mesh index
+		void setPosition(std::size_t node, const length_t & px, const length_t & py, const length_t & pz) {
+			const std::size_t i = _rank[node];
+			_net.x[i] = px.value();
+			_net.y[i] = py.value();
+			_net.z[i] = pz.value();
+		}
+
+		/// @brief Get a node's velocity, by original mesh index
+		void velocity(std::size_t node, speed_t & vx, speed_t & vy, speed_t & vz) const {
+			const std::size_t i = _rank[node];
+			vx = speed_t(_net.vx[i]);
+			vy = speed_t(_net.vy[i]);
+			vz = speed_t(_net.vz[i]);
+		}
+
+		/// @brief Internal (reordered) index of a node given its mesh index
+		std::size_t internalIndex(std::size_t node) const { return _rank[node]; }
+
+		/// @brief Largest difference between the internal indices of the
+		/// two ends of any spring: a proxy for the working-set size of
+		/// force accumulation.
+		std::size_t springBandwidth() const;
+
+		/// @brief Accumulate spring, damper, gravity, and external forces on all nodes
+		void accumulateForces();
+
+		/// @brief Advance by dt, recording phase timings
+		void step(const time_t & dt);
+
+		/// @brief Direct access to the node and spring arrays, in internal
+		/// order, for use by alternative solvers.
+		SpringNetwork<Precision> & network() { return _net; }
+		const SpringNetwork<Precision> & network() const { return _net; }
+
+		/// @brief Timings recorded by the most recent step()
+		const SoftBodyTiming<Precision> & lastStepTiming() const { return _timing; }
+
+	private:
+		void _addSpring(std::map<std::pair<std::size_t, std::size_t>, bool> & seen,
+				const mesh_t & mesh, std::size_t a, std::size_t b,
+				const spring_parameters_t & params, SpringType type);
+		void _generateSprings(const mesh_t & mesh,
+				const spring_parameters_t & structural,
+				const spring_parameters_t & shear,
+				const spring_parameters_t & bend);
+		std::vector<std::size_t> _mortonOrder() const;
+		std::vector<std::size_t> _reverseCuthillMcKeeOrder() const;
+		void _applyOrder(const std::vector<std::size_t> & order);
+
+		template<class T>
+		static void _permute(std::vector<T> & v, const std::vector<std::size_t> & order) {
+			std::vector<T> tmp(v.size());
+			for (std::size_t i = 0; i < order.size(); ++i) {
+				tmp[i] = v[order[i]];
+			}
+			v.swap(tmp);
+		}
+
+		/// @brief Node and spring data, in internal order
+		SpringNetwork<Precision> _net;
+
+		/// @name Per-node force accumulators, in internal order
+		/// @{
+		std::vector<Precision> _fx, _fy, _fz;
+		/// @}
+
+		/// @brief External forces: internal node index and force components
+		struct ExternalForce {
+			std::size_t node;
+			Precision f[3];
+		};
+		std::vector<ExternalForce> _external;
+
+		/// @brief Internal index of each original mesh node
+		std::vector<std::size_t> _rank;
+
+		std::size_t _typeCounts[3];
+		Precision _gx, _gy, _gz;
+		SoftBodyTiming<Precision> _timing;
+};
+
+// -- inline implementations -- //
+template<class Precision>
+inline SoftBody<Precision>::SoftBody(const mesh_t & mesh,
+		const spring_parameters_t & structural,
+		const spring_parameters_t & shear,
+		const spring_parameters_t & bend,
+		NodeOrdering ordering) :
+			_fx(mesh.nodeCount()),
+			_fy(mesh.nodeCount()),
+			_fz(mesh.nodeCount()),
+			_rank(mesh.nodeCount()),
+			_gx(0),
+			_gy(0),
+			_gz(0) {
+	_net.resizeNodes(mesh.nodeCount());
+	_net.x = mesh.x;
+	_net.y = mesh.y;
+	_net.z = mesh.z;
+	for (std::size_t i = 0; i < mesh.nodeCount(); ++i) {
+		_net.invMass[i] = mesh.mass[i] > 0 ? Precision(1) / mesh.mass[i] : Precision(0);
+		_rank[i] = i;
+	}
+	_typeCounts[StructuralSpring] = _typeCounts[ShearSpring] = _typeCounts[BendSpring] = 0;
+	_generateSprings(mesh, structural, shear, bend);
+
+	switch (ordering) {
+		case MortonOrder:
+			_applyOrder(_mortonOrder());
+			break;
+		case ReverseCuthillMcKeeOrder:
+			_applyOrder(_reverseCuthillMcKeeOrder());
+			break;
+		case OriginalOrder:
+		default:
+			_applyOrder(std::vector<std::size_t>(_rank));
+			break;
+	}
+}
+
+template<class Precision>
+inline void SoftBody<Precision>::_addSpring(std::map<std::pair<std::size_t, std::size_t>, bool> & seen,
+		const mesh_t & mesh, std::size_t a, std::size_t b,
+		const spring_parameters_t & params, SpringType type) {
+	if (a == b) {
+		return;
+	}
+	const std::pair<std::size_t, std::size_t> key(std::min(a, b), std::max(a, b));
+	if (seen.find(key) != seen.end()) {
+		return;
+	}
+	seen[key] = true;
+	const Precision dx = mesh.x[b] - mesh.x[a];
+	const Precision dy = mesh.y[b] - mesh.y[a];
+	const Precision dz = mesh.z[b] - mesh.z[a];
+	_net.a.push_back(key.first);
+	_net.b.push_back(key.second);
+	_net.rest.push_back(std::sqrt(dx * dx + dy * dy + dz * dz));
+	_net.K.push_back(params.stiffness.value());
+	_net.B.push_back(params.viscosity.value());
+	_typeCounts[type]++;
+}
+
+template<class Precision>
+inline void SoftBody<Precision>::_generateSprings(const mesh_t & mesh,
+		const spring_parameters_t & structural,
+		const spring_parameters_t & shear,
+		const spring_parameters_t & bend) {
+	typedef std::pair<std::size_t, std::size_t> Edge;
+	std::map<Edge, bool> seen;
+
+	// For each directed polygon edge, the vertices flanking it in its
+	// polygon: the vertex before the edge start and after the edge end
+	// (identical for triangles).
+	struct Flank {
+		std::size_t beforeStart;
+		std::size_t afterEnd;
+	};
+	std::map<Edge, std::vector<Flank> > edgeFlanks;
+
+	const std::vector<std::size_t> * polys[2] = {&mesh.triangles, &mesh.quads};
+	for (int p = 0; p < 2; ++p) {
+		const std::vector<std::size_t> & verts = *polys[p];
+		const std::size_t sides = p + 3;
+		for (std::size_t f = 0; f + sides <= verts.size(); f += sides) {
+			for (std::size_t e = 0; e < sides; ++e) {
+				const std::size_t s = verts[f + e];
+				const std::size_t t = verts[f + (e + 1) % sides];
+				_addSpring(seen, mesh, s, t, structural, StructuralSpring);
+				Flank fl;
+				fl.beforeStart = verts[f + (e + sides - 1) % sides];
+				fl.afterEnd = verts[f + (e + 2) % sides];
+				// Store with the edge normalized so both faces find each other
+				if (s < t) {
+					edgeFlanks[Edge(s, t)].push_back(fl);
+				} else {
+					std::swap(fl.beforeStart, fl.afterEnd);
+					edgeFlanks[Edge(t, s)].push_back(fl);
+				}
+			}
+		}
+	}
+
+	for (std::size_t f = 0; f + 4 <= mesh.quads.size(); f += 4) {
+		_addSpring(seen, mesh, mesh.quads[f], mesh.quads[f + 2], shear, ShearSpring);
+		_addSpring(seen, mesh, mesh.quads[f + 1], mesh.quads[f + 3], shear, ShearSpring);
+	}
+
+	// Bend springs: across each interior edge, join the flanking vertex
+	// next to each endpoint in one face to its counterpart in the other.
+	for (typename std::map<Edge, std::vector<Flank> >::const_iterator it = edgeFlanks.begin(); it != edgeFlanks.end(); ++it) {
+		const std::vector<Flank> & flanks = it->second;
+		for (std::size_t i = 0; i < flanks.size(); ++i) {
+			for (std::size_t j = i + 1; j < flanks.size(); ++j) {
+				_addSpring(seen, mesh, flanks[i].beforeStart, flanks[j].beforeStart, bend, BendSpring);
+				_addSpring(seen, mesh, flanks[i].afterEnd, flanks[j].afterEnd, bend, BendSpring);
+			}
+		}
+	}
+}
+
+template<class Precision>
+inline std::vector<std::size_t> SoftBody<Precision>::_mortonOrder() const {
+	const std::size_t n = nodeCount();
+	std::vector<std::size_t> order(n);
+	if (n == 0) {
+		return order;
+	}
+	Precision lo[3] = {_net.x[0], _net.y[0], _net.z[0]};
+	Precision hi[3] = {_net.x[0], _net.y[0], _net.z[0]};
+	for (std::size_t i = 0; i < n; ++i) {
+		const Precision p[3] = {_net.x[i], _net.y[i], _net.z[i]};
+		for (int d = 0; d < 3; ++d) {
+			lo[d] = std::min(lo[d], p[d]);
+			hi[d] = std::max(hi[d], p[d]);
+		}
+	}
+
+	std::vector<std::pair<unsigned long, std::size_t> > keyed(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		const Precision p[3] = {_net.x[i], _net.y[i], _net.z[i]};
+		unsigned long code = 0;
+		unsigned long cell[3];
+		for (int d = 0; d < 3; ++d) {
+			const Precision extent = hi[d] - lo[d];
+			cell[d] = extent > 0 ? static_cast<unsigned long>((p[d] - lo[d]) / extent * Precision(1023)) : 0;
+		}
+		for (int bit = 9; bit >= 0; --bit) {
+			for (int d = 0; d < 3; ++d) {
+				code = (code << 1) | ((cell[d] >> bit) & 1UL);
+			}
+		}
+		keyed[i] = std::make_pair(code, i);
+	}
+	std::sort(keyed.begin(), keyed.end());
+	for (std::size_t i = 0; i < n; ++i) {
+		order[i] = keyed[i].second;
+	}
+	return order;
+}
+
+template<class Precision>
+inline std::vector<std::size_t> SoftBody<Precision>::_reverseCuthillMcKeeOrder() const {
+	const std::size_t n = nodeCount();
+
+	// Compressed adjacency from the springs
+	std::vector<std::size_t> start(n + 1, 0);
+	for (std::size_t s = 0; s < _net.a.size(); ++s) {
+		start[_net.a[s] + 1]++;
+		start[_net.b[s] + 1]++;
+	}
+	for (std::size_t i = 0; i < n; ++i) {
+		start[i + 1] += start[i];
+	}
+	std::vector<std::size_t> adj(start[n]);
+	std::vector<std::size_t> fill(start.begin(), start.end() - 1);
+	for (std::size_t s = 0; s < _net.a.size(); ++s) {
+		adj[fill[_net.a[s]]++] = _net.b[s];
+		adj[fill[_net.b[s]]++] = _net.a[s];
+	}
+
+	std::vector<std::pair<std::size_t, std::size_t> > byDegree(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		byDegree[i] = std::make_pair(start[i + 1] - start[i], i);
+	}
+	std::sort(byDegree.begin(), byDegree.end());
+
+	std::vector<std::size_t> order;
+	order.reserve(n);
+	std::vector<bool> visited(n, false);
+	std::vector<std::pair<std::size_t, std::size_t> > neighbors;
+	// Breadth-first from a minimum-degree node of each connected component,
+	// visiting neighbors in increasing degree order.
+	for (std::size_t seed = 0; seed < n; ++seed) {
+		const std::size_t root = byDegree[seed].second;
+		if (visited[root]) {
+			continue;
+		}
+		visited[root] = true;
+		std::size_t head = order.size();
+		order.push_back(root);
+		while (head < order.size()) {
+			const std::size_t node = order[head++];
+			neighbors.clear();
+			for (std::size_t k = start[node]; k < start[node + 1]; ++k) {
+				const std::size_t other = adj[k];
+				if (!visited[other]) {
+					visited[other] = true;
+					neighbors.push_back(std::make_pair(start[other + 1] - start[other], other));
+				}
+			}
+			std::sort(neighbors.begin(), neighbors.end());
+			for (std::size_t k = 0; k < neighbors.size(); ++k) {
+				order.push_back(neighbors[k].second);
+			}
+		}
+	}
+	std::reverse(order.begin(), order.end());
+	return order;
+}
+
+template<class Precision>
+inline void SoftBody<Precision>::_applyOrder(const std::vector<std::size_t> & order) {
+	// order[new] = old
+	_permute(_net.x, order);
+	_permute(_net.y, order);
+	_permute(_net.z, order);
+	_permute(_net.vx, order);
+	_permute(_net.vy, order);
+	_permute(_net.vz, order);
+	_permute(_net.invMass, order);
+	for (std::size_t i = 0; i < order.size(); ++i) {
+		_rank[order[i]] = i;
+	}
+
+	// Renumber springs, then sort them by (lower, upper) endpoint
+	const std::size_t m = _net.a.size();
+	std::vector<std::pair<std::pair<std::size_t, std::size_t>, std::size_t> > keyed(m);
+	for (std::size_t s = 0; s < m; ++s) {
+		const std::size_t a = _rank[_net.a[s]];
+		const std::size_t b = _rank[_net.b[s]];
+		keyed[s] = std::make_pair(std::make_pair(std::min(a, b), std::max(a, b)), s);
+	}
+	std::sort(keyed.begin(), keyed.end());
+	std::vector<std::size_t> springOrder(m);
+	for (std::size_t s = 0; s < m; ++s) {
+		_net.a[s] = keyed[s].first.first;
+		_net.b[s] = keyed[s].first.second;
+		springOrder[s] = keyed[s].second;
+	}
+	_permute(_net.rest, springOrder);
+	_permute(_net.K, springOrder);
+	_permute(_net.B, springOrder);
+}
+
+template<class Precision>
+inline std::size_t SoftBody<Precision>::springBandwidth() const {
+	std::size_t bw = 0;
+	for (std::size_t s = 0; s < _net.a.size(); ++s) {
+		bw = std::max(bw, _net.b[s] > _net.a[s] ? _net.b[s] - _net.a[s] : _net.a[s] - _net.b[s]);
+	}
+	return bw;
+}
+
+template<class Precision>
+inline void SoftBody<Precision>::setExternalForce(std::size_t node,
+		const force_t & fx, const force_t & fy, const force_t & fz) {
+	const std::size_t i = _rank[node];
+	std::size_t k = 0;
+	while (k < _external.size() && _external[k].node != i) {
+		++k;
+	}
+	if (k == _external.size()) {
+		_external.push_back(ExternalForce());
+		_external[k].node = i;
+	}
+	_external[k].f[0] = fx.value();
+	_external[k].f[1] = fy.value();
+	_external[k].f[2] = fz.value();
+}
+
+template<class Precision>
+inline void SoftBody<Precision>::accumulateForces() {
+	const std::size_t n = nodeCount();
+	for (std::size_t i = 0; i < n; ++i) {
+		const Precision m = _net.invMass[i] > 0 ? Precision(1) / _net.invMass[i] : Precision(0);
+		_fx[i] = m * _gx;
+		_fy[i] = m * _gy;
+		_fz[i] = m * _gz;
+	}
+	for (std::size_t k = 0; k < _external.size(); ++k) {
+		const std::size_t i = _external[k].node;
+		_fx[i] += _external[k].f[0];
+		_fy[i] += _external[k].f[1];
+		_fz[i] += _external[k].f[2];
+	}
+
+	accumulateSpringForces(_net, _fx.data(), _fy.data(), _fz.data());
+}
+
+template<class Precision>
+inline void SoftBody<Precision>::step(const time_t & dt) {
+	typedef std::chrono::steady_clock clock;
+	const clock::time_point t0 = clock::now();
+	accumulateForces();
+	const clock::time_point t1 = clock::now();
+
+	const Precision h = dt.value();
+	const std::size_t n = nodeCount();
+	for (std::size_t i = 0; i < n; ++i) {
+		const Precision hw = h * _net.invMass[i];
+		_net.vx[i] += hw * _fx[i];
+		_net.vy[i] += hw * _fy[i];
+		_net.vz[i] += hw * _fz[i];
+		if (_net.invMass[i] > 0) {
+			_net.x[i] += h * _net.vx[i];
+			_net.y[i] += h * _net.vy[i];
+			_net.z[i] += h * _net.vz[i];
+		}
+	}
+	const clock::time_point t2 = clock::now();
+
+	_timing.forces = time_t(std::chrono::duration<Precision>(t1 - t0).count());
+	_timing.integration = time_t(std::chrono::duration<Precision>(t2 - t1).count());
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_SOFTBODY_H_
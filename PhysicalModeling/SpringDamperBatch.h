@@ -0,0 +1,367 @@
+/** @file	SpringDamperBatch.h
+	@brief	header for simulating many independent spring-damper systems
+	at once, for parameter sweeps
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_SPRINGDAMPERBATCH_H_
+#define _PHYSICALMODELING_SPRINGDAMPERBATCH_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/LinearSpringDamper.h>
+#include <PhysicalModeling/SimdPack.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSpringDamperSystems Spring-Damper Systems
+	@{
+*/
+
+/** @brief One system of a sweep: a mass on a spring and damper, started
+	at a displacement and velocity, with a constant applied force.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct SpringDamperScenario {
+	typedef LinearSpringDamper<Precision> spring_damper_t;
+	typedef typename spring_damper_t::mass_t mass_t;
+	typedef typename spring_damper_t::stiffness_t stiffness_t;
+	typedef typename spring_damper_t::viscosity_t viscosity_t;
+	typedef typename spring_damper_t::length_t length_t;
+	typedef typename spring_damper_t::speed_t speed_t;
+	typedef typename spring_damper_t::force_t force_t;
+
+	SpringDamperScenario(const mass_t & m, const stiffness_t & K, const viscosity_t & B,
+			const length_t & x0 = length_t(), const speed_t & v0 = speed_t(), const force_t & F = force_t()) :
+			mass(m),
+			stiffness(K),
+			viscosity(B),
+			displacement(x0),
+			velocity(v0),
+			applied(F) {}
+
+	/// @brief Take the parameters of an existing spring-damper
+	SpringDamperScenario(const spring_damper_t & sd,
+			const length_t & x0 = length_t(), const speed_t & v0 = speed_t(), const force_t & F = force_t()) :
+			mass(sd.mass()),
+			stiffness(sd.stiffness()),
+			viscosity(sd.viscosity()),
+			displacement(x0),
+			velocity(v0),
+			applied(F) {}
+
+	mass_t mass;
+	stiffness_t stiffness;
+	viscosity_t viscosity;
+	/// @brief Initial displacement
+	length_t displacement;
+	/// @brief Initial velocity
+	speed_t velocity;
+	/// @brief Constant force applied to the mass, such as a step input
+	force_t applied;
+};
+
+/** @brief Summary of one simulated scenario.
+
+	Distances are measured from the equilibrium @f$ x_{eq} = F / K @f$.
+	Overshoot is the farthest the mass went past equilibrium, on the
+	side opposite where it started (opposite its initial velocity, if it
+	started at equilibrium); the overshoot ratio divides it by the initial
+	distance from equilibrium. The energies count kinetic energy and
+	spring energy about equilibrium, so the initial energy is their sum
+	up to integration error.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct SpringDamperMetrics {
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::length, Precision> length_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+	typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::energy, Precision> energy_t;
+
+	length_t overshoot;
+	/// @brief Overshoot over the initial distance from equilibrium, or 0 if that is 0
+	Precision overshootRatio;
+	/// @brief Largest distance from equilibrium
+	length_t peakDeviation;
+	/// @brief End of the last step outside the settling band, or 0 if never outside
+	time_t settlingTime;
+	/// @brief Energy taken out by the damper
+	energy_t dissipatedEnergy;
+	/// @brief Energy left at the end
+	energy_t finalEnergy;
+};
+
+namespace Internal {
+	/// @brief Structure-of-arrays view of a batch, one lane per scenario
+	template<class Precision>
+	struct SpringDamperLanes {
+		const Precision * mass;
+		const Precision * K;
+		const Precision * B;
+		const Precision * applied;
+		const Precision * x0;
+		const Precision * v0;
+		const Precision * equilibrium;
+		/// @brief +1 or -1: the side of equilibrium the scenario starts on
+		const Precision * side;
+		const Precision * band;
+		Precision * overshoot;
+		Precision * peak;
+		Precision * settling;
+		Precision * dissipated;
+		Precision * finalEnergy;
+	};
+
+	/** @brief Simulate lanes [first, first + k W) for the largest k that
+		fits in last, returning the first lane not handled.
+
+		Each block of W lanes is kept in registers for the whole run.
+	*/
+	template <int W, class Precision>
+	PHYSICALMODELING_SIMD_INLINE std::size_t springDamperBlocks(const SpringDamperLanes<Precision> & lanes,
+			std::size_t first, std::size_t last, std::size_t steps, Precision h) {
+		typedef Simd::Pack<Precision, W> pack_t;
+		const pack_t zero = pack_t::broadcast(Precision(0));
+		const pack_t half = pack_t::broadcast(Precision(0.5));
+		const pack_t dt = pack_t::broadcast(h);
+		std::size_t s = first;
+		for (; s + W <= last; s += W) {
+			const pack_t m = pack_t::load(lanes.mass + s);
+			const pack_t K = pack_t::load(lanes.K + s);
+			const pack_t B = pack_t::load(lanes.B + s);
+			const pack_t F = pack_t::load(lanes.applied + s);
+			const pack_t xeq = pack_t::load(lanes.equilibrium + s);
+			const pack_t side = pack_t::load(lanes.side + s);
+			const pack_t band = pack_t::load(lanes.band + s);
+			const pack_t hOverM = dt / m;
+			pack_t x = pack_t::load(lanes.x0 + s);
+			pack_t v = pack_t::load(lanes.v0 + s);
+			pack_t d = x - xeq;
+			pack_t peak = Simd::selectGreater(d, zero, d, zero - d);
+			pack_t overshoot = zero, settling = zero, dissipated = zero;
+			for (std::size_t k = 0; k < steps; ++k) {
+				v = v + hOverM * (F - (K * x + B * v));
+				x = x + dt * v;
+				d = x - xeq;
+				const pack_t past = zero - side * d;
+				overshoot = Simd::selectGreater(past, overshoot, past, overshoot);
+				const pack_t distance = Simd::selectGreater(d, zero, d, zero - d);
+				peak = Simd::selectGreater(distance, peak, distance, peak);
+				settling = Simd::selectGreater(distance, band, pack_t::broadcast(h * Precision(k + 1)), settling);
+				dissipated = dissipated + dt * B * v * v;
+			}
+			overshoot.store(lanes.overshoot + s);
+			peak.store(lanes.peak + s);
+			settling.store(lanes.settling + s);
+			dissipated.store(lanes.dissipated + s);
+			(half * (m * v * v + K * d * d)).store(lanes.finalEnergy + s);
+		}
+		return s;
+	}
+
+	/// @brief Arguments of springDamperBlocks, for Simd::forEachBlock
+	template <class Precision>
+	struct SpringDamperKernel {
+		const SpringDamperLanes<Precision> * lanes;
+		std::size_t steps;
+		Precision h;
+
+		template <int W>
+		PHYSICALMODELING_SIMD_INLINE std::size_t blocks(std::size_t first, std::size_t last) const {
+			return springDamperBlocks<W>(*lanes, first, last, steps, h);
+		}
+	};
+
+	/// @brief Simulate lanes [first, last) at the widest lane count available
+	template <class Precision>
+	inline void springDamperLanes(const SpringDamperLanes<Precision> & lanes,
+			std::size_t first, std::size_t last, std::size_t steps, Precision h) {
+		const SpringDamperKernel<Precision> kernel = { &lanes, steps, h };
+		Simd::forEachBlock<Precision>(kernel, first, last);
+	}
+} // end of Internal namespace
+
+/** @brief Many independent spring-damper scenarios, simulated together.
+
+	@code
+	PhysicalModeling::SpringDamperBatch<> sweep;
+	for (int k = 1; k <= 100; ++k) {
+		for (int b = 0; b < 100; ++b) {
+			sweep.add(PhysicalModeling::SpringDamperScenario<>(dq::SI::Kilograms(0.2),
+				dq::SI::NewtonsPerMeter(50 * k), dq::SI::NewtonSecondsPerMeter(0.1 * b),
+				dq::SI::Meters(0.01)));
+		}
+	}
+	sweep.run(dq::SI::Seconds(0.0001), dq::SI::Seconds(2));
+	dq::SI::Seconds settled = sweep.metrics(42).settlingTime;
+	@endcode
+
+	Scenarios are stored one per lane, one array per parameter, and
+	stepped W lanes at a time with Simd::Pack, where W is the widest
+	lane count available (at run time, with PHYSICALMODELING_SIMD_DISPATCH);
+	the lanes are also split among threads. Each step is the
+	semi-implicit Euler step SoftBody uses, with the force of
+	LinearSpringDamper::force() plus the applied force.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class SpringDamperBatch {
+	public:
+		typedef SpringDamperScenario<Precision> scenario_t;
+		typedef SpringDamperMetrics<Precision> metrics_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::length, Precision> length_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+
+		SpringDamperBatch() :
+				_bandFraction(Precision(0.02)),
+				_bandFloor(0) {}
+
+		/// @brief Add a scenario, returning its index
+		std::size_t add(const scenario_t & s);
+
+		std::size_t size() const { return _mass.size(); }
+
+		/** @brief Set the settling band: the larger of fraction of the
+			initial distance from equilibrium and floor. Defaults to 2%
+			and zero.
+		*/
+		void setSettlingBand(Precision fraction, const length_t & floor = length_t()) {
+			_bandFraction = fraction;
+			_bandFloor = floor.value();
+		}
+
+		/** @brief Simulate every scenario from its initial state for
+			duration, in steps of dt, on up to threads threads (by default,
+			one per hardware thread).
+		*/
+		void run(const time_t & dt, const time_t & duration, std::size_t threads = 0);
+
+		/// @brief Results of scenario i from the last run()
+		metrics_t metrics(std::size_t i) const;
+
+	private:
+		Internal::SpringDamperLanes<Precision> _lanes();
+
+		std::vector<Precision> _mass, _K, _B, _applied, _x0, _v0, _equilibrium, _side, _start, _band;
+		std::vector<Precision> _overshoot, _peak, _settling, _dissipated, _finalEnergy;
+		Precision _bandFraction;
+		Precision _bandFloor;
+};
+
+// -- inline implementations -- //
+
+template<class Precision>
+inline std::size_t SpringDamperBatch<Precision>::add(const scenario_t & s) {
+	const Precision K = s.stiffness.value();
+	const Precision xeq = K > 0 ? s.applied.value() / K : Precision(0);
+	const Precision offset = s.displacement.value() - xeq;
+	_mass.push_back(s.mass.value());
+	_K.push_back(K);
+	_B.push_back(s.viscosity.value());
+	_applied.push_back(s.applied.value());
+	_x0.push_back(s.displacement.value());
+	_v0.push_back(s.velocity.value());
+	_equilibrium.push_back(xeq);
+	_side.push_back(offset > 0 || (offset == 0 && s.velocity.value() > 0) ? Precision(1) : Precision(-1));
+	_start.push_back(std::fabs(offset));
+	return _mass.size() - 1;
+}
+
+template<class Precision>
+inline Internal::SpringDamperLanes<Precision> SpringDamperBatch<Precision>::_lanes() {
+	Internal::SpringDamperLanes<Precision> lanes;
+	lanes.mass = _mass.data();
+	lanes.K = _K.data();
+	lanes.B = _B.data();
+	lanes.applied = _applied.data();
+	lanes.x0 = _x0.data();
+	lanes.v0 = _v0.data();
+	lanes.equilibrium = _equilibrium.data();
+	lanes.side = _side.data();
+	lanes.band = _band.data();
+	lanes.overshoot = _overshoot.data();
+	lanes.peak = _peak.data();
+	lanes.settling = _settling.data();
+	lanes.dissipated = _dissipated.data();
+	lanes.finalEnergy = _finalEnergy.data();
+	return lanes;
+}
+
+template<class Precision>
+inline void SpringDamperBatch<Precision>::run(const time_t & dt, const time_t & duration, std::size_t threads) {
+	const std::size_t n = size();
+	_band.resize(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		_band[i] = std::max(_bandFraction * _start[i], _bandFloor);
+	}
+	_overshoot.resize(n);
+	_peak.resize(n);
+	_settling.resize(n);
+	_dissipated.resize(n);
+	_finalEnergy.resize(n);
+
+	const Precision h = dt.value();
+	const std::size_t steps = h > 0 ? std::size_t(duration.value() / h + Precision(0.5)) : 0;
+	const Internal::SpringDamperLanes<Precision> lanes = _lanes();
+
+	if (threads == 0) {
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+	// Whole blocks of the widest pack per thread, so only the last has a remainder
+	const std::size_t block = 64 / sizeof(Precision);
+	const std::size_t blocks = (n + block - 1) / block;
+	threads = std::max<std::size_t>(1, std::min(threads, blocks));
+	if (threads == 1) {
+		Internal::springDamperLanes(lanes, 0, n, steps, h);
+		return;
+	}
+	std::vector<std::thread> workers;
+	for (std::size_t t = 0; t < threads; ++t) {
+		const std::size_t first = std::min(n, blocks * t / threads * block);
+		const std::size_t last = std::min(n, blocks * (t + 1) / threads * block);
+		workers.push_back(std::thread([&lanes, first, last, steps, h] {
+			Internal::springDamperLanes(lanes, first, last, steps, h);
+		}));
+	}
+	for (std::size_t t = 0; t < workers.size(); ++t) {
+		workers[t].join();
+	}
+}
+
+template<class Precision>
+inline typename SpringDamperBatch<Precision>::metrics_t SpringDamperBatch<Precision>::metrics(std::size_t i) const {
+	metrics_t m;
+	m.overshoot = typename metrics_t::length_t(_overshoot[i]);
+	m.overshootRatio = _start[i] > 0 ? _overshoot[i] / _start[i] : Precision(0);
+	m.peakDeviation = typename metrics_t::length_t(_peak[i]);
+	m.settlingTime = typename metrics_t::time_t(_settling[i]);
+	m.dissipatedEnergy = typename metrics_t::energy_t(_dissipated[i]);
+	m.finalEnergy = typename metrics_t::energy_t(_finalEnergy[i]);
+	return m;
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_SPRINGDAMPERBATCH_H_
@@ -0,0 +1,145 @@
+/** @file	SpringForceKernel.h
+	@brief	header for the vectorized spring-damper force kernel shared by
+	the spring network solvers
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_SPRINGFORCEKERNEL_H_
+#define _PHYSICALMODELING_SPRINGFORCEKERNEL_H_
+
+// Internal Includes
+#include <PhysicalModeling/SpringNetwork.h>
+#include <PhysicalModeling/SimdPack.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <limits>
+#include <cstddef>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSoftBodies Soft Bodies
+	@{
+*/
+
+namespace Internal {
+	/** @brief Add the forces of springs [first, first + k W) to fx, fy,
+		fz, for the largest k that fits, returning the first spring not
+		handled.
+
+		Lengths, directions, and force magnitudes are computed W springs
+		at a time; the results are then added to the endpoints one spring
+		at a time, in order, since springs in a block may share nodes.
+	*/
+	template <int W, class Precision>
+	PHYSICALMODELING_SIMD_INLINE std::size_t springForceBlocks(const SpringNetwork<Precision> & net, std::size_t first,
+			const Precision * x, const Precision * y, const Precision * z,
+			const Precision * vx, const Precision * vy, const Precision * vz,
+			Precision * fx, Precision * fy, Precision * fz) {
+		typedef Simd::Pack<Precision, W> pack_t;
+		const pack_t tiny = pack_t::broadcast(std::numeric_limits<Precision>::min());
+		const pack_t one = pack_t::broadcast(Precision(1));
+		const pack_t zero = pack_t::broadcast(Precision(0));
+		const std::size_t springs = net.springCount();
+		Precision px[W], py[W], pz[W];
+		std::size_t s = first;
+		for (; s + W <= springs; s += W) {
+			const std::size_t * a = &net.a[s];
+			const std::size_t * b = &net.b[s];
+			const pack_t dx = pack_t::gather(x, b) - pack_t::gather(x, a);
+			const pack_t dy = pack_t::gather(y, b) - pack_t::gather(y, a);
+			const pack_t dz = pack_t::gather(z, b) - pack_t::gather(z, a);
+			const pack_t len = Simd::sqrt(dx * dx + dy * dy + dz * dz);
+			// Degenerate springs get a zero direction, and so no force
+			const pack_t inv = Simd::selectGreater(len, tiny, one / len, zero);
+			const pack_t ux = dx * inv, uy = dy * inv, uz = dz * inv;
+			const pack_t relVel = (pack_t::gather(vx, b) - pack_t::gather(vx, a)) * ux
+				+ (pack_t::gather(vy, b) - pack_t::gather(vy, a)) * uy
+				+ (pack_t::gather(vz, b) - pack_t::gather(vz, a)) * uz;
+			// Positive magnitude pulls the ends together
+			const pack_t f = pack_t::load(&net.K[s]) * (len - pack_t::load(&net.rest[s]))
+				+ pack_t::load(&net.B[s]) * relVel;
+			(f * ux).store(px);
+			(f * uy).store(py);
+			(f * uz).store(pz);
+			for (int i = 0; i < W; ++i) {
+				fx[a[i]] += px[i];
+				fy[a[i]] += py[i];
+				fz[a[i]] += pz[i];
+				fx[b[i]] -= px[i];
+				fy[b[i]] -= py[i];
+				fz[b[i]] -= pz[i];
+			}
+		}
+		return s;
+	}
+
+	/// @brief Arguments of springForceBlocks, for Simd::forEachBlock
+	template <class Precision>
+	struct SpringForceKernel {
+		const SpringNetwork<Precision> * net;
+		const Precision * x;
+		const Precision * y;
+		const Precision * z;
+		const Precision * vx;
+		const Precision * vy;
+		const Precision * vz;
+		Precision * fx;
+		Precision * fy;
+		Precision * fz;
+
+		template <int W>
+		PHYSICALMODELING_SIMD_INLINE std::size_t blocks(std::size_t first, std::size_t) const {
+			return springForceBlocks<W>(*net, first, x, y, z, vx, vy, vz, fx, fy, fz);
+		}
+	};
+} // end of Internal namespace
+
+/** @brief Add the spring-damper forces of every spring in net, evaluated
+	at positions x, y, z and velocities vx, vy, vz, to fx, fy, fz.
+
+	Each array is indexed by node. The force on a spring's first endpoint
+	is @f$ (K (\ell - \ell_0) + B \dot\ell) \hat u @f$, with @f$ \hat u @f$
+	pointing toward the second endpoint, and the second endpoint gets the
+	opposite; springs of zero length are skipped.
+
+	The lengths and force magnitudes are computed with Simd::Pack at the
+	widest lane count available: chosen at compile time, or at the first
+	call when built with PHYSICALMODELING_SIMD_DISPATCH.
+*/
+template <class Precision>
+inline void accumulateSpringForces(const SpringNetwork<Precision> & net,
+		const Precision * x, const Precision * y, const Precision * z,
+		const Precision * vx, const Precision * vy, const Precision * vz,
+		Precision * fx, Precision * fy, Precision * fz) {
+	const Internal::SpringForceKernel<Precision> kernel = { &net, x, y, z, vx, vy, vz, fx, fy, fz };
+	Simd::forEachBlock<Precision>(kernel, 0, net.springCount());
+}
+
+/// @brief Add the forces of every spring in net, at its own state, to fx, fy, fz
+template <class Precision>
+inline void accumulateSpringForces(const SpringNetwork<Precision> & net,
+		Precision * fx, Precision * fy, Precision * fz) {
+	accumulateSpringForces(net, net.x.data(), net.y.data(), net.z.data(),
+		net.vx.data(), net.vy.data(), net.vz.data(), fx, fy, fz);
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_SPRINGFORCEKERNEL_H_
@@ -0,0 +1,88 @@
+/** @file	SpringNetwork.h
+	@brief	header for the shared structure-of-arrays spring network storage
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_SPRINGNETWORK_H_
+#define _PHYSICALMODELING_SPRINGNETWORK_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <cstddef>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSoftBodies Soft Bodies
+	@{
+*/
+
+/** @brief Point masses connected by linear spring-dampers, stored as one
+	array per component.
+
+	This is the state shared by the soft-body solvers: SoftBody owns one,
+	and alternative solvers operate on it in place. Values are in SI
+	units; dimension checking happens at the API boundary of the classes
+	that own or step the network.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct SpringNetwork {
+	typedef Precision value_type;
+
+	std::size_t nodeCount() const { return invMass.size(); }
+	std::size_t springCount() const { return a.size(); }
+
+	/// @brief Resize the node arrays, zeroing new entries
+	void resizeNodes(std::size_t n) {
+		x.resize(n);
+		y.resize(n);
+		z.resize(n);
+		vx.resize(n);
+		vy.resize(n);
+		vz.resize(n);
+		invMass.resize(n);
+	}
+
+	/// @name Node data
+	/// @{
+	std::vector<Precision> x, y, z;
+	std::vector<Precision> vx, vy, vz;
+	/// @brief Inverse mass: zero for pinned nodes
+	std::vector<Precision> invMass;
+	/// @}
+
+	/// @name Spring data
+	/// @{
+
+	/// @brief Spring endpoints, with a[s] < b[s]
+	std::vector<std::size_t> a, b;
+	std::vector<Precision> rest;
+	/// @brief Stiffness, in N/m
+	std::vector<Precision> K;
+	/// @brief Damping coefficient, in N s/m
+	std::vector<Precision> B;
+	/// @}
+};
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_SPRINGNETWORK_H_
@@ -0,0 +1,436 @@
+/** @file	SpringNetworkMatrix.h
+	@brief	header for block-sparse matrices assembled from spring networks,
+	and a preconditioned conjugate gradient solver for them
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_SPRINGNETWORKMATRIX_H_
+#define _PHYSICALMODELING_SPRINGNETWORKMATRIX_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/SpringNetwork.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+#include <cmath>
+
+namespace PhysicalModeling {
+
+/** @defgroup gSparseSolvers Sparse Solvers
+	@brief Matrices and iterative solvers for implicit integration of
+	spring networks.
+
+	Matrices are stored in compressed-row form with dense 3x3 blocks, one
+	block row and column per node. Vectors are plain std::vector with the
+	x, y, and z components of each node stored consecutively.
+	@{
+*/
+
+/** @cond innerworkings
+	@{
+*/
+/// @brief Internal workings for small dense block operations
+namespace Internal {
+	/// @brief c += a * b for row-major 3x3 blocks
+	template<class Precision>
+	inline void blockMultiplyAdd(const Precision * a, const Precision * b, Precision * c) {
+		for (int r = 0; r < 3; ++r) {
+			for (int k = 0; k < 3; ++k) {
+				const Precision ark = a[3 * r + k];
+				c[3 * r] += ark * b[3 * k];
+				c[3 * r + 1] += ark * b[3 * k + 1];
+				c[3 * r + 2] += ark * b[3 * k + 2];
+			}
+		}
+	}
+
+	/// @brief y += a * x for a row-major 3x3 block
+	template<class Precision>
+	inline void blockApplyAdd(const Precision * a, const Precision * x, Precision * y) {
+		y[0] += a[0] * x[0] + a[1] * x[1] + a[2] * x[2];
+		y[1] += a[3] * x[0] + a[4] * x[1] + a[5] * x[2];
+		y[2] += a[6] * x[0] + a[7] * x[1] + a[8] * x[2];
+	}
+
+	/// @brief Inverse of a 3x3 block by cofactors. Returns false if singular.
+	template<class Precision>
+	inline bool blockInverse(const Precision * a, Precision * inv) {
+		inv[0] = a[4] * a[8] - a[5] * a[7];
+		inv[1] = a[2] * a[7] - a[1] * a[8];
+		inv[2] = a[1] * a[5] - a[2] * a[4];
+		inv[3] = a[5] * a[6] - a[3] * a[8];
+		inv[4] = a[0] * a[8] - a[2] * a[6];
+		inv[5] = a[2] * a[3] - a[0] * a[5];
+		inv[6] = a[3] * a[7] - a[4] * a[6];
+		inv[7] = a[1] * a[6] - a[0] * a[7];
+		inv[8] = a[0] * a[4] - a[1] * a[3];
+		const Precision det = a[0] * inv[0] + a[1] * inv[3] + a[2] * inv[6];
+		if (std::fabs(det) <= std::numeric_limits<Precision>::min()) {
+			return false;
+		}
+		const Precision invDet = Precision(1) / det;
+		for (int k = 0; k < 9; ++k) {
+			inv[k] *= invDet;
+		}
+		return true;
+	}
+
+	template<class Precision>
+	inline Precision dot(const std::vector<Precision> & a, const std::vector<Precision> & b) {
+		Precision sum = 0;
+		const std::size_t n = a.size();
+		for (std::size_t i = 0; i < n; ++i) {
+			sum += a[i] * b[i];
+		}
+		return sum;
+	}
+} // end of Internal namespace
+/**
+	@}
+	@endcond
+*/
+
+/// @brief Sparse matrix of dense 3x3 blocks in compressed-row form
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct BlockSparseMatrix {
+	BlockSparseMatrix() : rows(0), cols(0), rowStart(1, 0) {}
+
+	/// @brief Number of block rows and columns
+	std::size_t rows;
+	std::size_t cols;
+
+	/// @brief Offset of each block row's first block, plus the end
+	std::vector<std::size_t> rowStart;
+	/// @brief Block column of each block, sorted within each row
+	std::vector<std::size_t> col;
+	/// @brief Nine row-major values per block
+	std::vector<Precision> val;
+
+	std::size_t blockCount() const { return col.size(); }
+
+	/// @brief Locate block (r, c), or return blockCount() if not stored
+	std::size_t find(std::size_t r, std::size_t c) const {
+		const std::vector<std::size_t>::const_iterator begin = col.begin() + rowStart[r];
+		const std::vector<std::size_t>::const_iterator end = col.begin() + rowStart[r + 1];
+		const std::vector<std::size_t>::const_iterator it = std::lower_bound(begin, end, c);
+		return (it != end && *it == c) ? static_cast<std::size_t>(it - col.begin()) : blockCount();
+	}
+
+	/// @brief y = A x
+	void multiply(const std::vector<Precision> & x, std::vector<Precision> & y) const {
+		y.resize(3 * rows);
+		for (std::size_t r = 0; r < rows; ++r) {
+			Precision * yr = &y[3 * r];
+			yr[0] = yr[1] = yr[2] = 0;
+			for (std::size_t k = rowStart[r]; k < rowStart[r + 1]; ++k) {
+				Internal::blockApplyAdd(&val[9 * k], &x[3 * col[k]], yr);
+			}
+		}
+	}
+
+	/// @brief Build the structure from a list of (row, column) block
+	/// positions, which need not be sorted or unique. Values are zeroed.
+	void setPattern(std::size_t nRows, std::size_t nCols, std::vector<std::pair<std::size_t, std::size_t> > & entries) {
+		std::sort(entries.begin(), entries.end());
+		entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+		rows = nRows;
+		cols = nCols;
+		rowStart.assign(rows + 1, 0);
+		col.resize(entries.size());
+		for (std::size_t k = 0; k < entries.size(); ++k) {
+			rowStart[entries[k].first + 1]++;
+			col[k] = entries[k].second;
+		}
+		for (std::size_t r = 0; r < rows; ++r) {
+			rowStart[r + 1] += rowStart[r];
+		}
+		val.assign(9 * col.size(), Precision(0));
+	}
+};
+
+/// @brief At = A^T
+template<class Precision>
+void transpose(const BlockSparseMatrix<Precision> & A, BlockSparseMatrix<Precision> & At) {
+	At.rows = A.cols;
+	At.cols = A.rows;
+	At.rowStart.assign(At.rows + 1, 0);
+	for (std::size_t k = 0; k < A.blockCount(); ++k) {
+		At.rowStart[A.col[k] + 1]++;
+	}
+	for (std::size_t r = 0; r < At.rows; ++r) {
+		At.rowStart[r + 1] += At.rowStart[r];
+	}
+	At.col.resize(A.blockCount());
+	At.val.resize(A.val.size());
+	std::vector<std::size_t> fill(At.rowStart.begin(), At.rowStart.end() - 1);
+	// Visiting A's rows in order keeps each row of At sorted
+	for (std::size_t r = 0; r < A.rows; ++r) {
+		for (std::size_t k = A.rowStart[r]; k < A.rowStart[r + 1]; ++k) {
+			const std::size_t dest = fill[A.col[k]]++;
+			At.col[dest] = r;
+			const Precision * a = &A.val[9 * k];
+			Precision * t = &At.val[9 * dest];
+			for (int i = 0; i < 3; ++i) {
+				for (int j = 0; j < 3; ++j) {
+					t[3 * i + j] = a[3 * j + i];
+				}
+			}
+		}
+	}
+}
+
+/// @brief C = A B
+template<class Precision>
+void multiply(const BlockSparseMatrix<Precision> & A, const BlockSparseMatrix<Precision> & B, BlockSparseMatrix<Precision> & C) {
+	C.rows = A.rows;
+	C.cols = B.cols;
+	C.rowStart.assign(C.rows + 1, 0);
+	C.col.clear();
+	C.val.clear();
+
+	std::vector<std::size_t> slot(B.cols, std::numeric_limits<std::size_t>::max());
+	std::vector<std::size_t> rowCols;
+	std::vector<Precision> rowVals;
+	std::vector<std::pair<std::size_t, std::size_t> > sorted;
+	for (std::size_t r = 0; r < A.rows; ++r) {
+		rowCols.clear();
+		rowVals.clear();
+		for (std::size_t ka = A.rowStart[r]; ka < A.rowStart[r + 1]; ++ka) {
+			const std::size_t mid = A.col[ka];
+			for (std::size_t kb = B.rowStart[mid]; kb < B.rowStart[mid + 1]; ++kb) {
+				const std::size_t c = B.col[kb];
+				if (slot[c] == std::numeric_limits<std::size_t>::max()) {
+					slot[c] = rowCols.size();
+					rowCols.push_back(c);
+					rowVals.resize(rowVals.size() + 9, Precision(0));
+				}
+				Internal::blockMultiplyAdd(&A.val[9 * ka], &B.val[9 * kb], &rowVals[9 * slot[c]]);
+			}
+		}
+		sorted.resize(rowCols.size());
+		for (std::size_t k = 0; k < rowCols.size(); ++k) {
+			sorted[k] = std::make_pair(rowCols[k], k);
+			slot[rowCols[k]] = std::numeric_limits<std::size_t>::max();
+		}
+		std::sort(sorted.begin(), sorted.end());
+		for (std::size_t k = 0; k < sorted.size(); ++k) {
+			C.col.push_back(sorted[k].first);
+			C.val.insert(C.val.end(), rowVals.begin() + 9 * sorted[k].second, rowVals.begin() + 9 * sorted[k].second + 9);
+		}
+		C.rowStart[r + 1] = C.col.size();
+	}
+}
+
+/** @brief Assemble the linearized system matrix of a spring network:
+	@f[ A = \mathrm{massCoefficient} \cdot M
+		+ \sum_{springs} (\mathrm{dampingCoefficient} \cdot B
+		+ \mathrm{stiffnessCoefficient} \cdot K) \, n n^T \otimes L @f]
+	where n is each spring's current direction and L its graph Laplacian.
+
+	For a backward Euler step of size h, use coefficients (1, h, h^2).
+	The transverse (geometric) stiffness term is omitted, which keeps the
+	matrix symmetric positive definite. Pinned nodes get identity rows and
+	columns, so solutions leave them unchanged.
+*/
+template<class Precision>
+void assembleSpringSystem(const SpringNetwork<Precision> & net,
+		Precision massCoefficient,
+		Precision dampingCoefficient,
+		Precision stiffnessCoefficient,
+		BlockSparseMatrix<Precision> & A) {
+	const std::size_t n = net.nodeCount();
+	const std::size_t m = net.springCount();
+
+	std::vector<std::pair<std::size_t, std::size_t> > entries;
+	entries.reserve(n + 2 * m);
+	for (std::size_t i = 0; i < n; ++i) {
+		entries.push_back(std::make_pair(i, i));
+	}
+	for (std::size_t s = 0; s < m; ++s) {
+		if (net.invMass[net.a[s]] > 0 && net.invMass[net.b[s]] > 0) {
+			entries.push_back(std::make_pair(net.a[s], net.b[s]));
+			entries.push_back(std::make_pair(net.b[s], net.a[s]));
+		}
+	}
+	A.setPattern(n, n, entries);
+
+	for (std::size_t i = 0; i < n; ++i) {
+		Precision * d = &A.val[9 * A.find(i, i)];
+		const Precision diag = net.invMass[i] > 0 ? massCoefficient / net.invMass[i] : Precision(1);
+		d[0] = d[4] = d[8] = diag;
+	}
+
+	for (std::size_t s = 0; s < m; ++s) {
+		const std::size_t a = net.a[s];
+		const std::size_t b = net.b[s];
+		const bool freeA = net.invMass[a] > 0;
+		const bool freeB = net.invMass[b] > 0;
+		const Precision dx = net.x[b] - net.x[a];
+		const Precision dy = net.y[b] - net.y[a];
+		const Precision dz = net.z[b] - net.z[a];
+		const Precision len = std::sqrt(dx * dx + dy * dy + dz * dz);
+		if (len <= std::numeric_limits<Precision>::min()) {
+			continue;
+		}
+		const Precision dir[3] = {dx / len, dy / len, dz / len};
+		const Precision k = dampingCoefficient * net.B[s] + stiffnessCoefficient * net.K[s];
+		Precision block[9];
+		for (int r = 0; r < 3; ++r) {
+			for (int c = 0; c < 3; ++c) {
+				block[3 * r + c] = k * dir[r] * dir[c];
+			}
+		}
+		Precision * aa = freeA ? &A.val[9 * A.find(a, a)] : 0;
+		Precision * bb = freeB ? &A.val[9 * A.find(b, b)] : 0;
+		Precision * ab = (freeA && freeB) ? &A.val[9 * A.find(a, b)] : 0;
+		Precision * ba = (freeA && freeB) ? &A.val[9 * A.find(b, a)] : 0;
+		for (int k9 = 0; k9 < 9; ++k9) {
+			if (aa) {
+				aa[k9] += block[k9];
+			}
+			if (bb) {
+				bb[k9] += block[k9];
+			}
+			if (ab) {
+				ab[k9] -= block[k9];
+				ba[k9] -= block[k9];
+			}
+		}
+	}
+}
+
+/// @brief Preconditioner that does nothing, for comparison
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct IdentityPreconditioner {
+	void setup(const BlockSparseMatrix<Precision> &) {}
+	void update(const BlockSparseMatrix<Precision> &) {}
+	void apply(const std::vector<Precision> & r, std::vector<Precision> & z) {
+		z = r;
+	}
+};
+
+/// @brief Preconditioner applying the inverse of each 3x3 diagonal block
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class BlockJacobiPreconditioner {
+	public:
+		void setup(const BlockSparseMatrix<Precision> & A) {
+			_inv.assign(9 * A.rows, Precision(0));
+			for (std::size_t i = 0; i < A.rows; ++i) {
+				const std::size_t k = A.find(i, i);
+				Precision * inv = &_inv[9 * i];
+				if (k == A.blockCount() || !Internal::blockInverse(&A.val[9 * k], inv)) {
+					inv[0] = inv[4] = inv[8] = 1;
+				}
+			}
+		}
+
+		void update(const BlockSparseMatrix<Precision> & A) {
+			setup(A);
+		}
+
+		void apply(const std::vector<Precision> & r, std::vector<Precision> & z) {
+			const std::size_t n = _inv.size() / 9;
+			z.resize(3 * n);
+			for (std::size_t i = 0; i < n; ++i) {
+				Precision * zi = &z[3 * i];
+				zi[0] = zi[1] = zi[2] = 0;
+				Internal::blockApplyAdd(&_inv[9 * i], &r[3 * i], zi);
+			}
+		}
+
+	private:
+		std::vector<Precision> _inv;
+};
+
+/// @brief Scratch vectors for conjugateGradient(), reused between solves
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+struct ConjugateGradientWorkspace {
+	std::vector<Precision> r, z, p, Ap;
+};
+
+/** @brief Solve A x = b by preconditioned conjugate gradients.
+
+	x holds the initial guess on entry and the solution on return.
+	Iteration stops once the residual norm falls to relativeTolerance
+	times the norm of b.
+
+	@returns the number of iterations performed
+*/
+template<class Precision, class Preconditioner>
+std::size_t conjugateGradient(const BlockSparseMatrix<Precision> & A,
+		const std::vector<Precision> & b,
+		std::vector<Precision> & x,
+		Preconditioner & preconditioner,
+		Precision relativeTolerance,
+		std::size_t maxIterations,
+		ConjugateGradientWorkspace<Precision> & ws) {
+	const std::size_t n = b.size();
+	x.resize(n);
+	ws.r.resize(n);
+	ws.p.resize(n);
+
+	A.multiply(x, ws.Ap);
+	for (std::size_t i = 0; i < n; ++i) {
+		ws.r[i] = b[i] - ws.Ap[i];
+	}
+	const Precision bNorm = std::sqrt(Internal::dot(b, b));
+	const Precision threshold = relativeTolerance * (bNorm > 0 ? bNorm : Precision(1));
+	if (std::sqrt(Internal::dot(ws.r, ws.r)) <= threshold) {
+		return 0;
+	}
+
+	preconditioner.apply(ws.r, ws.z);
+	ws.p = ws.z;
+	Precision rz = Internal::dot(ws.r, ws.z);
+	std::size_t it = 0;
+	while (it < maxIterations) {
+		++it;
+		A.multiply(ws.p, ws.Ap);
+		const Precision pAp = Internal::dot(ws.p, ws.Ap);
+		if (pAp <= 0) {
+			break;
+		}
+		const Precision alpha = rz / pAp;
+		for (std::size_t i = 0; i < n; ++i) {
+			x[i] += alpha * ws.p[i];
+			ws.r[i] -= alpha * ws.Ap[i];
+		}
+		if (std::sqrt(Internal::dot(ws.r, ws.r)) <= threshold) {
+			break;
+		}
+		preconditioner.apply(ws.r, ws.z);
+		const Precision rzNew = Internal::dot(ws.r, ws.z);
+		const Precision beta = rzNew / rz;
+		rz = rzNew;
+		for (std::size_t i = 0; i < n; ++i) {
+			ws.p[i] = ws.z[i] + beta * ws.p[i];
+		}
+	}
+	return it;
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_SPRINGNETWORKMATRIX_H_
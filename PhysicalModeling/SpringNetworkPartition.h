@@ -0,0 +1,522 @@
+/** @file	SpringNetworkPartition.h
+	@brief	header for stepping a spring network as locality-based
+	partitions, one thread per partition, with NUMA-local storage
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_SPRINGNETWORKPARTITION_H_
+#define _PHYSICALMODELING_SPRINGNETWORKPARTITION_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/SpringNetwork.h>
+#include <PhysicalModeling/SpringForceKernel.h>
+#include <PhysicalModeling/StepBarrier.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <algorithm>
+#include <utility>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdlib>
+#include <cstddef>
+
+#if defined(__linux__)
+#	include <pthread.h>
+#	include <sched.h>
+#endif
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSoftBodies Soft Bodies
+	@{
+*/
+
+namespace Internal {
+	/// @brief Parse a Linux cpulist such as "0-3,8-11"
+	inline std::vector<int> parseCpuList(const std::string & list) {
+		std::vector<int> cpus;
+		std::istringstream in(list);
+		std::string range;
+		while (std::getline(in, range, ',')) {
+			const std::size_t dash = range.find('-');
+			const int first = std::atoi(range.c_str());
+			const int last = dash == std::string::npos ? first : std::atoi(range.c_str() + dash + 1);
+			for (int c = first; c <= last && !range.empty(); ++c) {
+				cpus.push_back(c);
+			}
+		}
+		return cpus;
+	}
+
+	/** @brief CPUs of each NUMA node, read from sysfs; empty where the
+		topology is unavailable.
+	*/
+	inline std::vector<std::vector<int> > numaNodeCpus() {
+		std::vector<std::vector<int> > nodes;
+#if defined(__linux__)
+		for (int n = 0; ; ++n) {
+			std::ostringstream path;
+			path << "/sys/devices/system/node/node" << n << "/cpulist";
+			std::ifstream file(path.str().c_str());
+			std::string list;
+			if (!file || !std::getline(file, list)) {
+				break;
+			}
+			nodes.push_back(parseCpuList(list));
+		}
+#endif
+		return nodes;
+	}
+
+	/// @brief Restrict the calling thread to cpus; returns false if not supported
+	inline bool pinCurrentThread(const std::vector<int> & cpus) {
+#if defined(__linux__)
+		if (cpus.empty()) {
+			return false;
+		}
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		for (std::size_t i = 0; i < cpus.size(); ++i) {
+			if (cpus[i] >= 0 && cpus[i] < CPU_SETSIZE) {
+				CPU_SET(cpus[i], &set);
+			}
+		}
+		return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+		(void)cpus;
+		return false;
+#endif
+	}
+} // end of Internal namespace
+
+/** @brief Order nodes for graph locality: breadth-first (Cuthill-McKee)
+	from a lowest-degree node of each connected component, visiting
+	neighbors in order of increasing degree.
+
+	Consecutive runs of the result are compact, connected regions of the
+	network, so cutting it into runs cuts few springs.
+*/
+template<class Precision>
+inline std::vector<std::size_t> localityOrder(const SpringNetwork<Precision> & net) {
+	const std::size_t n = net.nodeCount();
+	std::vector<std::vector<std::size_t> > adjacent(n);
+	for (std::size_t s = 0; s < net.springCount(); ++s) {
+		adjacent[net.a[s]].push_back(net.b[s]);
+		adjacent[net.b[s]].push_back(net.a[s]);
+	}
+	std::vector<std::size_t> byDegree(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		byDegree[i] = i;
+		std::sort(adjacent[i].begin(), adjacent[i].end());
+		adjacent[i].erase(std::unique(adjacent[i].begin(), adjacent[i].end()), adjacent[i].end());
+	}
+	const auto fewerNeighbors = [&](std::size_t l, std::size_t r) {
+		return adjacent[l].size() < adjacent[r].size();
+	};
+	std::stable_sort(byDegree.begin(), byDegree.end(), fewerNeighbors);
+	for (std::size_t i = 0; i < n; ++i) {
+		std::stable_sort(adjacent[i].begin(), adjacent[i].end(), fewerNeighbors);
+	}
+
+	std::vector<std::size_t> order;
+	order.reserve(n);
+	std::vector<bool> visited(n, false);
+	for (std::size_t k = 0; k < n; ++k) {
+		const std::size_t root = byDegree[k];
+		if (visited[root]) {
+			continue;
+		}
+		visited[root] = true;
+		std::deque<std::size_t> queue(1, root);
+		while (!queue.empty()) {
+			const std::size_t i = queue.front();
+			queue.pop_front();
+			order.push_back(i);
+			for (std::size_t j = 0; j < adjacent[i].size(); ++j) {
+				if (!visited[adjacent[i][j]]) {
+					visited[adjacent[i][j]] = true;
+					queue.push_back(adjacent[i][j]);
+				}
+			}
+		}
+	}
+	return order;
+}
+
+/** @brief Split a network into parts of compact, connected regions: the
+	part of each node.
+
+	The localityOrder() is cut into parts consecutive runs of about equal
+	work, counting each node once plus once per spring attached to it.
+	Every part gets at least one node while there are enough nodes.
+*/
+template<class Precision>
+inline std::vector<std::size_t> partitionByLocality(const SpringNetwork<Precision> & net, std::size_t parts) {
+	const std::size_t n = net.nodeCount();
+	parts = std::max<std::size_t>(1, std::min(parts, n));
+	std::vector<std::size_t> work(n, 1);
+	for (std::size_t s = 0; s < net.springCount(); ++s) {
+		++work[net.a[s]];
+		++work[net.b[s]];
+	}
+	std::size_t total = 0;
+	for (std::size_t i = 0; i < n; ++i) {
+		total += work[i];
+	}
+
+	const std::vector<std::size_t> order = localityOrder(net);
+	std::vector<std::size_t> part(n, 0);
+	std::size_t p = 0, done = 0;
+	for (std::size_t k = 0; k < n; ++k) {
+		// Move on once this part has its share, keeping a node for each later part
+		if (p + 1 < parts && k > 0
+				&& (done * parts >= (p + 1) * total || n - k <= parts - 1 - p)) {
+			++p;
+		}
+		part[order[k]] = p;
+		done += work[order[k]];
+	}
+	return part;
+}
+
+/** @brief A spring network stepped in parallel as partitions, one thread
+	per partition, with each partition's data local to its thread's NUMA
+	node.
+
+	Nodes are split with partitionByLocality(). Each partition owns a
+	SpringNetwork holding its own nodes, then copies (ghosts) of the
+	other partitions' nodes that its springs reach, and every spring
+	touching one of its own nodes. Springs cut by the partitioning are
+	evaluated by both sides, each keeping only the force on its own end,
+	so no partition writes another's memory.
+
+	A step is the same semi-implicit Euler step as SoftBody::step:
+	 - each thread computes forces on its own nodes and integrates them,
+	 - after a barrier, each thread copies its ghosts from their owners,
+	 - after another barrier, the next step starts.
+
+	Every partition's storage is allocated and first written by the
+	thread that steps it, after that thread is bound to its NUMA node, so
+	on first-touch systems (Linux, Windows) the pages land on that node
+	and memory bandwidth scales with the sockets used. Partitions are
+	spread over the NUMA nodes in consecutive blocks, so most ghost
+	copies stay within a socket. The topology comes from sysfs on Linux;
+	elsewhere, or with pinning off, threads are left to the scheduler.
+
+	Results match stepping the whole network with SoftBody up to the
+	rounding of summing forces in a different order. Each call to step()
+	starts and joins the threads, so step many time steps per call.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class PartitionedSpringNetwork {
+	public:
+		typedef SpringNetwork<Precision> network_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::accel, Precision> accel_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+
+		/** @brief Partition net into (up to) parts pieces.
+
+			With pinThreads, each partition's threads are bound to the CPUs
+			of its NUMA node.
+		*/
+		PartitionedSpringNetwork(const network_t & net, std::size_t parts, bool pinThreads = true);
+
+		std::size_t partitionCount() const { return _parts.size(); }
+		std::size_t nodeCount() const { return _owner.size(); }
+
+		/// @brief Partition owning a node
+		std::size_t owner(std::size_t node) const { return _owner[node]; }
+		/// @brief Nodes owned by partition p
+		std::size_t ownedCount(std::size_t p) const { return _parts[p]->owned; }
+		/// @brief Copies of other partitions' nodes kept by partition p
+		std::size_t ghostCount(std::size_t p) const { return _parts[p]->net.nodeCount() - _parts[p]->owned; }
+		/// @brief Springs evaluated by partition p, including cut springs
+		std::size_t springCount(std::size_t p) const { return _parts[p]->net.springCount(); }
+		/// @brief NUMA node partition p's thread runs on, or 0 without topology
+		std::size_t numaNode(std::size_t p) const { return _numaNode[p]; }
+		/// @brief Number of NUMA nodes found, or 0 without topology
+		std::size_t numaNodeCount() const { return _numaCpus.size(); }
+
+		/// @brief Set the uniform gravitational acceleration
+		void setGravity(const accel_t & gx, const accel_t & gy, const accel_t & gz) {
+			_g[0] = gx.value();
+			_g[1] = gy.value();
+			_g[2] = gz.value();
+		}
+
+		/// @brief Advance steps time steps of length dt
+		void step(const time_t & dt, std::size_t steps = 1);
+
+		/// @brief Write the state of every node into net, by node index
+		void gather(network_t & net) const;
+
+	private:
+		struct Ghost {
+			std::size_t owner;
+			std::size_t index;
+		};
+
+		struct Partition {
+			/// @brief Nodes [0, owned) are owned, the rest are ghosts
+			network_t net;
+			std::size_t owned;
+			std::vector<Ghost> ghosts;
+			std::vector<std::size_t> globalIndex;
+			std::vector<Precision> fx, fy, fz;
+		};
+
+		template<class Function>
+		void _runPartitions(Function f);
+		void _build(std::size_t p, const network_t & net);
+		void _stepForces(Partition & part, Precision h);
+		void _exchange(Partition & part);
+
+		std::vector<std::size_t> _owner;
+		/// @brief Index of each node within its owning partition
+		std::vector<std::size_t> _localIndex;
+		std::vector<std::unique_ptr<Partition> > _parts;
+		std::vector<std::vector<int> > _numaCpus;
+		std::vector<std::size_t> _numaNode;
+		bool _pin;
+		Precision _g[3];
+};
+
+// -- inline implementations -- //
+
+template<class Precision>
+inline PartitionedSpringNetwork<Precision>::PartitionedSpringNetwork(const network_t & net, std::size_t parts, bool pinThreads) :
+		_owner(partitionByLocality(net, parts)),
+		_localIndex(net.nodeCount()),
+		_pin(pinThreads) {
+	_g[0] = _g[1] = _g[2] = 0;
+	std::size_t count = 0;
+	for (std::size_t i = 0; i < _owner.size(); ++i) {
+		count = std::max(count, _owner[i] + 1);
+	}
+	// Owned nodes keep the locality order within each partition
+	std::vector<std::size_t> filled(count, 0);
+	const std::vector<std::size_t> order = localityOrder(net);
+	for (std::size_t k = 0; k < order.size(); ++k) {
+		_localIndex[order[k]] = filled[_owner[order[k]]]++;
+	}
+
+	_parts.resize(count);
+	if (_pin) {
+		_numaCpus = Internal::numaNodeCpus();
+	}
+	_numaNode.resize(count, 0);
+	for (std::size_t p = 0; p < count && !_numaCpus.empty(); ++p) {
+		_numaNode[p] = p * _numaCpus.size() / count;
+	}
+
+	_runPartitions([&](std::size_t p) { _build(p, net); });
+}
+
+template<class Precision>
+template<class Function>
+inline void PartitionedSpringNetwork<Precision>::_runPartitions(Function f) {
+	std::vector<std::thread> threads;
+	threads.reserve(_parts.size());
+	for (std::size_t p = 0; p < _parts.size(); ++p) {
+		threads.push_back(std::thread([this, p, &f] {
+			if (_pin && !_numaCpus.empty()) {
+				Internal::pinCurrentThread(_numaCpus[_numaNode[p]]);
+			}
+			f(p);
+		}));
+	}
+	for (std::size_t p = 0; p < threads.size(); ++p) {
+		threads[p].join();
+	}
+}
+
+template<class Precision>
+inline void PartitionedSpringNetwork<Precision>::_build(std::size_t p, const network_t & net) {
+	// Allocated and filled here, on the partition's own thread, for first-touch placement
+	std::unique_ptr<Partition> part(new Partition);
+	const std::size_t n = net.nodeCount();
+
+	std::size_t owned = 0;
+	std::vector<std::size_t> springs;
+	std::vector<Ghost> ghosts;
+	for (std::size_t i = 0; i < n; ++i) {
+		owned += _owner[i] == p;
+	}
+	for (std::size_t s = 0; s < net.springCount(); ++s) {
+		const std::size_t a = net.a[s], b = net.b[s];
+		if (_owner[a] != p && _owner[b] != p) {
+			continue;
+		}
+		springs.push_back(s);
+		if (_owner[a] != p) {
+			const Ghost g = {_owner[a], _localIndex[a]};
+			ghosts.push_back(g);
+		}
+		if (_owner[b] != p) {
+			const Ghost g = {_owner[b], _localIndex[b]};
+			ghosts.push_back(g);
+		}
+	}
+	// Ghosts sorted by owner, so the exchange reads each owner sequentially
+	const auto ghostLess = [](const Ghost & l, const Ghost & r) {
+		return l.owner < r.owner || (l.owner == r.owner && l.index < r.index);
+	};
+	std::sort(ghosts.begin(), ghosts.end(), ghostLess);
+	ghosts.erase(std::unique(ghosts.begin(), ghosts.end(), [](const Ghost & l, const Ghost & r) {
+		return l.owner == r.owner && l.index == r.index;
+	}), ghosts.end());
+
+	network_t & local = part->net;
+	part->owned = owned;
+	part->ghosts = ghosts;
+	local.resizeNodes(owned + ghosts.size());
+	part->globalIndex.resize(owned + ghosts.size());
+	for (std::size_t i = 0; i < n; ++i) {
+		if (_owner[i] == p) {
+			part->globalIndex[_localIndex[i]] = i;
+		}
+	}
+	const auto localOf = [&](std::size_t i) {
+		if (_owner[i] == p) {
+			return _localIndex[i];
+		}
+		const Ghost g = {_owner[i], _localIndex[i]};
+		return owned + std::size_t(std::lower_bound(ghosts.begin(), ghosts.end(), g, ghostLess) - ghosts.begin());
+	};
+	for (std::size_t s = 0; s < springs.size(); ++s) {
+		for (int end = 0; end < 2; ++end) {
+			const std::size_t i = end ? net.b[springs[s]] : net.a[springs[s]];
+			part->globalIndex[localOf(i)] = i;
+		}
+	}
+	for (std::size_t l = 0; l < local.nodeCount(); ++l) {
+		const std::size_t i = part->globalIndex[l];
+		local.x[l] = net.x[i];
+		local.y[l] = net.y[i];
+		local.z[l] = net.z[i];
+		local.vx[l] = net.vx[i];
+		local.vy[l] = net.vy[i];
+		local.vz[l] = net.vz[i];
+		local.invMass[l] = net.invMass[i];
+	}
+
+	// Springs in local numbering, sorted by endpoints like SoftBody's
+	std::vector<std::pair<std::pair<std::size_t, std::size_t>, std::size_t> > keyed(springs.size());
+	for (std::size_t s = 0; s < springs.size(); ++s) {
+		const std::size_t a = localOf(net.a[springs[s]]), b = localOf(net.b[springs[s]]);
+		keyed[s] = std::make_pair(std::make_pair(std::min(a, b), std::max(a, b)), springs[s]);
+	}
+	std::sort(keyed.begin(), keyed.end());
+	for (std::size_t s = 0; s < keyed.size(); ++s) {
+		const std::size_t g = keyed[s].second;
+		local.a.push_back(keyed[s].first.first);
+		local.b.push_back(keyed[s].first.second);
+		local.rest.push_back(net.rest[g]);
+		local.K.push_back(net.K[g]);
+		local.B.push_back(net.B[g]);
+	}
+
+	part->fx.resize(local.nodeCount());
+	part->fy.resize(local.nodeCount());
+	part->fz.resize(local.nodeCount());
+	_parts[p] = std::move(part);
+}
+
+template<class Precision>
+inline void PartitionedSpringNetwork<Precision>::_stepForces(Partition & part, Precision h) {
+	network_t & net = part.net;
+	const std::size_t n = net.nodeCount();
+	for (std::size_t i = 0; i < n; ++i) {
+		const Precision m = net.invMass[i] > 0 ? Precision(1) / net.invMass[i] : Precision(0);
+		part.fx[i] = m * _g[0];
+		part.fy[i] = m * _g[1];
+		part.fz[i] = m * _g[2];
+	}
+	accumulateSpringForces(net, part.fx.data(), part.fy.data(), part.fz.data());
+
+	// Forces on ghosts are their owners' business
+	for (std::size_t i = 0; i < part.owned; ++i) {
+		const Precision hw = h * net.invMass[i];
+		net.vx[i] += hw * part.fx[i];
+		net.vy[i] += hw * part.fy[i];
+		net.vz[i] += hw * part.fz[i];
+		if (net.invMass[i] > 0) {
+			net.x[i] += h * net.vx[i];
+			net.y[i] += h * net.vy[i];
+			net.z[i] += h * net.vz[i];
+		}
+	}
+}
+
+template<class Precision>
+inline void PartitionedSpringNetwork<Precision>::_exchange(Partition & part) {
+	network_t & net = part.net;
+	for (std::size_t k = 0; k < part.ghosts.size(); ++k) {
+		const network_t & src = _parts[part.ghosts[k].owner]->net;
+		const std::size_t i = part.ghosts[k].index, l = part.owned + k;
+		net.x[l] = src.x[i];
+		net.y[l] = src.y[i];
+		net.z[l] = src.z[i];
+		net.vx[l] = src.vx[i];
+		net.vy[l] = src.vy[i];
+		net.vz[l] = src.vz[i];
+	}
+}
+
+template<class Precision>
+inline void PartitionedSpringNetwork<Precision>::step(const time_t & dt, std::size_t steps) {
+	const Precision h = dt.value();
+	Internal::StepBarrier barrier(_parts.size());
+	_runPartitions([&](std::size_t p) {
+		Partition & part = *_parts[p];
+		for (std::size_t k = 0; k < steps; ++k) {
+			_stepForces(part, h);
+			barrier.wait();
+			_exchange(part);
+			barrier.wait();
+		}
+	});
+}
+
+template<class Precision>
+inline void PartitionedSpringNetwork<Precision>::gather(network_t & net) const {
+	for (std::size_t p = 0; p < _parts.size(); ++p) {
+		const Partition & part = *_parts[p];
+		for (std::size_t l = 0; l < part.owned; ++l) {
+			const std::size_t i = part.globalIndex[l];
+			net.x[i] = part.net.x[l];
+			net.y[i] = part.net.y[l];
+			net.z[i] = part.net.z[l];
+			net.vx[i] = part.net.vx[l];
+			net.vy[i] = part.net.vy[l];
+			net.vz[i] = part.net.vz[l];
+		}
+	}
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_SPRINGNETWORKPARTITION_H_
@@ -0,0 +1,329 @@
+/** @file	SpringNetworkSnapshot.h
+	@brief	header for checkpointing and restoring spring network state
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_SPRINGNETWORKSNAPSHOT_H_
+#define _PHYSICALMODELING_SPRINGNETWORKSNAPSHOT_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/SpringNetwork.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSoftBodies Soft Bodies
+	@{
+*/
+
+namespace Internal {
+	/// @brief Number of value arrays in a SpringNetwork
+	enum { springNetworkArrays = 10 };
+
+	template<class Precision>
+	inline std::vector<Precision> * springNetworkArray(SpringNetwork<Precision> & net, int i) {
+		std::vector<Precision> * arrays[springNetworkArrays] = {
+			&net.x, &net.y, &net.z, &net.vx, &net.vy, &net.vz, &net.invMass,
+			&net.rest, &net.K, &net.B
+		};
+		return arrays[i];
+	}
+
+	template<class Precision>
+	inline const std::vector<Precision> * springNetworkArray(const SpringNetwork<Precision> & net, int i) {
+		return springNetworkArray(const_cast<SpringNetwork<Precision> &>(net), i);
+	}
+
+	template<class T>
+	inline void copyValues(T * dest, const T * src, std::size_t n) {
+		if (n > 0) {
+			std::memcpy(dest, src, n * sizeof(T));
+		}
+	}
+} // end of Internal namespace
+
+/** @brief Complete copy of a SpringNetwork in one preallocated buffer.
+
+	capture() and restore() are a handful of memcpy calls; memory is
+	only allocated when the network grows beyond what the snapshot has
+	held before, so snapshots can be taken every step without stalls.
+	Everything in the network is stored, including spring endpoints.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class NetworkSnapshot {
+	public:
+		typedef SpringNetwork<Precision> network_t;
+
+		NetworkSnapshot() : _nodes(0), _springs(0) {}
+
+		/// @brief Preallocate room for a network of the given size
+		void reserve(std::size_t nodes, std::size_t springs) {
+			_values.reserve(7 * nodes + 3 * springs);
+			_endpoints.reserve(2 * springs);
+		}
+
+		void capture(const network_t & net);
+		void restore(network_t & net) const;
+
+		bool empty() const { return _values.empty() && _endpoints.empty(); }
+		std::size_t nodeCount() const { return _nodes; }
+		std::size_t springCount() const { return _springs; }
+		std::size_t bytes() const {
+			return _values.size() * sizeof(Precision) + _endpoints.size() * sizeof(std::size_t);
+		}
+
+	private:
+		std::size_t _nodes;
+		std::size_t _springs;
+		std::vector<Precision> _values;
+		std::vector<std::size_t> _endpoints;
+};
+
+/** @brief Ring of incremental, copy-on-write snapshots of a SpringNetwork.
+
+	Each array of the network is split into fixed-size chunks. A capture
+	compares every chunk with the most recent snapshot and copies only
+	the chunks that changed; unchanged chunks are shared, by reference
+	count, with the snapshots that already hold them. Keeping dozens of
+	rollback points therefore costs memory in proportion to what moved,
+	and chunk storage is pooled so steady-state captures do not allocate.
+
+	Changed chunks are found by comparison, not by dirty tracking: the
+	network's arrays are written directly by SoftBody and every solver,
+	so nothing records which chunks they touched. Each capture therefore
+	reads the whole network and the whole previous snapshot, so its time
+	grows with the state size, not with what changed; only the copying
+	and the memory are incremental.
+
+	The ring holds a fixed number of snapshots, identified by increasing
+	sequence numbers; capturing into a full ring evicts the oldest.
+
+	Spring endpoints are not stored: the network's topology must be the
+	same at restore as at capture. Use NetworkSnapshot when it changes.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class SnapshotRing {
+	public:
+		typedef SpringNetwork<Precision> network_t;
+
+		/// @brief Hold capacity snapshots in chunks of chunkValues values; both are at least 1
+		explicit SnapshotRing(std::size_t capacity, std::size_t chunkValues = 512) :
+			_chunkValues(std::max<std::size_t>(1, chunkValues)),
+			_slots(std::max<std::size_t>(1, capacity)),
+			_next(0),
+			_lastCopied(0) {}
+
+		/// @brief Preallocate chunk storage for this many snapshots of net
+		void reserve(const network_t & net, std::size_t snapshots);
+
+		/// @brief Store the state of net, returning the snapshot's sequence number
+		std::size_t capture(const network_t & net);
+
+		/// @brief Restore snapshot id into net; false if it has been evicted
+		bool restore(std::size_t id, network_t & net) const;
+
+		bool contains(std::size_t id) const {
+			return id < _next && id + _slots.size() >= _next;
+		}
+		std::size_t capacity() const { return _slots.size(); }
+		std::size_t size() const { return std::min(_next, _slots.size()); }
+		/// @brief Sequence number of the most recent snapshot (size() must be nonzero)
+		std::size_t newest() const { return _next - 1; }
+
+		/// @name Statistics
+		/// @{
+		/// @brief Chunks copied by the most recent capture
+		std::size_t lastCopiedChunks() const { return _lastCopied; }
+		/// @brief Chunks making up one snapshot
+		std::size_t chunksPerSnapshot() const { return _slots.empty() ? 0 : _slots[0].chunks.size(); }
+		/// @brief Distinct chunks currently held by all snapshots
+		std::size_t storedChunks() const { return _chunks.size() - _free.size(); }
+		/// @}
+
+	private:
+		struct Slot {
+			std::size_t sizes[Internal::springNetworkArrays];
+			std::vector<std::size_t> chunks;
+		};
+
+		std::size_t _allocateChunk();
+		void _release(Slot & slot);
+
+		std::size_t _chunkValues;
+		std::vector<Slot> _slots;
+		std::size_t _next;
+		std::size_t _lastCopied;
+
+		/// @name Chunk pool
+		/// @{
+		std::vector<std::vector<Precision> > _chunks;
+		std::vector<std::size_t> _refs;
+		std::vector<std::size_t> _free;
+		/// @}
+};
+
+// -- inline implementations -- //
+template<class Precision>
+inline void NetworkSnapshot<Precision>::capture(const network_t & net) {
+	_nodes = net.nodeCount();
+	_springs = net.springCount();
+	_values.resize(7 * _nodes + 3 * _springs);
+	_endpoints.resize(2 * _springs);
+	Precision * out = _values.empty() ? 0 : &_values[0];
+	for (int i = 0; i < Internal::springNetworkArrays; ++i) {
+		const std::vector<Precision> & src = *Internal::springNetworkArray(net, i);
+		if (!src.empty()) {
+			Internal::copyValues(out, &src[0], src.size());
+			out += src.size();
+		}
+	}
+	if (_springs > 0) {
+		Internal::copyValues(&_endpoints[0], &net.a[0], _springs);
+		Internal::copyValues(&_endpoints[_springs], &net.b[0], _springs);
+	}
+}
+
+template<class Precision>
+inline void NetworkSnapshot<Precision>::restore(network_t & net) const {
+	net.resizeNodes(_nodes);
+	net.a.resize(_springs);
+	net.b.resize(_springs);
+	const Precision * in = _values.empty() ? 0 : &_values[0];
+	for (int i = 0; i < Internal::springNetworkArrays; ++i) {
+		std::vector<Precision> & dest = *Internal::springNetworkArray(net, i);
+		dest.resize(i < 7 ? _nodes : _springs);
+		if (!dest.empty()) {
+			Internal::copyValues(&dest[0], in, dest.size());
+			in += dest.size();
+		}
+	}
+	if (_springs > 0) {
+		Internal::copyValues(&net.a[0], &_endpoints[0], _springs);
+		Internal::copyValues(&net.b[0], &_endpoints[_springs], _springs);
+	}
+}
+
+template<class Precision>
+inline std::size_t SnapshotRing<Precision>::_allocateChunk() {
+	if (_free.empty()) {
+		_chunks.push_back(std::vector<Precision>(_chunkValues));
+		_refs.push_back(0);
+		return _chunks.size() - 1;
+	}
+	const std::size_t id = _free.back();
+	_free.pop_back();
+	return id;
+}
+
+template<class Precision>
+inline void SnapshotRing<Precision>::_release(Slot & slot) {
+	for (std::size_t k = 0; k < slot.chunks.size(); ++k) {
+		const std::size_t id = slot.chunks[k];
+		if (--_refs[id] == 0) {
+			_free.push_back(id);
+		}
+	}
+	slot.chunks.clear();
+}
+
+template<class Precision>
+inline void SnapshotRing<Precision>::reserve(const network_t & net, std::size_t snapshots) {
+	std::size_t perSnapshot = 0;
+	for (int i = 0; i < Internal::springNetworkArrays; ++i) {
+		perSnapshot += (Internal::springNetworkArray(net, i)->size() + _chunkValues - 1) / _chunkValues;
+	}
+	const std::size_t wanted = perSnapshot * std::min(snapshots, _slots.size());
+	while (_chunks.size() < wanted) {
+		_chunks.push_back(std::vector<Precision>(_chunkValues));
+		_refs.push_back(0);
+		_free.push_back(_chunks.size() - 1);
+	}
+	for (std::size_t s = 0; s < _slots.size(); ++s) {
+		_slots[s].chunks.reserve(perSnapshot);
+	}
+}
+
+template<class Precision>
+inline std::size_t SnapshotRing<Precision>::capture(const network_t & net) {
+	const std::size_t id = _next++;
+	Slot & slot = _slots[id % _slots.size()];
+	_release(slot);
+
+	// Only share chunks with the previous snapshot if the layout matches
+	const Slot * prev = 0;
+	if (id > 0 && _slots.size() > 1) {
+		prev = &_slots[(id - 1) % _slots.size()];
+		for (int i = 0; i < Internal::springNetworkArrays; ++i) {
+			if (prev->sizes[i] != Internal::springNetworkArray(net, i)->size()) {
+				prev = 0;
+				break;
+			}
+		}
+	}
+
+	_lastCopied = 0;
+	for (int i = 0; i < Internal::springNetworkArrays; ++i) {
+		const std::vector<Precision> & src = *Internal::springNetworkArray(net, i);
+		slot.sizes[i] = src.size();
+		for (std::size_t begin = 0; begin < src.size(); begin += _chunkValues) {
+			const std::size_t n = std::min(_chunkValues, src.size() - begin);
+			const std::size_t k = slot.chunks.size();
+			if (prev && std::memcmp(&_chunks[prev->chunks[k]][0], &src[begin], n * sizeof(Precision)) == 0) {
+				slot.chunks.push_back(prev->chunks[k]);
+			} else {
+				const std::size_t chunk = _allocateChunk();
+				Internal::copyValues(&_chunks[chunk][0], &src[begin], n);
+				slot.chunks.push_back(chunk);
+				++_lastCopied;
+			}
+			++_refs[slot.chunks.back()];
+		}
+	}
+	return id;
+}
+
+template<class Precision>
+inline bool SnapshotRing<Precision>::restore(std::size_t id, network_t & net) const {
+	if (!contains(id)) {
+		return false;
+	}
+	const Slot & slot = _slots[id % _slots.size()];
+	net.resizeNodes(slot.sizes[0]);
+	std::size_t k = 0;
+	for (int i = 0; i < Internal::springNetworkArrays; ++i) {
+		std::vector<Precision> & dest = *Internal::springNetworkArray(net, i);
+		dest.resize(slot.sizes[i]);
+		for (std::size_t begin = 0; begin < dest.size(); begin += _chunkValues, ++k) {
+			const std::size_t n = std::min(_chunkValues, dest.size() - begin);
+			Internal::copyValues(&dest[begin], &_chunks[slot.chunks[k]][0], n);
+		}
+	}
+	return true;
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_SPRINGNETWORKSNAPSHOT_H_
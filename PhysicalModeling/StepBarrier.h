@@ -0,0 +1,66 @@
+/** @file	StepBarrier.h
+	@brief	header for a reusable thread barrier, for solvers that step
+	in phases across a fixed set of threads
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_STEPBARRIER_H_
+#define _PHYSICALMODELING_STEPBARRIER_H_
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <mutex>
+#include <condition_variable>
+#include <cstddef>
+
+namespace PhysicalModeling {
+
+namespace Internal {
+	/// @brief Reusable barrier for a fixed number of threads
+	class StepBarrier {
+		public:
+			explicit StepBarrier(std::size_t threads) :
+				_threads(threads),
+				_waiting(0),
+				_generation(0) {}
+
+			void wait() {
+				std::unique_lock<std::mutex> lock(_mutex);
+				const std::size_t generation = _generation;
+				if (++_waiting == _threads) {
+					_waiting = 0;
+					++_generation;
+					_cv.notify_all();
+				} else {
+					_cv.wait(lock, [&] { return _generation != generation; });
+				}
+			}
+
+		private:
+			std::mutex _mutex;
+			std::condition_variable _cv;
+			const std::size_t _threads;
+			std::size_t _waiting;
+			std::size_t _generation;
+	};
+} // end of Internal namespace
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_STEPBARRIER_H_
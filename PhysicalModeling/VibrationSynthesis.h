@@ -0,0 +1,328 @@
+/** @file	VibrationSynthesis.h
+	@brief	header for synthesizing vibration at audio rates from banks of
+	spring-dampers excited by sparse contact events
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_VIBRATIONSYNTHESIS_H_
+#define _PHYSICALMODELING_VIBRATIONSYNTHESIS_H_
+
+// Internal Includes
+#include <PhysicalModeling/BiquadFilter.h>
+#include <PhysicalModeling/DimensionedQuantities.h>
+#include <PhysicalModeling/LinearSpringDamper.h>
+#include <PhysicalModeling/SimdPack.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace PhysicalModeling {
+
+/** @addtogroup gSpringDamperSystems Spring-Damper Systems
+	@{
+*/
+
+namespace Internal {
+	/// @brief Oscillators are skipped or rendered this many at a time, a multiple of every SIMD width
+	enum { VibrationGroupSize = 16 };
+
+	/// @brief A force held over one sample of one oscillator
+	template<class Precision>
+	struct VibrationEvent {
+		std::size_t oscillator;
+		std::size_t offset;
+		Precision force;
+	};
+
+	/// @brief Orders events by group, then by when they happen
+	struct VibrationEventOrder {
+		template<class Event>
+		bool operator()(const Event & l, const Event & r) const {
+			const std::size_t lg = l.oscillator / VibrationGroupSize, rg = r.oscillator / VibrationGroupSize;
+			return lg < rg || (lg == rg && l.offset < r.offset);
+		}
+	};
+
+	/** @brief Structure-of-arrays view of a bank's free recursions
+
+		Without input, transposed direct form II with b0 = 0 reduces to
+		y = z1; z1 = z2 + c1 y; z2 = c2 y, where c1 = -a1 and c2 = -a2.
+	*/
+	template<class Precision>
+	struct VibrationLanes {
+		const Precision * c1;
+		const Precision * c2;
+		Precision * z1;
+		Precision * z2;
+		/// @brief One row of VibrationGroupSize partial sums per frame
+		Precision * mix;
+	};
+
+	/// @brief Run the group starting at oscillator first freely over frames [begin, end), adding its output to the mix
+	template <int W, class Precision>
+	PHYSICALMODELING_SIMD_INLINE void vibrationGroup(const VibrationLanes<Precision> & lanes, std::size_t first,
+			std::size_t begin, std::size_t end) {
+		typedef Simd::Pack<Precision, W> pack_t;
+		enum { packs = VibrationGroupSize / W };
+		// Independent recursions side by side keep the multiply-add latency hidden
+		pack_t z1[packs], z2[packs];
+		for (int p = 0; p < packs; ++p) {
+			z1[p] = pack_t::load(lanes.z1 + first + p * W);
+			z2[p] = pack_t::load(lanes.z2 + first + p * W);
+		}
+		for (std::size_t n = begin; n < end; ++n) {
+			pack_t sum = z1[0];
+			for (int p = 0; p < packs; ++p) {
+				const pack_t y = z1[p];
+				if (p > 0) {
+					sum = sum + y;
+				}
+				z1[p] = z2[p] + pack_t::load(lanes.c1 + first + p * W) * y;
+				z2[p] = pack_t::load(lanes.c2 + first + p * W) * y;
+			}
+			Precision * row = lanes.mix + n * VibrationGroupSize;
+			(pack_t::load(row) + sum).store(row);
+		}
+		for (int p = 0; p < packs; ++p) {
+			z1[p].store(lanes.z1 + first + p * W);
+			z2[p].store(lanes.z2 + first + p * W);
+		}
+	}
+
+	/// @brief Arguments of vibrationGroup, for Simd::forEachBlock over whole groups
+	template <class Precision>
+	struct VibrationKernel {
+		const VibrationLanes<Precision> * lanes;
+		std::size_t begin;
+		std::size_t end;
+
+		template <int W>
+		PHYSICALMODELING_SIMD_INLINE std::size_t blocks(std::size_t first, std::size_t last) const {
+			for (; first + VibrationGroupSize <= last; first += VibrationGroupSize) {
+				vibrationGroup<W>(*lanes, first, begin, end);
+			}
+			return first;
+		}
+	};
+
+	/// @brief Run one group at the widest lane count available
+	template <class Precision>
+	inline void vibrationGroups(const VibrationLanes<Precision> & lanes, std::size_t first,
+			std::size_t begin, std::size_t end) {
+		const VibrationKernel<Precision> kernel = { &lanes, begin, end };
+		Simd::forEachBlock<Precision>(kernel, first, first + VibrationGroupSize);
+	}
+} // end of Internal namespace
+
+/** @brief A bank of spring-damper oscillators, excited by sparse contact
+	forces and rendered as their summed response one block at a time.
+
+	Each oscillator is a spring-damper compiled exactly at the sample
+	period (see compileBiquad), scaled by its own gain. Between events
+	the oscillators run freely, so an excitation is a few scalar updates
+	rather than a dense input signal. Oscillators are rendered in groups
+	of 16 across SIMD lanes, and a group that has not been excited, or has
+	decayed below the silence threshold, costs nothing.
+
+	@code
+	PhysicalModeling::VibrationBank<> bank(dq::SI::Seconds(1.0 / 48000), 64);
+	for (std::size_t i = 0; i < modes.size(); ++i) {
+		bank.addOscillator(modes[i], gains[i]);
+	}
+	bank.setSilenceThreshold(1e-9);
+	// On contact, strike a few modes partway into the next block
+	bank.excite(3, dq::SI::Newtons(0.8), 17);
+	bank.render(samples);
+	@endcode
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class VibrationBank {
+	public:
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::force, Precision> force_t;
+
+		/// @brief Create an empty bank rendering blocks of blockSize samples every dt, of displacement or velocity
+		explicit VibrationBank(const time_t & dt, std::size_t blockSize = 64,
+			SpringDamperResponse response = DisplacementResponse);
+
+		time_t samplePeriod() const { return time_t(_dt); }
+		std::size_t blockSize() const { return _blockSize; }
+		std::size_t oscillatorCount() const { return _count; }
+
+		/// @brief Add an oscillator at rest, with its response scaled by gain, returning its index
+		std::size_t addOscillator(const LinearSpringDamper<Precision> & sd, Precision gain = 1);
+
+		/// @brief Retune an oscillator and its gain, keeping its current state
+		void setOscillator(std::size_t oscillator, const LinearSpringDamper<Precision> & sd, Precision gain = 1);
+
+		/// @brief Groups whose every state magnitude falls to or below threshold are silenced; 0 by default
+		void setSilenceThreshold(Precision threshold) { _threshold = threshold; }
+
+		/** @brief Apply force to an oscillator over sample offset of the next
+			block, which responds from the following sample on.
+
+			Returns false, ignoring the event, if either index is out of range.
+		*/
+		bool excite(std::size_t oscillator, const force_t & force, std::size_t offset = 0);
+
+		/// @brief Render the next block of blockSize() summed samples, applying the pending events
+		void render(Precision * output);
+
+		/// @brief Bring every oscillator to rest and drop pending events
+		void reset();
+
+	private:
+		typedef Internal::VibrationEvent<Precision> event_t;
+
+		Precision _dt;
+		std::size_t _blockSize;
+		SpringDamperResponse _response;
+		std::size_t _count;
+		Precision _threshold;
+		/// @brief Per oscillator, padded to whole groups with silent ones
+		std::vector<Precision> _b1, _b2, _c1, _c2;
+		std::vector<Precision> _z1, _z2;
+		/// @brief Per group, nonzero when at rest
+		std::vector<char> _silent;
+		std::vector<event_t> _events;
+		std::vector<Precision> _mix;
+};
+
+// -- inline implementations -- //
+
+template<class Precision>
+inline VibrationBank<Precision>::VibrationBank(const time_t & dt, std::size_t blockSize, SpringDamperResponse response) :
+	_dt(dt.value()),
+	_blockSize(blockSize),
+	_response(response),
+	_count(0),
+	_threshold(0),
+	_mix(blockSize * Internal::VibrationGroupSize) {}
+
+template<class Precision>
+inline std::size_t VibrationBank<Precision>::addOscillator(const LinearSpringDamper<Precision> & sd, Precision gain) {
+	const std::size_t i = _count++;
+	if (_b1.size() < _count) {
+		const std::size_t padded = _b1.size() + Internal::VibrationGroupSize;
+		_b1.resize(padded, Precision(0));
+		_b2.resize(padded, Precision(0));
+		_c1.resize(padded, Precision(0));
+		_c2.resize(padded, Precision(0));
+		_z1.resize(padded, Precision(0));
+		_z2.resize(padded, Precision(0));
+		_silent.push_back(1);
+	}
+	setOscillator(i, sd, gain);
+	return i;
+}
+
+template<class Precision>
+inline void VibrationBank<Precision>::setOscillator(std::size_t oscillator, const LinearSpringDamper<Precision> & sd,
+		Precision gain) {
+	const SecondOrderSection<Precision> section = compileBiquad(sd, time_t(_dt), _response);
+	_b1[oscillator] = gain * section.b1;
+	_b2[oscillator] = gain * section.b2;
+	_c1[oscillator] = -section.a1;
+	_c2[oscillator] = -section.a2;
+}
+
+template<class Precision>
+inline bool VibrationBank<Precision>::excite(std::size_t oscillator, const force_t & force, std::size_t offset) {
+	if (oscillator >= _count || offset >= _blockSize) {
+		return false;
+	}
+	event_t e;
+	e.oscillator = oscillator;
+	e.offset = offset;
+	e.force = force.value();
+	_events.push_back(e);
+	return true;
+}
+
+template<class Precision>
+inline void VibrationBank<Precision>::render(Precision * output) {
+	const std::size_t G = Internal::VibrationGroupSize;
+	std::fill(_mix.begin(), _mix.end(), Precision(0));
+	std::sort(_events.begin(), _events.end(), Internal::VibrationEventOrder());
+
+	Internal::VibrationLanes<Precision> lanes;
+	lanes.c1 = _c1.data();
+	lanes.c2 = _c2.data();
+	lanes.z1 = _z1.data();
+	lanes.z2 = _z2.data();
+	lanes.mix = _mix.data();
+
+	std::size_t e = 0;
+	for (std::size_t g = 0; g < _silent.size(); ++g) {
+		const std::size_t first = g * G, last = first + G;
+		const bool excited = e < _events.size() && _events[e].oscillator < last;
+		if (_silent[g] && !excited) {
+			continue;
+		}
+		// Run freely up to and including each event's sample, then add its input
+		std::size_t begin = 0;
+		while (e < _events.size() && _events[e].oscillator < last) {
+			const std::size_t offset = _events[e].offset;
+			Internal::vibrationGroups(lanes, first, begin, offset + 1);
+			for (; e < _events.size() && _events[e].oscillator < last && _events[e].offset == offset; ++e) {
+				const std::size_t i = _events[e].oscillator;
+				_z1[i] += _b1[i] * _events[e].force;
+				_z2[i] += _b2[i] * _events[e].force;
+			}
+			begin = offset + 1;
+		}
+		Internal::vibrationGroups(lanes, first, begin, _blockSize);
+
+		bool quiet = true;
+		for (std::size_t i = first; i < last && quiet; ++i) {
+			quiet = std::fabs(_z1[i]) <= _threshold && std::fabs(_z2[i]) <= _threshold;
+		}
+		if (quiet) {
+			std::fill(_z1.begin() + first, _z1.begin() + last, Precision(0));
+			std::fill(_z2.begin() + first, _z2.begin() + last, Precision(0));
+		}
+		_silent[g] = quiet;
+	}
+	_events.clear();
+
+	for (std::size_t n = 0; n < _blockSize; ++n) {
+		const Precision * row = &_mix[n * G];
+		Precision sum = 0;
+		for (std::size_t l = 0; l < G; ++l) {
+			sum += row[l];
+		}
+		output[n] = sum;
+	}
+}
+
+template<class Precision>
+inline void VibrationBank<Precision>::reset() {
+	std::fill(_z1.begin(), _z1.end(), Precision(0));
+	std::fill(_z2.begin(), _z2.end(), Precision(0));
+	std::fill(_silent.begin(), _silent.end(), char(1));
+	_events.clear();
+}
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_VIBRATIONSYNTHESIS_H_
@@ -0,0 +1,245 @@
+/** @file	WaveVariables.h
+	@brief	header for wave-variable transformations for coupling
+	spring-damper models over delayed links
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+//          Copyright agent 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+#pragma once
+#ifndef _PHYSICALMODELING_WAVEVARIABLES_H_
+#define _PHYSICALMODELING_WAVEVARIABLES_H_
+
+// Internal Includes
+#include <PhysicalModeling/DimensionedQuantities.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cmath>
+
+namespace PhysicalModeling {
+
+/** @defgroup gTeleoperation Teleoperation
+	@brief Passive coupling of simulated or real devices over delayed
+	communication channels.
+
+	Exchanging velocity and force directly over a delayed link adds energy
+	to the loop, and a stiff coupling soon goes unstable. The wave
+	transformation of Niemeyer and Slotine instead sends
+	@f[ u = \frac{b \dot x + F}{\sqrt{2b}}, \qquad v = \frac{b \dot x - F}{\sqrt{2b}} @f]
+	where b is the wave impedance. The power flowing through the link is
+	@f$ \frac{1}{2}(u^2 - v^2) @f$, so a pure delay on u and v only stores
+	energy, and the coupled system stays passive for any delay.
+
+	Wave variables have units of @f$ \sqrt{W} @f$, which has no integer
+	dimension vector, so they are passed as plain Precision values; the
+	velocities, forces, and impedance on either side are dimensioned.
+	@{
+*/
+
+/** @brief Fixed delay for one direction of a wave channel.
+
+	The buffer is allocated at construction, and each sample costs O(1).
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class WaveDelayLine {
+	public:
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::energy, Precision> energy_t;
+
+		explicit WaveDelayLine(std::size_t delaySamples) :
+			_buffer(delaySamples, Precision(0)),
+			_next(0) {}
+
+		/// @brief Delay in samples
+		std::size_t delay() const { return _buffer.size(); }
+
+		/// @brief Send one sample, returning the one sent delay() samples ago
+		Precision push(Precision wave) {
+			if (_buffer.empty()) {
+				return wave;
+			}
+			const Precision out = _buffer[_next];
+			_buffer[_next] = wave;
+			_next = (_next + 1 == _buffer.size()) ? 0 : _next + 1;
+			return out;
+		}
+
+		/// @brief Energy in transit, for a sample period dt
+		energy_t storedEnergy(const time_t & dt) const {
+			Precision sum = 0;
+			for (std::size_t i = 0; i < _buffer.size(); ++i) {
+				sum += _buffer[i] * _buffer[i];
+			}
+			return energy_t(sum * dt.value() / 2);
+		}
+
+		void reset() {
+			std::fill(_buffer.begin(), _buffer.end(), Precision(0));
+			_next = 0;
+		}
+
+	private:
+		std::vector<Precision> _buffer;
+		std::size_t _next;
+};
+
+/** @brief Wave transformation on the velocity-input (master) side.
+
+	Each sample, update() takes the master's velocity and the wave that
+	has arrived from the far side, and returns the force to apply to the
+	master; outgoingWave() is then sent down the channel.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class WaveMasterTransform {
+	public:
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::speed, Precision> speed_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::force, Precision> force_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::viscosity, Precision> viscosity_t;
+
+		explicit WaveMasterTransform(const viscosity_t & impedance) :
+			_b(impedance.value()),
+			_root(std::sqrt(2 * impedance.value())),
+			_u(0) {}
+
+		viscosity_t impedance() const { return viscosity_t(_b); }
+
+		/// @brief Force on the master, opposing its motion
+		force_t update(const speed_t & velocity, Precision returningWave) {
+			_u = _root * velocity.value() - returningWave;
+			return force_t(_b * velocity.value() - _root * returningWave);
+		}
+
+		Precision outgoingWave() const { return _u; }
+
+	private:
+		Precision _b;
+		Precision _root;
+		Precision _u;
+};
+
+/** @brief Wave transformation on the force-input (slave) side.
+
+	Each sample, update() takes the wave that has arrived from the master
+	side and the force the slave currently exerts on its environment, and
+	returns the velocity to command the slave with; returningWave() is
+	then sent back.
+
+	When the slave drives a spring-damper, its force depends on the
+	velocity being commanded. The second form of update() solves for both
+	together, given the force at zero velocity and the environment's
+	impedance over one sample (@f$ K \Delta t + B @f$ for a spring-damper
+	stepped with implicit Euler), which keeps the coupling passive in
+	discrete time.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class WaveSlaveTransform {
+	public:
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::speed, Precision> speed_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::force, Precision> force_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::viscosity, Precision> viscosity_t;
+
+		explicit WaveSlaveTransform(const viscosity_t & impedance) :
+			_b(impedance.value()),
+			_root(std::sqrt(2 * impedance.value())),
+			_v(0) {}
+
+		viscosity_t impedance() const { return viscosity_t(_b); }
+
+		/// @brief Velocity command for the slave
+		speed_t update(Precision incomingWave, const force_t & force) {
+			_v = incomingWave - 2 * force.value() / _root;
+			return speed_t((_root * incomingWave - force.value()) / _b);
+		}
+
+		/// @brief Velocity command for a slave whose force is
+		/// restingForce + environmentImpedance * velocity
+		speed_t update(Precision incomingWave, const force_t & restingForce, const viscosity_t & environmentImpedance) {
+			const Precision v = (_root * incomingWave - restingForce.value()) / (_b + environmentImpedance.value());
+			return update(incomingWave, force_t(restingForce.value() + environmentImpedance.value() * v));
+		}
+
+		Precision returningWave() const { return _v; }
+
+	private:
+		Precision _b;
+		Precision _root;
+		Precision _v;
+};
+
+/** @brief Simulated delayed link carrying waves in both directions.
+
+	A convenience pairing of the two transforms with a delay line each
+	way, stepped once per servo sample.
+*/
+template<class Precision = DimensionedQuantities::DefaultPrecision>
+class WaveChannel {
+	public:
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::speed, Precision> speed_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::force, Precision> force_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::viscosity, Precision> viscosity_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::time, Precision> time_t;
+		typedef DimensionedQuantities::Quantity<DimensionedQuantities::dims::energy, Precision> energy_t;
+
+		WaveChannel(const viscosity_t & impedance, std::size_t delaySamples) :
+			_master(impedance),
+			_slave(impedance),
+			_forward(delaySamples),
+			_backward(delaySamples),
+			_arriving(0),
+			_returning(0) {}
+
+		/// @brief Master side: velocity in, force on the master out
+		force_t masterUpdate(const speed_t & velocity) {
+			const force_t f = _master.update(velocity, _returning);
+			_arriving = _forward.push(_master.outgoingWave());
+			return f;
+		}
+
+		/// @brief Slave side: force on the environment in, velocity command out
+		speed_t slaveUpdate(const force_t & force) {
+			const speed_t v = _slave.update(_arriving, force);
+			_returning = _backward.push(_slave.returningWave());
+			return v;
+		}
+
+		/// @brief Slave side, for a force of restingForce + environmentImpedance * velocity
+		speed_t slaveUpdate(const force_t & restingForce, const viscosity_t & environmentImpedance) {
+			const speed_t v = _slave.update(_arriving, restingForce, environmentImpedance);
+			_returning = _backward.push(_slave.returningWave());
+			return v;
+		}
+
+		/// @brief Energy in transit in both directions, for a sample period dt
+		energy_t storedEnergy(const time_t & dt) const {
+			return _forward.storedEnergy(dt) + _backward.storedEnergy(dt);
+		}
+
+	private:
+		WaveMasterTransform<Precision> _master;
+		WaveSlaveTransform<Precision> _slave;
+		WaveDelayLine<Precision> _forward;
+		WaveDelayLine<Precision> _backward;
+		Precision _arriving;
+		Precision _returning;
+};
+
+/// @}
+// end of doxygen module
+
+} // end of PhysicalModeling namespace
+
+#endif // _PHYSICALMODELING_WAVEVARIABLES_H_
@@ -0,0 +1,74 @@
+/** @file	benchmark_BiquadBank.cpp
+	@brief	Audio-rate throughput of compiled spring-damper filters in a
+	BiquadBank against integrating each spring-damper
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+// Module to benchmark
+#include <PhysicalModeling/BiquadFilter.h>
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <chrono>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+
+int main() {
+	typedef std::chrono::steady_clock clock;
+	const double rate = 8000;
+	const std::size_t frames = 8000;
+	// Integration needs substeps to stay accurate near the higher resonances
+	const int substeps = 8;
+
+	std::printf("%10s %18s %18s\n", "channels", "integration (s)", "biquad bank (s)");
+	for (std::size_t channels = 64; channels <= 4096; channels *= 4) {
+		std::vector<LinearSpringDamper<> > elements;
+		BiquadBank<> bank(channels);
+		for (std::size_t c = 0; c < channels; ++c) {
+			elements.push_back(LinearSpringDamper<>(Kilograms(0.001), NewtonsPerMeter(1000 + 10.0 * c),
+				NewtonSecondsPerMeter(0.01)));
+			bank.setSection(c, 0, compileBiquad(elements.back(), Seconds(1 / rate)));
+		}
+		std::vector<double> force(channels * frames), out(channels * frames);
+		for (std::size_t n = 0; n < frames; ++n) {
+			for (std::size_t c = 0; c < channels; ++c) {
+				force[n * channels + c] = (n + c) % 800 == 0 ? 1.0 : 0.0;
+			}
+		}
+
+		const clock::time_point t0 = clock::now();
+		const double h = 1 / rate / substeps;
+		for (std::size_t c = 0; c < channels; ++c) {
+			const double m = elements[c].mass().value(), K = elements[c].stiffness().value();
+			const double B = elements[c].viscosity().value();
+			double x = 0, v = 0;
+			for (std::size_t n = 0; n < frames; ++n) {
+				out[n * channels + c] = x;
+				for (int s = 0; s < substeps; ++s) {
+					v += h / m * (force[n * channels + c] - K * x - B * v);
+					x += h * v;
+				}
+			}
+		}
+		const double sink = out.back();
+		const clock::time_point t1 = clock::now();
+		bank.process(force.data(), out.data(), frames);
+		const clock::time_point t2 = clock::now();
+
+		std::printf("%10lu %18.4f %18.4f\n",
+			static_cast<unsigned long>(channels),
+			std::chrono::duration<double>(t1 - t0).count(),
+			std::chrono::duration<double>(t2 - t1).count());
+		if (sink > 1e300) {
+			std::printf("%f\n", sink);
+		}
+	}
+	return 0;
+}
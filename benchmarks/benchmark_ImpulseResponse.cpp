@@ -0,0 +1,68 @@
+/** @file	benchmark_ImpulseResponse.cpp
+	@brief	Time to evaluate a long force trace through a spring-damper by
+	integration, FFT convolution, and recursion
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+// Module to benchmark
+#include <PhysicalModeling/ImpulseResponse.h>
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <chrono>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+
+int main() {
+	typedef std::chrono::steady_clock clock;
+	const LinearSpringDamper<> sd(Kilograms(0.05), NewtonsPerMeter(2000), NewtonSecondsPerMeter(0.5));
+	const double dt = 0.001;
+	// Integration needs many substeps per sample to be as accurate as the sampled response
+	const int substeps = 50;
+	const ImpulseResponse<> response(sd, Seconds(dt), ImpulseResponse<>::decayLength(sd, Seconds(dt), 1e-9));
+	std::printf("response length %lu samples\n", static_cast<unsigned long>(response.length()));
+
+	std::printf("%10s %18s %18s %18s\n", "samples", "integration (s)", "convolution (s)", "recursion (s)");
+	for (std::size_t count = 1 << 14; count <= (1 << 20); count <<= 2) {
+		std::vector<double> force(count), out(count);
+		for (std::size_t n = 0; n < count; ++n) {
+			force[n] = std::sin(0.01 * n) + (n % 500 < 20 ? 1.0 : 0.0);
+		}
+
+		const clock::time_point t0 = clock::now();
+		const double m = sd.mass().value(), K = sd.stiffness().value(), B = sd.viscosity().value();
+		const double h = dt / substeps;
+		double x = 0, v = 0;
+		for (std::size_t n = 0; n < count; ++n) {
+			out[n] = x;
+			for (int s = 0; s < substeps; ++s) {
+				v += h / m * (force[n] - K * x - B * v);
+				x += h * v;
+			}
+		}
+		const double sink = out[count - 1];
+		const clock::time_point t1 = clock::now();
+		response.convolve(force.data(), count, out.data(), 1024);
+		const clock::time_point t2 = clock::now();
+		ResponseFilter<> filter(response);
+		filter.process(force.data(), count, out.data());
+		const clock::time_point t3 = clock::now();
+
+		std::printf("%10lu %18.4f %18.4f %18.4f\n",
+			static_cast<unsigned long>(count),
+			std::chrono::duration<double>(t1 - t0).count(),
+			std::chrono::duration<double>(t2 - t1).count(),
+			std::chrono::duration<double>(t3 - t2).count());
+		if (sink > 1e300) {
+			std::printf("%f\n", sink);
+		}
+	}
+	return 0;
+}
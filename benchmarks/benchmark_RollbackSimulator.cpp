@@ -0,0 +1,50 @@
+/** @file	benchmark_RollbackSimulator.cpp
+	@brief	Resimulation throughput of RollbackSimulator
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+// Module to benchmark
+#include <PhysicalModeling/RollbackSimulator.h>
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <cstdio>
+
+int main() {
+	const std::size_t rollback = 32;
+	const int repeats = 20;
+	const SpringParameters<> params(NewtonsPerMeter(100), NewtonSecondsPerMeter(0.1));
+
+	std::printf("%8s %8s %10s %16s\n", "nodes", "springs", "rollback", "steps per ms");
+	for (std::size_t side = 8; side <= 64; side *= 2) {
+		SoftBody<> cloth(SoftBodyMesh<>::grid(side, side, Meters(0.01), Kilograms(0.1)), params, params, params);
+		cloth.pin(0);
+		cloth.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+		RollbackSimulator<> sim(cloth, Seconds(0.001), 64);
+		for (std::size_t f = 0; f < 64; ++f) {
+			sim.advance();
+		}
+
+		std::size_t steps = 0;
+		double seconds = 0;
+		for (int r = 0; r < repeats; ++r) {
+			// A late input alternating between two values forces a full resimulation
+			const double force = (r % 2) ? 0.1 : -0.1;
+			sim.setInput(sim.frame() - rollback, side * side - 1, Newtons(force), Newtons(0), Newtons(0));
+			steps += sim.resimulate();
+			seconds += sim.lastResimulationTime().value();
+		}
+		std::printf("%8lu %8lu %10lu %16.1f\n",
+			static_cast<unsigned long>(cloth.nodeCount()),
+			static_cast<unsigned long>(cloth.springCount()),
+			static_cast<unsigned long>(rollback),
+			double(steps) / (seconds * 1000.0));
+	}
+	return 0;
+}
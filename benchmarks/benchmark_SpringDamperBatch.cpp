@@ -0,0 +1,66 @@
+/** @file	benchmark_SpringDamperBatch.cpp
+	@brief	Parameter sweep throughput of SpringDamperBatch against
+	simulating each LinearSpringDamper in turn
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+// Module to benchmark
+#include <PhysicalModeling/SpringDamperBatch.h>
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <chrono>
+#include <vector>
+#include <cstdio>
+
+int main() {
+	typedef std::chrono::steady_clock clock;
+	const double dt = 0.0001;
+	const int steps = 10000;
+
+	std::printf("%10s %18s %18s\n", "scenarios", "one at a time (s)", "batch (s)");
+	for (int side = 8; side <= 64; side *= 2) {
+		std::vector<SpringDamperScenario<> > scenarios;
+		SpringDamperBatch<> batch;
+		for (int k = 1; k <= side; ++k) {
+			for (int b = 0; b < side; ++b) {
+				scenarios.push_back(SpringDamperScenario<>(Kilograms(0.2), NewtonsPerMeter(10.0 * k),
+					NewtonSecondsPerMeter(0.05 * b), Meters(0.01)));
+				batch.add(scenarios.back());
+			}
+		}
+
+		const clock::time_point t0 = clock::now();
+		double sink = 0;
+		for (std::size_t i = 0; i < scenarios.size(); ++i) {
+			LinearSpringDamper<> sd(scenarios[i].mass, scenarios[i].stiffness, scenarios[i].viscosity);
+			double x = scenarios[i].displacement.value(), v = 0, peak = 0;
+			for (int k = 0; k < steps; ++k) {
+				sd.setDisplacement(Meters(x));
+				sd.setVelocity(MetersPerSecond(v));
+				v += dt / scenarios[i].mass.value() * sd.force().value();
+				x += dt * v;
+				peak = x < -peak ? -x : peak;
+			}
+			sink += peak;
+		}
+		const clock::time_point t1 = clock::now();
+		batch.run(Seconds(dt), Seconds(dt * steps));
+		const clock::time_point t2 = clock::now();
+
+		std::printf("%10lu %18.3f %18.3f\n",
+			static_cast<unsigned long>(scenarios.size()),
+			std::chrono::duration<double>(t1 - t0).count(),
+			std::chrono::duration<double>(t2 - t1).count());
+		if (sink < 0) {
+			std::printf("%f\n", sink);
+		}
+	}
+	return 0;
+}
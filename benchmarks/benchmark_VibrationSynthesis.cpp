@@ -0,0 +1,85 @@
+/** @file	benchmark_VibrationSynthesis.cpp
+	@brief	Real-time factor of a VibrationBank with sparse contact events,
+	against filtering dense force input through a BiquadBank
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+// Module to benchmark
+#include <PhysicalModeling/VibrationSynthesis.h>
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <chrono>
+#include <vector>
+#include <cmath>
+#include <cstdio>
+
+int main() {
+	typedef std::chrono::steady_clock clock;
+	const double rate = 48000, pi = std::acos(-1.0);
+	const std::size_t blockSize = 64, blocks = std::size_t(rate) / blockSize;
+	// Contact events per block, spread over the bank
+	const std::size_t strikes = 8;
+
+	std::printf("%12s %18s %18s %14s\n", "oscillators", "biquad bank (s)", "vibration bank (s)", "x real time");
+	for (std::size_t count = 256; count <= 16384; count *= 4) {
+		BiquadBank<> dense(count);
+		VibrationBank<> sparse(Seconds(1 / rate), blockSize);
+		sparse.setSilenceThreshold(1e-9);
+		for (std::size_t i = 0; i < count; ++i) {
+			const double f = 60 + 4000.0 * i / count, m = 0.001;
+			const double K = m * (2 * pi * f) * (2 * pi * f);
+			const LinearSpringDamper<> sd(Kilograms(m), NewtonsPerMeter(K), NewtonSecondsPerMeter(2 * 0.01 * std::sqrt(K * m)));
+			dense.setSection(i, 0, compileBiquad(sd, Seconds(1 / rate)));
+			sparse.addOscillator(sd);
+		}
+
+		// Dense: a force sample for every oscillator, then a sum per frame
+		std::vector<double> force(count * blockSize), out(count * blockSize), mix(blockSize);
+		unsigned state = 1;
+		const clock::time_point t0 = clock::now();
+		for (std::size_t b = 0; b < blocks; ++b) {
+			std::fill(force.begin(), force.end(), 0.0);
+			for (std::size_t k = 0; k < strikes; ++k) {
+				state = state * 1103515245u + 12345u;
+				force[((state >> 8) % blockSize) * count + (state >> 12) % count] = 1.0;
+			}
+			dense.process(force.data(), out.data(), blockSize);
+			for (std::size_t n = 0; n < blockSize; ++n) {
+				double sum = 0;
+				for (std::size_t i = 0; i < count; ++i) {
+					sum += out[n * count + i];
+				}
+				mix[n] = sum;
+			}
+		}
+		const double sink = mix[0];
+		const clock::time_point t1 = clock::now();
+		state = 1;
+		for (std::size_t b = 0; b < blocks; ++b) {
+			for (std::size_t k = 0; k < strikes; ++k) {
+				state = state * 1103515245u + 12345u;
+				sparse.excite((state >> 12) % count, Newtons(1), (state >> 8) % blockSize);
+			}
+			sparse.render(mix.data());
+		}
+		const clock::time_point t2 = clock::now();
+
+		const double rendered = std::chrono::duration<double>(t2 - t1).count();
+		std::printf("%12lu %18.4f %18.4f %14.1f\n",
+			static_cast<unsigned long>(count),
+			std::chrono::duration<double>(t1 - t0).count(),
+			rendered,
+			blocks * blockSize / rate / rendered);
+		if (sink + mix[0] > 1e300) {
+			std::printf("%f\n", sink);
+		}
+	}
+	return 0;
+}
@@ -46,11 +46,19 @@ set(BOOST_TEST_TARGET_PREFIX "boosttest")
 if(NOT Boost_FOUND)
 	find_package(Boost 1.34.0 QUIET)
 endif()
-if("${Boost_VERSION}0" LESS "1034000")
+
+# Newer FindBoost/BoostConfig report Boost_VERSION as x.y.z: normalize it
+# to the old-style integer form used by the comparisons below.
+set(_boosttesttargets_version "${Boost_VERSION}")
+if("${Boost_VERSION}" MATCHES "^([0-9]+)\\.([0-9]+)\\.([0-9]+)$")
+	math(EXPR _boosttesttargets_version
+		"${CMAKE_MATCH_1} * 100000 + ${CMAKE_MATCH_2} * 100 + ${CMAKE_MATCH_3}")
+endif()
+if("${_boosttesttargets_version}0" LESS "1034000")
 	set(_shared_msg
 		"NOTE: boost::test-based targets and tests cannot "
 		"be added: boost >= 1.34.0 required but not found. "
-		"(found: '${Boost_VERSION}'; want >=103400) ")
+		"(found: '${_boosttesttargets_version}'; want >=103400) ")
 	if(BUILD_TESTING)
 		message(FATAL_ERROR
 			${_shared_msg}
@@ -66,7 +74,7 @@ endif()
 include(GetForceIncludeDefinitions)
 include(CopyResourcesToBuildTree)
 
-if(Boost_FOUND AND NOT "${Boost_VERSION}0" LESS "1034000")
+if(Boost_FOUND AND NOT "${_boosttesttargets_version}0" LESS "1034000")
 	set(_boosttesttargets_libs)
 	set(_boostConfig "BoostTestTargetsIncluded.h")
 	if(NOT Boost_UNIT_TEST_FRAMEWORK_LIBRARY)
@@ -144,7 +152,7 @@ function(add_boost_test _name)
 			"Syntax error in use of add_boost_test: at least one source file required!")
 	endif()
 
-	if(Boost_FOUND AND NOT "${Boost_VERSION}0" LESS "1034000")
+	if(Boost_FOUND AND NOT "${_boosttesttargets_version}0" LESS "1034000")
 
 		include_directories(${Boost_INCLUDE_DIRS})
 
@@ -236,7 +244,7 @@ function(add_boost_test _name)
 			set(_test_command ${_target_name})
 		endif()
 
-		if(TESTS AND ( "${Boost_VERSION}" VERSION_GREATER "103799" ))
+		if(TESTS AND ( "${_boosttesttargets_version}" VERSION_GREATER "103799" ))
 			foreach(_test ${TESTS})
 				add_test(NAME
 					${_name}-${_test}
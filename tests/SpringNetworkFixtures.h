@@ -0,0 +1,73 @@
+/** @file	SpringNetworkFixtures.h
+	@brief	Spring networks and soft bodies shared by the solver test drivers
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#pragma once
+#ifndef _PHYSICALMODELING_TESTS_SPRINGNETWORKFIXTURES_H_
+#define _PHYSICALMODELING_TESTS_SPRINGNETWORKFIXTURES_H_
+
+// Internal Includes
+#include <PhysicalModeling/SoftBody.h>
+#include <PhysicalModeling/SpringNetwork.h>
+
+// Standard includes
+#include <cstddef>
+
+namespace Fixtures {
+	using namespace PhysicalModeling;
+	using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+	const double hangingMassKg = 0.2;
+	const double gravity = 9.81;
+
+	/// Node 0 pinned at the origin, node 1 of hangingMassKg hanging 0.1 m
+	/// below it on an unstretched spring of stiffness K and viscosity B
+	inline SpringNetwork<> hangingMass(double K, double B) {
+		SpringNetwork<> net;
+		net.resizeNodes(2);
+		net.invMass[0] = 0;
+		net.invMass[1] = 1.0 / hangingMassKg;
+		net.y[1] = -0.1;
+		net.a.push_back(0);
+		net.b.push_back(1);
+		net.rest.push_back(0.1);
+		net.K.push_back(K);
+		net.B.push_back(B);
+		return net;
+	}
+
+	/// Extension at which a spring of stiffness K holds hangingMass() up
+	inline double staticStretch(double K) {
+		return hangingMassKg * gravity / K;
+	}
+
+	/// Square n by n cloth, 1 cm apart, under gravity; pinned at node 0,
+	/// and at the other end of that edge too if pinBothCorners
+	inline SoftBody<> hangingCloth(std::size_t n, bool pinBothCorners, const Kilograms & mass = Kilograms(0.1),
+			const SpringParameters<> & structural = SpringParameters<>(NewtonsPerMeter(100), NewtonSecondsPerMeter(0.1)),
+			const SpringParameters<> & shear = SpringParameters<>(NewtonsPerMeter(100), NewtonSecondsPerMeter(0.1)),
+			const SpringParameters<> & bend = SpringParameters<>(NewtonsPerMeter(100), NewtonSecondsPerMeter(0.1))) {
+		SoftBody<> cloth(SoftBodyMesh<>::grid(n, n, Meters(0.01), mass), structural, shear, bend);
+		cloth.pin(0);
+		if (pinBothCorners) {
+			cloth.pin(n - 1);
+		}
+		cloth.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-gravity), MetersPerSecondSquared(0));
+		return cloth;
+	}
+
+	/// Bit-for-bit equal topology, parameters, positions, and velocities
+	inline bool sameState(const SpringNetwork<> & a, const SpringNetwork<> & b) {
+		return a.x == b.x && a.y == b.y && a.z == b.z
+			&& a.vx == b.vx && a.vy == b.vy && a.vz == b.vz
+			&& a.invMass == b.invMass && a.a == b.a && a.b == b.b
+			&& a.rest == b.rest && a.K == b.K && a.B == b.B;
+	}
+} // end of Fixtures namespace
+
+#endif // _PHYSICALMODELING_TESTS_SPRINGNETWORKFIXTURES_H_
@@ -0,0 +1,238 @@
+/** @file	test_AdaptiveIntegrator.cpp
+	@brief	AdaptiveIntegrator test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE AdaptiveIntegrator basic tests
+
+// Module to test
+#include <PhysicalModeling/AdaptiveIntegrator.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <cmath>
+#include <vector>
+
+/// One 0.5 kg mass on a 200 N/m spring anchored at the origin, pulled
+/// 1 cm from rest along x
+static SpringNetwork<> makeOscillator(double damping) {
+	SpringNetwork<> net;
+	net.resizeNodes(2);
+	net.invMass[0] = 0;
+	net.invMass[1] = 1.0 / 0.5;
+	net.x[1] = 0.11;
+	net.a.push_back(0);
+	net.b.push_back(1);
+	net.rest.push_back(0.1);
+	net.K.push_back(200.0);
+	net.B.push_back(damping);
+	return net;
+}
+
+template<class Tableau>
+static double oscillatorError(double rtol, std::size_t & steps) {
+	SpringNetwork<> net = makeOscillator(0);
+	SpringNetworkSystem<> system(net);
+	AdaptiveIntegrator<Tableau> integrator;
+	integrator.setRelativeTolerance(rtol);
+	system.setTolerances(integrator, Meters(rtol * 0.01), MetersPerSecond(rtol * 0.2));
+	const double T = 2.0;
+	BOOST_REQUIRE(system.advance(integrator, Seconds(T)));
+	steps = integrator.acceptedSteps();
+	const double omega = std::sqrt(200.0 / 0.5);
+	return std::fabs(net.x[1] - 0.1 - 0.01 * std::cos(omega * T));
+}
+
+BOOST_AUTO_TEST_CASE(DormandPrinceTracksOscillator) {
+	std::size_t loose = 0, tight = 0;
+	const double looseError = oscillatorError<DormandPrince45>(1e-5, loose);
+	const double tightError = oscillatorError<DormandPrince45>(1e-9, tight);
+	BOOST_CHECK_LT(looseError, 1e-5);
+	BOOST_CHECK_LT(tightError, 1e-8);
+	BOOST_CHECK_LT(tightError, looseError);
+	BOOST_CHECK_GT(tight, loose);
+	// A fixed 1 ms step, as used for explicit stepping, would take 2000
+	BOOST_CHECK_LT(tight, 500u);
+}
+
+BOOST_AUTO_TEST_CASE(BogackiShampineTracksOscillator) {
+	std::size_t bs = 0, dp = 0;
+	const double error = oscillatorError<BogackiShampine23>(1e-6, bs);
+	oscillatorError<DormandPrince45>(1e-6, dp);
+	BOOST_CHECK_LT(error, 1e-5);
+	// The lower order pair needs more, cheaper steps at this tolerance
+	BOOST_CHECK_GT(bs, dp);
+}
+
+BOOST_AUTO_TEST_CASE(StepsGrowAsMotionSettles) {
+	SpringNetwork<> net = makeOscillator(0);
+	net.x[1] = 0.1;
+	net.B[0] = 10.0;
+	SpringNetworkSystem<> system(net);
+	system.setGravity(MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0), MetersPerSecondSquared(0));
+	AdaptiveIntegrator<DormandPrince45> integrator;
+	system.setTolerances(integrator, Meters(1e-7), MetersPerSecond(1e-6));
+
+	BOOST_REQUIRE(system.advance(integrator, Seconds(2)));
+	const double settlingStep = integrator.stepSize().value();
+	BOOST_REQUIRE(system.advance(integrator, Seconds(20)));
+	// Once at rest the step is limited only by stability, about 3 / omega
+	BOOST_CHECK_GT(integrator.stepSize().value(), settlingStep);
+	BOOST_CHECK_GT(integrator.stepSize().value(), 0.1);
+	// A fixed 1 ms step would take 22000
+	BOOST_CHECK_LT(integrator.acceptedSteps(), 300u);
+
+	// Static stretch under gravity, m g / K
+	BOOST_CHECK_CLOSE(0.1 - net.x[1], 0.5 * 9.81 / 200.0, 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE(StateRoundTrip) {
+	SpringNetwork<> net = makeOscillator(1);
+	net.vy[1] = 2.0;
+	SpringNetworkSystem<> system(net);
+	std::vector<double> state;
+	system.getState(state);
+	BOOST_REQUIRE_EQUAL(state.size(), system.stateSize());
+	BOOST_CHECK_EQUAL(state[1], 0.11);
+	BOOST_CHECK_EQUAL(state[4 * 2 + 1], 2.0);
+
+	std::vector<double> rate;
+	system(0, state, rate);
+	// Pinned node does not move; spring pulls the mass back toward the anchor
+	BOOST_CHECK_EQUAL(rate[0], 0.0);
+	BOOST_CHECK_EQUAL(rate[3 * 2], 0.0);
+	BOOST_CHECK_EQUAL(rate[2 + 1], 2.0);
+	BOOST_CHECK_CLOSE(rate[3 * 2 + 1], -200.0 * 0.01 / 0.5, 1e-9);
+
+	state[1] = 0.2;
+	system.setState(state);
+	BOOST_CHECK_EQUAL(net.x[1], 0.2);
+}
+
+/// dy/dt vanishing at every Bogacki-Shampine stage of the step [0, h0],
+/// so that step has no estimated error, but not in between
+struct StageBlindRate {
+	double h0;
+	double rate(double t) const {
+		return 1e4 * t * (t - h0 / 2) * (t - 3 * h0 / 4) * (t - h0);
+	}
+	void operator()(double t, const std::vector<double> &, std::vector<double> & dydt) const {
+		dydt.assign(1, rate(t));
+	}
+};
+
+/// One event, at a fixed time
+struct Deadline {
+	double at;
+	bool passed;
+	std::size_t eventCount() const { return 1; }
+	void eventValues(double t, const std::vector<double> &, std::vector<double> & values) const {
+		values.assign(1, passed ? t - at : at - t);
+	}
+	bool handleEvent(std::size_t, double, const std::vector<double> &, std::vector<double> &) {
+		passed = !passed;
+		return false;
+	}
+};
+
+BOOST_AUTO_TEST_CASE(RetakenStepChecksTolerance) {
+	// The first step passes with no error estimate; retaken to end at the
+	// event, its stages no longer fall on the zeros of the rate
+	const double h0 = 0.1, at = 0.05;
+	StageBlindRate system = { h0 };
+	Deadline deadline = { at, false };
+	AdaptiveIntegrator<BogackiShampine23> integrator;
+	integrator.setRelativeTolerance(1e-8);
+	integrator.setInitialStep(Seconds(h0));
+	std::vector<double> y(1, 0.0);
+	BOOST_REQUIRE(integrator.integrate(system, y, Seconds(0), Seconds(h0), deadline));
+	BOOST_CHECK_EQUAL(integrator.handledEvents(), 1u);
+	BOOST_CHECK_GT(integrator.rejectedSteps(), 0u);
+
+	// Simpson's rule is exact for the quartic up to a negligible remainder
+	const int intervals = 2000;
+	double exact = system.rate(0) + system.rate(h0);
+	for (int i = 1; i < intervals; ++i) {
+		exact += (i % 2 ? 4 : 2) * system.rate(h0 * i / intervals);
+	}
+	exact *= h0 / (3 * intervals);
+	BOOST_CHECK_SMALL(y[0] - exact, 1e-8);
+}
+
+/// A 0.1 kg ball dropped from 1 m onto a stiff ground contact
+static SpringNetwork<> makeBall() {
+	SpringNetwork<> net;
+	net.resizeNodes(1);
+	net.invMass[0] = 1.0 / 0.1;
+	net.y[0] = 1.0;
+	return net;
+}
+
+BOOST_AUTO_TEST_CASE(ContactOnsetLocated) {
+	SpringNetwork<> net = makeBall();
+	SpringNetworkSystem<> system(net);
+	system.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+	system.addGroundContact(0, Meters(0), NewtonsPerMeter(1e5));
+	AdaptiveIntegrator<DormandPrince45> integrator;
+	system.setTolerances(integrator, Meters(1e-9), MetersPerSecond(1e-8));
+
+	const double impact = std::sqrt(2.0 / 9.81);
+	BOOST_REQUIRE(system.advance(integrator, Seconds(impact - 1e-4)));
+	BOOST_CHECK(!system.contactActive(0));
+	BOOST_CHECK_EQUAL(integrator.handledEvents(), 0u);
+	BOOST_REQUIRE(system.advance(integrator, Seconds(2e-4)));
+	BOOST_CHECK(system.contactActive(0));
+	BOOST_CHECK_EQUAL(integrator.handledEvents(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(ContactSwitchPatchesDerivative) {
+	// Switching a contact changes only its own node's acceleration
+	SpringNetwork<> net = makeOscillator(1);
+	net.vy[1] = -0.5;
+	SpringNetworkSystem<> system(net);
+	system.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+	system.addGroundContact(1, Meters(0.5), NewtonsPerMeter(1e4), NewtonSecondsPerMeter(3));
+	BOOST_REQUIRE(system.contactActive(0));
+	std::vector<double> state, rate, fresh;
+	system.getState(state);
+	system(0, state, rate);
+	for (int k = 0; k < 2; ++k) {
+		BOOST_CHECK(system.handleEvent(0, 0, state, rate));
+		BOOST_CHECK_EQUAL(system.contactActive(0), k == 1);
+		system(0, state, fresh);
+		BOOST_REQUIRE_EQUAL(rate.size(), fresh.size());
+		for (std::size_t m = 0; m < rate.size(); ++m) {
+			BOOST_CHECK_SMALL(rate[m] - fresh[m], 1e-9);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(BouncesConserveEnergy) {
+	SpringNetwork<> net = makeBall();
+	SpringNetworkSystem<> system(net);
+	system.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+	system.addGroundContact(0, Meters(0), NewtonsPerMeter(1e5));
+	AdaptiveIntegrator<DormandPrince45> integrator;
+	integrator.setRelativeTolerance(1e-10);
+	system.setTolerances(integrator, Meters(1e-9), MetersPerSecond(1e-8));
+
+	// Two full bounces, ending in flight
+	BOOST_REQUIRE(system.advance(integrator, Seconds(2.0)));
+	BOOST_CHECK(!system.contactActive(0));
+	BOOST_CHECK_EQUAL(integrator.handledEvents(), 4u);
+	const double energy = 0.1 * 9.81 * net.y[0] + 0.5 * 0.1 * net.vy[0] * net.vy[0];
+	BOOST_CHECK_CLOSE(energy, 0.1 * 9.81 * 1.0, 1e-4);
+	// Events cost a few short steps, not a globally shorter step
+	BOOST_CHECK_LT(integrator.acceptedSteps(), 200u);
+}
@@ -0,0 +1,127 @@
+/** @file	test_ArticulatedChain.cpp
+	@brief	ArticulatedChain test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE ArticulatedChain basic tests
+
+// Module to test
+#include <PhysicalModeling/ArticulatedChain.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using PhysicalModeling::ArticulatedChain;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+typedef PhysicalModeling::RevoluteJointParameters<> Joint;
+
+// System includes
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+namespace {
+	Joint makeJoint(double stiffness, double viscosity = 0) {
+		return Joint(Kilograms(0.5),
+			Meters(0.3),
+			KilogramMetersSquared(0.004),
+			NewtonMetersPerRadian(stiffness),
+			NewtonMeterSecondsPerRadian(viscosity));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SingleSpringJoint) {
+	std::vector<Joint> joints(1, makeJoint(3.0));
+	ArticulatedChain<> chain(joints);
+	chain.setJointAngle(0, Radians(0.1));
+	chain.computeAccelerations();
+
+	// J = I + m c^2 about the joint
+	const double J = 0.004 + 0.5 * 0.15 * 0.15;
+	BOOST_CHECK_CLOSE(chain.jointAcceleration(0).value(), -3.0 * 0.1 / J, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(PendulumUnderGravity) {
+	std::vector<Joint> joints(1, makeJoint(0.0));
+	ArticulatedChain<> chain(joints);
+	chain.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81));
+	chain.computeAccelerations();
+
+	const double J = 0.004 + 0.5 * 0.15 * 0.15;
+	BOOST_CHECK_CLOSE(chain.jointAcceleration(0).value(), -0.5 * 9.81 * 0.15 / J, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(TwoLinkMatchesMassMatrix) {
+	std::vector<Joint> joints(2, makeJoint(0.0));
+	ArticulatedChain<> chain(joints);
+	chain.setJointTorque(0, NewtonMeters(1.0));
+	chain.computeAccelerations();
+
+	// Closed-form joint-space mass matrix of a straight two-link arm
+	const double m = 0.5, L = 0.3, c = 0.15, I = 0.004;
+	const double M00 = 2 * I + m * c * c + m * (L + c) * (L + c);
+	const double M01 = I + m * c * c + m * L * c;
+	const double M11 = I + m * c * c;
+	const double det = M00 * M11 - M01 * M01;
+	BOOST_CHECK_CLOSE(chain.jointAcceleration(0).value(), M11 / det, 1e-9);
+	BOOST_CHECK_CLOSE(chain.jointAcceleration(1).value(), -M01 / det, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(UndampedChainConservesEnergy) {
+	std::vector<Joint> joints(4, makeJoint(2.0));
+	ArticulatedChain<> chain(joints);
+	chain.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81));
+	chain.setJointAngle(0, Radians(0.4));
+	chain.setJointAngle(2, Radians(-0.6));
+	chain.setJointVelocity(3, RadiansPerSecond(1.0));
+
+	const double e0 = chain.energy().value();
+	double maxDeviation = 0;
+	for (int i = 0; i < 20000; ++i) {
+		chain.step(Seconds(0.0001));
+		maxDeviation = std::max(maxDeviation, std::fabs(chain.energy().value() - e0));
+	}
+	BOOST_CHECK_LT(maxDeviation, 0.01 * std::fabs(e0) + 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE(DampedChainDissipatesEnergy) {
+	std::vector<Joint> joints(3, makeJoint(2.0, 0.05));
+	ArticulatedChain<> chain(joints);
+	chain.setJointAngle(1, Radians(0.5));
+
+	const double e0 = chain.energy().value();
+	for (int i = 0; i < 5000; ++i) {
+		chain.step(Seconds(0.0005));
+	}
+	BOOST_CHECK_LT(chain.energy().value(), 0.5 * e0);
+}
+
+BOOST_AUTO_TEST_CASE(StepChainsMatchesIndividualSteps) {
+	std::vector<Joint> joints(3, makeJoint(2.0, 0.01));
+	std::vector<ArticulatedChain<> > reference(9, ArticulatedChain<>(joints));
+	for (std::size_t i = 0; i < reference.size(); ++i) {
+		reference[i].setJointAngle(0, Radians(0.1 * i));
+	}
+	std::vector<ArticulatedChain<> > serial(reference), threaded(reference);
+	for (int s = 0; s < 100; ++s) {
+		for (std::size_t i = 0; i < reference.size(); ++i) {
+			reference[i].step(Seconds(0.001));
+		}
+	}
+	// One thread, then an uneven split across threads
+	PhysicalModeling::stepChains(serial, Seconds(0.001), 100, 1);
+	PhysicalModeling::stepChains(threaded, Seconds(0.001), 60, 4);
+	PhysicalModeling::stepChains(threaded, Seconds(0.001), 40, 4);
+	for (std::size_t i = 0; i < reference.size(); ++i) {
+		for (std::size_t j = 0; j < 3; ++j) {
+			BOOST_CHECK_EQUAL(serial[i].jointAngle(j).value(), reference[i].jointAngle(j).value());
+			BOOST_CHECK_EQUAL(threaded[i].jointAngle(j).value(), reference[i].jointAngle(j).value());
+		}
+	}
+}
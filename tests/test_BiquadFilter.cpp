@@ -0,0 +1,148 @@
+/** @file	test_BiquadFilter.cpp
+	@brief	Spring-damper biquad compiler and biquad bank test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE BiquadFilter basic tests
+
+// Module to test
+#include <PhysicalModeling/BiquadFilter.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <vector>
+#include <cmath>
+
+namespace {
+	/// One section in direct form I, for reference
+	struct DirectForm {
+		DirectForm() : u1(0), u2(0), y1(0), y2(0) {}
+		double operator()(const SecondOrderSection<> & c, double u) {
+			const double y = c.b0 * u + c.b1 * u1 + c.b2 * u2 - c.a1 * y1 - c.a2 * y2;
+			u2 = u1;
+			u1 = u;
+			y2 = y1;
+			y1 = y;
+			return y;
+		}
+		double u1, u2, y1, y2;
+	};
+
+	/// One section in transposed direct form II, in the bank's order of operations
+	struct TransposedForm {
+		TransposedForm() : z1(0), z2(0) {}
+		double operator()(const SecondOrderSection<> & c, double u) {
+			const double y = c.b0 * u + z1;
+			z1 = c.b1 * u - c.a1 * y + z2;
+			z2 = c.b2 * u - c.a2 * y;
+			return y;
+		}
+		double z1, z2;
+	};
+}
+
+BOOST_AUTO_TEST_CASE(CompiledStepResponse) {
+	const LinearSpringDamper<> sd(Kilograms(0.01), NewtonsPerMeter(4000), NewtonSecondsPerMeter(0.4));
+	const double dt = 1.0 / 8000;
+	const SecondOrderSection<> displacement = compileBiquad(sd, Seconds(dt));
+	const SecondOrderSection<> velocity = compileBiquad(sd, Seconds(dt), VelocityResponse);
+	BOOST_CHECK_EQUAL(displacement.b0, 0.0);
+	BOOST_CHECK_EQUAL(displacement.a1, velocity.a1);
+	BOOST_CHECK_EQUAL(displacement.a2, velocity.a2);
+	// Same filter as the impulse response's recursion
+	BOOST_CHECK_EQUAL(ImpulseResponse<>(sd, Seconds(dt), 1).sections()[0].b1, displacement.b1);
+
+	const double wn = naturalFrequency(sd).value(), zeta = dampingRatio(sd).value();
+	const double root = std::sqrt(1 - zeta * zeta), wd = wn * root;
+	DirectForm x, v;
+	for (int n = 0; n < 4000; ++n) {
+		const double t = dt * n, decay = std::exp(-zeta * wn * t);
+		BOOST_CHECK_SMALL(x(displacement, 1.0) - (1 - decay * (std::cos(wd * t) + zeta / root * std::sin(wd * t))) / 4000, 1e-13);
+		BOOST_CHECK_SMALL(v(velocity, 1.0) - decay * wn / root * std::sin(wd * t) / 4000, 1e-10);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(PassThroughByDefault) {
+	BiquadBank<> bank(5, 2);
+	BOOST_CHECK_EQUAL(bank.channelCount(), 5u);
+	BOOST_CHECK_EQUAL(bank.stageCount(), 2u);
+	std::vector<double> samples(5 * 7);
+	for (std::size_t i = 0; i < samples.size(); ++i) {
+		samples[i] = 0.5 * i - 3;
+	}
+	std::vector<double> out(samples.size());
+	bank.process(samples.data(), out.data(), 7);
+	BOOST_CHECK(out == samples);
+}
+
+BOOST_AUTO_TEST_CASE(BankMatchesScalarReference) {
+	// An odd channel count, so some channels are in a partial block
+	const std::size_t channels = 37, stages = 3, frames = 500;
+	const double dt = 1.0 / 16000;
+	BiquadBank<> bank(channels, stages);
+	std::vector<SecondOrderSection<> > sections(channels * stages);
+	for (std::size_t c = 0; c < channels; ++c) {
+		for (std::size_t s = 0; s < stages; ++s) {
+			const LinearSpringDamper<> sd(Kilograms(0.005 * (s + 1)), NewtonsPerMeter(1000 + 300.0 * c),
+				NewtonSecondsPerMeter(0.02 * (c % 5)));
+			SecondOrderSection<> section = compileBiquad(sd, Seconds(dt), s == 1 ? VelocityResponse : DisplacementResponse);
+			// Keep the cascade's gain reasonable, and give one stage a direct path
+			section.b0 = s == 2 ? 0.25 : 0.0;
+			section.b1 *= 1000;
+			section.b2 *= 1000;
+			bank.setSection(c, s, section);
+			sections[c * stages + s] = section;
+		}
+	}
+	BOOST_CHECK_EQUAL(bank.section(3, 1).a1, sections[3 * stages + 1].a1);
+
+	std::vector<double> input(channels * frames), output(channels * frames);
+	for (std::size_t i = 0; i < input.size(); ++i) {
+		input[i] = std::sin(0.37 * i) + (i % 211 == 0 ? 5.0 : 0.0);
+	}
+	// In two calls, the second in place
+	std::vector<double> result(input);
+	bank.process(input.data(), result.data(), frames / 2);
+	bank.process(result.data() + channels * (frames / 2), result.data() + channels * (frames / 2), frames - frames / 2);
+
+	for (std::size_t c = 0; c < channels; ++c) {
+		std::vector<TransposedForm> reference(stages);
+		std::vector<double> expected(frames);
+		double power = 0;
+		for (std::size_t n = 0; n < frames; ++n) {
+			double x = input[n * channels + c];
+			for (std::size_t s = 0; s < stages; ++s) {
+				x = reference[s](sections[c * stages + s], x);
+			}
+			expected[n] = x;
+			power += x * x;
+		}
+		// Rounding error scales with the signal through the cascade's gain,
+		// not with each sample, so compare against the channel's RMS
+		const double rms = std::sqrt(power / frames);
+		for (std::size_t n = 0; n < frames; ++n) {
+			BOOST_CHECK_SMALL(result[n * channels + c] - expected[n], 1e-12 * rms);
+		}
+	}
+
+	// Resetting one channel leaves the others' state alone
+	bank.reset(4);
+	std::vector<double> zeros(channels, 0.0), next(channels);
+	bank.process(zeros.data(), next.data(), 1);
+	BOOST_CHECK_EQUAL(next[4], 0.0);
+	BOOST_CHECK_NE(next[5], 0.0);
+	bank.reset();
+	bank.process(zeros.data(), next.data(), 1);
+	BOOST_CHECK_EQUAL(next[5], 0.0);
+}
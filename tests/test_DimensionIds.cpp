@@ -0,0 +1,93 @@
+/** @file	test_DimensionIds.cpp
+	@brief	Dimension identifier test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE DimensionIds basic tests
+
+// Module to test
+#include <PhysicalModeling/DimensionIds.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling::DimensionedQuantities;
+
+// System includes
+#include <unordered_map>
+#include <set>
+#include <string>
+
+typedef Internal::multiply_dimensions<dims::mass, dims::accel>::type mass_times_accel;
+
+// Identifiers are compile-time constants
+static_assert(dimension_id<dims::dimensionless>::value == 0, "dimensionless is zero");
+static_assert(dimension_id<dims::force>::value == dimensionId(-2, 1, 1, 0), "force exponents");
+static_assert(dimension_id<mass_times_accel>::value == dimension_id<dims::force>::value, "equivalent vectors");
+
+static std::string classify(dimension_id_t id) {
+	switch (id) {
+		case dimension_id<dims::length>::value:
+			return "length";
+		case dimension_id<dims::force>::value:
+			return "force";
+		case dimension_id<dims::stiffness>::value:
+			return "stiffness";
+		default:
+			return "other";
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SwitchDispatch) {
+	BOOST_CHECK_EQUAL(classify(dimensionId(SI::Meters(1.0))), "length");
+	BOOST_CHECK_EQUAL(classify(dimensionId(SI::Newtons(1.0))), "force");
+	BOOST_CHECK_EQUAL(classify(dimensionId(SI::NewtonsPerMeter(1.0))), "stiffness");
+	BOOST_CHECK_EQUAL(classify(dimensionId(SI::Seconds(1.0))), "other");
+}
+
+BOOST_AUTO_TEST_CASE(IdsAreStable) {
+	// The packing is part of the interface: these must never change
+	BOOST_CHECK_EQUAL(dimension_id<dims::time>::value, 0x00000001u);
+	BOOST_CHECK_EQUAL(dimension_id<dims::length>::value, 0x00010000u);
+	BOOST_CHECK_EQUAL(dimension_id<dims::speed>::value, 0x000100ffu);
+	BOOST_CHECK_EQUAL(dimension_id<dims::force>::value, 0x000101feu);
+	BOOST_CHECK(dimension_id<dims::force>::value64 == dimension_id<dims::force>::value);
+}
+
+BOOST_AUTO_TEST_CASE(IdsAreDistinct) {
+	const dimension_id_t ids[] = {
+		dimension_id<dims::dimensionless>::value, dimension_id<dims::time>::value,
+		dimension_id<dims::mass>::value, dimension_id<dims::length>::value,
+		dimension_id<dims::angle>::value, dimension_id<dims::area>::value,
+		dimension_id<dims::volume>::value, dimension_id<dims::density>::value,
+		dimension_id<dims::speed>::value, dimension_id<dims::accel>::value,
+		dimension_id<dims::ang_speed>::value, dimension_id<dims::ang_accel>::value,
+		dimension_id<dims::force>::value, dimension_id<dims::stiffness>::value,
+		dimension_id<dims::viscosity>::value, dimension_id<dims::energy>::value,
+		dimension_id<dims::ang_stiffness>::value, dimension_id<dims::ang_viscosity>::value,
+		dimension_id<dims::moment_of_inertia>::value
+	};
+	const std::size_t n = sizeof(ids) / sizeof(ids[0]);
+	BOOST_CHECK_EQUAL(std::set<dimension_id_t>(ids, ids + n).size(), n);
+
+	std::set<std::size_t> hashes;
+	for (std::size_t i = 0; i < n; ++i) {
+		hashes.insert(dimensionHash(ids[i]));
+	}
+	BOOST_CHECK_EQUAL(hashes.size(), n);
+}
+
+BOOST_AUTO_TEST_CASE(HashTableLookup) {
+	std::unordered_map<dimension_id64_t, std::string, DimensionIdHash> handlers;
+	handlers[dimension_id<dims::force>::value64] = "force";
+	handlers[dimension_id<dims::torque>::value64] = "torque";
+	BOOST_CHECK_EQUAL(handlers[dimension_id<mass_times_accel>::value64], "force");
+	BOOST_CHECK_EQUAL(handlers.size(), 2u);
+	BOOST_CHECK_EQUAL(dimension_id<dims::force>::hash, DimensionIdHash()(dimension_id<dims::force>::value64));
+}
@@ -0,0 +1,67 @@
+/** @file	test_DimensionNames.cpp
+	@brief	Dimension name and unit string test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE DimensionNames basic tests
+
+// Module to test
+#include <PhysicalModeling/DimensionNames.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling::DimensionedQuantities;
+
+// System includes
+#include <string>
+
+// Everything is available at compile time
+static_assert(Internal::equal_strings(unit_string<dims::force>::value, "kg*m/s^2"), "force units");
+static_assert(Internal::equal_strings(dimension_name<dims::force>::value, "force"), "force name");
+
+BOOST_AUTO_TEST_CASE(UnitStrings) {
+	BOOST_CHECK_EQUAL(std::string(unit_string<dims::dimensionless>::value), "1");
+	BOOST_CHECK_EQUAL(std::string(unit_string<dims::length>::value), "m");
+	BOOST_CHECK_EQUAL(std::string(unit_string<dims::time>::value), "s");
+	BOOST_CHECK_EQUAL(std::string(unit_string<dims::force>::value), "kg*m/s^2");
+	BOOST_CHECK_EQUAL(std::string(unit_string<dims::density>::value), "kg/m^3");
+	BOOST_CHECK_EQUAL(std::string(unit_string<dims::ang_speed>::value), "rad/s");
+	BOOST_CHECK_EQUAL(std::string(unit_string<dims::viscosity>::value), "kg/s");
+	BOOST_CHECK_EQUAL(std::string(unit_string<dims::ang_stiffness>::value), "kg*m^2/(s^2*rad)");
+	BOOST_CHECK_EQUAL(std::string(unit_string<dims::moment_of_inertia>::value), "kg*m^2");
+}
+
+BOOST_AUTO_TEST_CASE(InverseUnitsHaveUnitNumerator) {
+	typedef Internal::divide_dimensions<dims::dimensionless, dims::time>::type frequency;
+	BOOST_CHECK_EQUAL(std::string(unit_string<frequency>::value), "1/s");
+	typedef Internal::divide_dimensions<dims::dimensionless, dims::area>::type per_area;
+	BOOST_CHECK_EQUAL(std::string(unit_string<per_area>::value), "1/m^2");
+}
+
+BOOST_AUTO_TEST_CASE(DimensionNames) {
+	BOOST_CHECK_EQUAL(std::string(dimension_name<dims::speed>::value), "speed");
+	BOOST_CHECK_EQUAL(std::string(dimension_name<dims::stiffness>::value), "stiffness");
+	BOOST_CHECK_EQUAL(std::string(dimension_name<dims::energy>::value), "energy");
+	// Torque is dimensionally identical to energy, so it has the same name
+	BOOST_CHECK_EQUAL(std::string(dimension_name<dims::torque>::value), "energy");
+	BOOST_CHECK_EQUAL(std::string(dimensionName(SI::NewtonMeters(1.0))), "energy");
+	// Derived dimensions are named like the typedef they match
+	typedef Internal::multiply_dimensions<dims::mass, dims::accel>::type mass_times_accel;
+	BOOST_CHECK_EQUAL(std::string(dimension_name<mass_times_accel>::value), "force");
+	// Unnamed dimensions fall back to their units
+	typedef Internal::multiply_dimensions<dims::force, dims::time>::type impulse;
+	BOOST_CHECK_EQUAL(std::string(dimension_name<impulse>::value), "kg*m/s");
+}
+
+BOOST_AUTO_TEST_CASE(QuantityHelpers) {
+	const SI::Newtons f(3.0);
+	BOOST_CHECK_EQUAL(std::string(unitString(f)), "kg*m/s^2");
+	BOOST_CHECK_EQUAL(std::string(dimensionName(SI::MetersPerSecond(1.0))), "speed");
+}
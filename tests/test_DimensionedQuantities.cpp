@@ -19,6 +19,8 @@
 #include <BoostTestTargetConfig.h>
 #include <boost/test/test_case_template.hpp>
 #include <boost/mpl/list.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/static_assert.hpp>
 
 
 using namespace boost::unit_test;
@@ -28,7 +30,7 @@ namespace dims = PhysicalModeling::DimensionedQuantities::dims;
 using namespace PhysicalModeling::DimensionedQuantities::SI;
 
 // System includes
-// - none
+#include <type_traits>
 
 typedef boost::mpl::list<
 	Kilograms,
@@ -42,7 +44,6 @@ typedef boost::mpl::list<
 	NewtonsPerMeter,
 	NewtonMetersPerRadian,
 	NewtonSecondsPerMeter,
-	KilogramsPerSecond,
 	NewtonMeterSecondsPerRadian,
 	KilogramMetersSquared
 	> shortcut_SI_types;
@@ -98,15 +99,136 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(SubtractTemplatedTypes, T, all_dimensions) {
 	Quantity<T> result = x1 - x2;
 }
 
-/*
 BOOST_AUTO_TEST_CASE(SimpleSqrtSanityChecks) {
 	Quantity<dims::area> area(25.0);
 	Quantity<dims::length> length = PhysicalModeling::DimensionedQuantities::sqrt(area);
+	BOOST_CHECK_EQUAL(length.value(), 5.0);
+
+	// Square root of a computed quantity: sqrt(K / m) is per second
+	Quantity<dims::stiffness> K(100.0);
+	Quantity<dims::mass> m(4.0);
+	Quantity<dims::dimensionless> cycles = PhysicalModeling::DimensionedQuantities::sqrt(K / m) * Quantity<dims::time>(2.0);
+	BOOST_CHECK_EQUAL(cycles.value(), 10.0);
 }
-*/
 
 BOOST_AUTO_TEST_CASE(SimpleConversionSanityChecks) {
 	Kilograms m(20);
 	MetersPerSecondSquared a(9.8);
 	Newtons F = m * a;
 }
+
+BOOST_AUTO_TEST_CASE(EquivalentShortcutTypes) {
+	// Aliases for the same dimensions are the same type, so they are only
+	// listed once in shortcut_SI_types above.
+	BOOST_STATIC_ASSERT((boost::is_same<NewtonSecondsPerMeter, KilogramsPerSecond>::value));
+	BOOST_STATIC_ASSERT((boost::is_same<NewtonMeters, Joules>::value));
+	KilogramsPerSecond b(2.0);
+	NewtonSecondsPerMeter b2 = b + b;
+	BOOST_CHECK_CLOSE(b2.value(), 4.0, 1e-9);
+}
+
+using PhysicalModeling::DimensionedQuantities::is_quantity;
+using PhysicalModeling::DimensionedQuantities::is_addable;
+using PhysicalModeling::DimensionedQuantities::is_subtractable;
+using PhysicalModeling::DimensionedQuantities::same_dimensions;
+using PhysicalModeling::DimensionedQuantities::has_sqrt;
+
+typedef decltype(Kilograms() * MetersPerSecondSquared()) ComputedForce;
+
+BOOST_AUTO_TEST_CASE(CompatibilityTraits) {
+	BOOST_STATIC_ASSERT((is_quantity<Meters>::value));
+	BOOST_STATIC_ASSERT((!is_quantity<double>::value));
+
+	BOOST_STATIC_ASSERT((same_dimensions<Newtons, ComputedForce>::value));
+	BOOST_STATIC_ASSERT((!same_dimensions<Newtons, Meters>::value));
+
+	// Detecting an invalid expression is not a hard error
+	BOOST_STATIC_ASSERT((is_addable<Meters, Meters>::value));
+	BOOST_STATIC_ASSERT((is_addable<Newtons, ComputedForce>::value));
+	BOOST_STATIC_ASSERT((!is_addable<Meters, Seconds>::value));
+	BOOST_STATIC_ASSERT((!is_addable<Meters, double>::value));
+	BOOST_STATIC_ASSERT((is_subtractable<ComputedForce, Newtons>::value));
+	BOOST_STATIC_ASSERT((!is_subtractable<Kilograms, Newtons>::value));
+
+	// Conversions exist only between equal dimensions
+	BOOST_STATIC_ASSERT((std::is_convertible<ComputedForce, Newtons>::value));
+	BOOST_STATIC_ASSERT((!std::is_convertible<ComputedForce, Meters>::value));
+	BOOST_STATIC_ASSERT((!std::is_constructible<Meters, Seconds>::value));
+
+	// Square roots need even exponents; odd ones are rejected, not truncated
+	typedef Quantity<dims::area> SquareMeters;
+	BOOST_STATIC_ASSERT((has_sqrt<SquareMeters>::value));
+	BOOST_STATIC_ASSERT((has_sqrt<decltype(NewtonsPerMeter() / Kilograms())>::value));
+	BOOST_STATIC_ASSERT((has_sqrt<Dimensionless>::value));
+	BOOST_STATIC_ASSERT((!has_sqrt<Meters>::value));
+	BOOST_STATIC_ASSERT((!has_sqrt<MetersPerSecond>::value));
+	BOOST_STATIC_ASSERT((std::is_convertible<decltype(PhysicalModeling::DimensionedQuantities::sqrt(SquareMeters())), Meters>::value));
+}
+
+BOOST_AUTO_TEST_CASE(AddComputedAndNamedDimensions) {
+	Newtons applied(1.0);
+	Newtons total = Kilograms(2.0) * MetersPerSecondSquared(3.0) + applied;
+	BOOST_CHECK_CLOSE(total.value(), 7.0, 1e-9);
+	total -= Kilograms(1.0) * MetersPerSecondSquared(1.0);
+	BOOST_CHECK_CLOSE(total.value(), 6.0, 1e-9);
+}
+
+// A generic kernel that picks an implementation by dimensional
+// compatibility, without instantiating the invalid one
+template <class Q1, class Q2>
+typename std::enable_if<is_addable<Q1, Q2>::value, int>::type
+combineKind(const Q1 &, const Q2 &) {
+	return 1;
+}
+
+template <class Q1, class Q2>
+typename std::enable_if<!is_addable<Q1, Q2>::value, int>::type
+combineKind(const Q1 &, const Q2 &) {
+	return 2;
+}
+
+BOOST_AUTO_TEST_CASE(DispatchOnCompatibility) {
+	BOOST_CHECK_EQUAL(combineKind(Meters(1.0), Meters(2.0)), 1);
+	BOOST_CHECK_EQUAL(combineKind(Newtons(1.0), Kilograms(1.0) * MetersPerSecondSquared(1.0)), 1);
+	BOOST_CHECK_EQUAL(combineKind(Meters(1.0), Seconds(2.0)), 2);
+}
+
+using PhysicalModeling::DimensionedQuantities::product_t;
+using PhysicalModeling::DimensionedQuantities::quotient_t;
+using PhysicalModeling::DimensionedQuantities::power_t;
+using PhysicalModeling::DimensionedQuantities::integral_t;
+using PhysicalModeling::DimensionedQuantities::derivative_t;
+
+BOOST_AUTO_TEST_CASE(DimensionAlgebraAliases) {
+	// Results are exactly the named types
+	BOOST_STATIC_ASSERT((boost::is_same<product_t<Kilograms, MetersPerSecondSquared>, Newtons>::value));
+	BOOST_STATIC_ASSERT((boost::is_same<quotient_t<Newtons, Meters>, NewtonsPerMeter>::value));
+	BOOST_STATIC_ASSERT((boost::is_same<power_t<Meters, 2>, Quantity<dims::area> >::value));
+	BOOST_STATIC_ASSERT((boost::is_same<power_t<Meters, 0>, Dimensionless>::value));
+	BOOST_STATIC_ASSERT((boost::is_same<power_t<Seconds, -1>, quotient_t<Dimensionless, Seconds> >::value));
+	BOOST_STATIC_ASSERT((boost::is_same<integral_t<MetersPerSecond>, Meters>::value));
+	BOOST_STATIC_ASSERT((boost::is_same<integral_t<RadiansPerSecond>, Radians>::value));
+	BOOST_STATIC_ASSERT((boost::is_same<derivative_t<Meters>, MetersPerSecond>::value));
+	BOOST_STATIC_ASSERT((boost::is_same<derivative_t<derivative_t<Meters> >, MetersPerSecondSquared>::value));
+	BOOST_STATIC_ASSERT((boost::is_same<product_t<Quantity<dims::length, float>, Quantity<dims::length, float> >,
+		Quantity<dims::area, float> >::value));
+}
+
+BOOST_AUTO_TEST_CASE(GenericIntegration) {
+	using PhysicalModeling::DimensionedQuantities::integrate;
+	Meters dx = integrate(MetersPerSecond(2.0), Seconds(0.5));
+	BOOST_CHECK_CLOSE(dx.value(), 1.0, 1e-9);
+
+	// The same template for linear and angular state
+	Meters x[3] = {Meters(0.0), Meters(1.0), Meters(2.0)};
+	const MetersPerSecond v[3] = {MetersPerSecond(1.0), MetersPerSecond(-2.0), MetersPerSecond(4.0)};
+	integrate(x, v, Seconds(0.25), 3);
+	BOOST_CHECK_CLOSE(x[0].value(), 0.25, 1e-9);
+	BOOST_CHECK_CLOSE(x[1].value(), 0.5, 1e-9);
+	BOOST_CHECK_CLOSE(x[2].value(), 3.0, 1e-9);
+
+	Radians theta[1] = {Radians(1.0)};
+	const RadiansPerSecond omega[1] = {RadiansPerSecond(3.0)};
+	integrate(theta, omega, Seconds(0.5), 1);
+	BOOST_CHECK_CLOSE(theta[0].value(), 2.5, 1e-9);
+}
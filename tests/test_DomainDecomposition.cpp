@@ -0,0 +1,316 @@
+/** @file	test_DomainDecomposition.cpp
+	@brief	Distributed spring network domain decomposition test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE DomainDecomposition basic tests
+
+// Module to test
+#include <PhysicalModeling/DomainDecomposition.h>
+#include <PhysicalModeling/SoftBody.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// Test fixtures
+#include "SpringNetworkFixtures.h"
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <vector>
+#include <string>
+#include <sstream>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cstddef>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+	const SpringParameters<> structural(NewtonsPerMeter(200), NewtonSecondsPerMeter(0.05));
+	const SpringParameters<> shear(NewtonsPerMeter(50), NewtonSecondsPerMeter(0.01));
+	const SpringParameters<> bend(NewtonsPerMeter(10), NewtonSecondsPerMeter(0.01));
+	const std::size_t steps = 300;
+	/// Long enough for a descheduled peer, short enough that a dead one fails the test quickly
+	const std::chrono::seconds rankTimeout(10);
+
+	SoftBody<> makeCloth() {
+		return Fixtures::hangingCloth(12, true, Kilograms(0.01), structural, shear, bend);
+	}
+
+	std::string segmentName(const char * test) {
+		std::ostringstream name;
+		name << "/pm_" << test << "_" << getpid();
+		return name.str();
+	}
+
+	/// Step this rank's share of the cloth, gathering the result on rank 0
+	bool runRank(const std::string & segment, int rank, SpringNetwork<> & result) {
+		SharedMemoryTransport transport(segment, rank);
+		if (!transport.valid()) {
+			return false;
+		}
+		transport.setTimeout(rankTimeout);
+		SoftBody<> cloth = makeCloth();
+		DomainDecomposition<SharedMemoryTransport> domain(transport, cloth.network());
+		domain.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+		result = cloth.network();
+		return domain.step(Seconds(0.0002), steps / 3)
+			&& transport.barrier()
+			&& domain.step(Seconds(0.0002), steps - steps / 3)
+			&& domain.gather(result);
+	}
+
+	/// Reap forked ranks, killing any still running once rank 0 has failed
+	/// or they outlive it by a timeout; true if every one exited cleanly
+	bool reapRanks(const std::vector<pid_t> & children, bool failed) {
+		bool clean = true;
+		const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + rankTimeout;
+		for (std::size_t c = 0; c < children.size(); ++c) {
+			int status = 0;
+			pid_t done = waitpid(children[c], &status, WNOHANG);
+			while (done == 0 && !failed && std::chrono::steady_clock::now() < deadline) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				done = waitpid(children[c], &status, WNOHANG);
+			}
+			if (done == 0) {
+				kill(children[c], SIGKILL);
+				waitpid(children[c], &status, 0);
+				clean = false;
+			} else if (done != children[c] || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+				clean = false;
+				failed = true;
+			}
+		}
+		return clean;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ExchangeStreamsLargeMessages) {
+	const std::string segment = segmentName("exchange");
+	BOOST_REQUIRE(SharedMemoryTransport::create(segment, 2, 64));
+	std::vector<int> fromZero(1000), fromOne(700), atZero(700), atOne(1000);
+	for (std::size_t i = 0; i < fromZero.size(); ++i) {
+		fromZero[i] = int(i);
+	}
+	for (std::size_t i = 0; i < fromOne.size(); ++i) {
+		fromOne[i] = -int(i);
+	}
+	std::thread other([&] {
+		SharedMemoryTransport transport(segment, 1);
+		transport.exchange(0, fromOne.data(), fromOne.size() * sizeof(int), atOne.data(), atOne.size() * sizeof(int));
+		transport.barrier();
+	});
+	SharedMemoryTransport transport(segment, 0);
+	BOOST_REQUIRE(transport.valid());
+	BOOST_CHECK_EQUAL(transport.size(), 2);
+	transport.exchange(1, fromZero.data(), fromZero.size() * sizeof(int), atZero.data(), atZero.size() * sizeof(int));
+	transport.barrier();
+	other.join();
+	SharedMemoryTransport::remove(segment);
+
+	BOOST_CHECK(atZero == fromOne);
+	BOOST_CHECK(atOne == fromZero);
+	BOOST_CHECK(!SharedMemoryTransport(segment, 0).valid());
+}
+
+BOOST_AUTO_TEST_CASE(MissingPeerTimesOut) {
+	const std::string segment = segmentName("timeout");
+	BOOST_REQUIRE(SharedMemoryTransport::create(segment, 2));
+	SharedMemoryTransport transport(segment, 0);
+	SharedMemoryTransport::remove(segment);
+	BOOST_REQUIRE(transport.valid());
+	transport.setTimeout(std::chrono::milliseconds(20));
+	int out = 1, in = 0;
+	BOOST_CHECK(!transport.exchange(1, &out, sizeof(out), &in, sizeof(in)));
+	BOOST_CHECK(!transport.valid());
+	BOOST_CHECK(!transport.barrier());
+}
+
+BOOST_AUTO_TEST_CASE(SingleRankMatchesSoftBody) {
+	const std::string segment = segmentName("single");
+	BOOST_REQUIRE(SharedMemoryTransport::create(segment, 1));
+	SpringNetwork<> result;
+	BOOST_REQUIRE(runRank(segment, 0, result));
+	SharedMemoryTransport::remove(segment);
+
+	SoftBody<> cloth = makeCloth();
+	for (std::size_t i = 0; i < steps; ++i) {
+		cloth.step(Seconds(0.0002));
+	}
+	for (std::size_t i = 0; i < cloth.nodeCount(); ++i) {
+		BOOST_CHECK_SMALL(result.y[i] - cloth.network().y[i], 1e-12);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ProcessesMatchSoftBody) {
+	SoftBody<> cloth = makeCloth();
+	for (std::size_t i = 0; i < steps; ++i) {
+		cloth.step(Seconds(0.0002));
+	}
+	const SpringNetwork<> & expected = cloth.network();
+	BOOST_CHECK_LT(expected.y[cloth.nodeCount() / 2], -1e-3);
+
+	for (int ranks = 2; ranks <= 4; ++ranks) {
+		const std::string segment = segmentName("processes");
+		BOOST_REQUIRE(SharedMemoryTransport::create(segment, ranks));
+		std::vector<pid_t> children;
+		for (int rank = 1; rank < ranks; ++rank) {
+			const pid_t pid = fork();
+			if (pid == 0) {
+				SpringNetwork<> ignored;
+				_exit(runRank(segment, rank, ignored) ? 0 : 1);
+			}
+			BOOST_REQUIRE_GT(pid, 0);
+			children.push_back(pid);
+		}
+
+		// A rank that dies makes the others time out rather than hang
+		SpringNetwork<> result;
+		const bool ran = runRank(segment, 0, result);
+		BOOST_CHECK(reapRanks(children, !ran));
+		SharedMemoryTransport::remove(segment);
+		BOOST_REQUIRE(ran);
+
+		for (std::size_t i = 0; i < cloth.nodeCount(); ++i) {
+			BOOST_CHECK_SMALL(result.x[i] - expected.x[i], 1e-12);
+			BOOST_CHECK_SMALL(result.y[i] - expected.y[i], 1e-12);
+			BOOST_CHECK_SMALL(result.z[i] - expected.z[i], 1e-12);
+			BOOST_CHECK_SMALL(result.vy[i] - expected.vy[i], 1e-9);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SubdomainsShareOnlyBoundaries) {
+	const std::string segment = segmentName("subdomains");
+	BOOST_REQUIRE(SharedMemoryTransport::create(segment, 3));
+	const SoftBody<> cloth(SoftBodyMesh<>::grid(24, 24, Meters(0.01), Kilograms(0.1)), structural, shear, bend);
+	std::vector<std::thread> others;
+	for (int rank = 0; rank < 3; rank += 2) {
+		others.push_back(std::thread([&, rank] {
+			SharedMemoryTransport transport(segment, rank);
+			transport.setTimeout(rankTimeout);
+			DomainDecomposition<SharedMemoryTransport> domain(transport, cloth.network());
+		}));
+	}
+	SharedMemoryTransport transport(segment, 1);
+	BOOST_REQUIRE(transport.valid());
+	transport.setTimeout(rankTimeout);
+	DomainDecomposition<SharedMemoryTransport> domain(transport, cloth.network());
+	for (std::size_t t = 0; t < others.size(); ++t) {
+		others[t].join();
+	}
+	SharedMemoryTransport::remove(segment);
+	BOOST_REQUIRE(domain.valid());
+
+	// The middle strip of three touches both others, through a thin halo
+	BOOST_CHECK_EQUAL(domain.neighborCount(), 2u);
+	BOOST_CHECK_GT(domain.ownedCount(), cloth.nodeCount() / 4);
+	BOOST_CHECK_LT(domain.haloCount(), domain.ownedCount() / 2);
+	for (std::size_t l = 0; l < domain.subdomain().nodeCount(); ++l) {
+		BOOST_CHECK_LT(domain.globalIndex(l), cloth.nodeCount());
+	}
+}
+
+namespace {
+	const std::size_t chainNodes = 30;
+
+	/// Rank's block of a hanging chain, generated without the rest of the chain
+	SpringSubdomain<> chainBlock(int rank, int ranks) {
+		const std::size_t first = chainNodes * rank / ranks;
+		const std::size_t last = chainNodes * (rank + 1) / ranks;
+		SpringSubdomain<> sub;
+		sub.owned = last - first;
+		for (std::size_t i = first; i < last; ++i) {
+			sub.global.push_back(i);
+		}
+		if (last < chainNodes) {
+			sub.global.push_back(last);
+			sub.haloOwner.push_back(rank + 1);
+		}
+		SpringNetwork<> & net = sub.network;
+		net.resizeNodes(sub.global.size());
+		for (std::size_t l = 0; l < sub.global.size(); ++l) {
+			net.x[l] = 0.01 * double(sub.global[l]);
+			net.invMass[l] = sub.global[l] == 0 ? 0 : 100;
+		}
+		for (std::size_t l = 0; l + 1 < sub.global.size(); ++l) {
+			net.a.push_back(l);
+			net.b.push_back(l + 1);
+			net.rest.push_back(0.01);
+			net.K.push_back(100);
+			net.B.push_back(0.01);
+		}
+		return sub;
+	}
+
+	/// Step a chain split across ranks threads, each loading only its block
+	bool runChain(int ranks, SpringNetwork<> & result) {
+		const std::string segment = segmentName("chain");
+		if (!SharedMemoryTransport::create(segment, ranks)) {
+			return false;
+		}
+		std::vector<char> ok(ranks, 0);
+		std::vector<std::thread> threads;
+		for (int rank = 0; rank < ranks; ++rank) {
+			threads.push_back(std::thread([&, rank] {
+				SharedMemoryTransport transport(segment, rank);
+				transport.setTimeout(rankTimeout);
+				DomainDecomposition<SharedMemoryTransport> domain(transport, chainBlock(rank, ranks));
+				domain.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+				ok[rank] = domain.valid() && domain.step(Seconds(0.0005), 200) && domain.gather(result);
+			}));
+		}
+		for (int rank = 0; rank < ranks; ++rank) {
+			threads[rank].join();
+		}
+		SharedMemoryTransport::remove(segment);
+		return std::find(ok.begin(), ok.end(), 0) == ok.end();
+	}
+}
+
+BOOST_AUTO_TEST_CASE(RanksLoadOnlyTheirSubdomain) {
+	SpringNetwork<> expected;
+	expected.resizeNodes(chainNodes);
+	BOOST_REQUIRE(runChain(1, expected));
+	BOOST_CHECK_LT(expected.y[chainNodes - 1], -1e-3);
+
+	SpringNetwork<> result;
+	result.resizeNodes(chainNodes);
+	BOOST_REQUIRE(runChain(3, result));
+	for (std::size_t i = 0; i < chainNodes; ++i) {
+		BOOST_CHECK_SMALL(result.x[i] - expected.x[i], 1e-12);
+		BOOST_CHECK_SMALL(result.y[i] - expected.y[i], 1e-12);
+		BOOST_CHECK_SMALL(result.vy[i] - expected.vy[i], 1e-9);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(InconsistentSubdomainIsInvalid) {
+	const std::string segment = segmentName("inconsistent");
+	BOOST_REQUIRE(SharedMemoryTransport::create(segment, 2));
+	std::thread other([&] {
+		// Claims a halo node from rank 1 that rank 1 does not own
+		SpringSubdomain<> sub = chainBlock(0, 2);
+		sub.global.back() = chainNodes;
+		SharedMemoryTransport transport(segment, 0);
+		transport.setTimeout(rankTimeout);
+		DomainDecomposition<SharedMemoryTransport> domain(transport, sub);
+	});
+	SharedMemoryTransport transport(segment, 1);
+	transport.setTimeout(rankTimeout);
+	DomainDecomposition<SharedMemoryTransport> domain(transport, chainBlock(1, 2));
+	other.join();
+	SharedMemoryTransport::remove(segment);
+	BOOST_CHECK(!domain.valid());
+	BOOST_CHECK(!domain.step(Seconds(0.0005)));
+}
@@ -0,0 +1,49 @@
+/** @file	test_ExternTemplates.cpp
+	@brief	Compiled library test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE ExternTemplates basic tests
+
+// Module to test
+#include <PhysicalModeling/ExternTemplates.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+// - none
+
+BOOST_AUTO_TEST_CASE(QuantitiesLinkFromLibrary) {
+	Meters x(1.5);
+	Meters y = x + Meters(0.5);
+	BOOST_CHECK_CLOSE(y.value(), 2.0, 1e-12);
+	Joules e(2.0);
+	NewtonMeters t(e);
+	BOOST_CHECK_CLOSE(t.value(), 2.0, 1e-12);
+}
+
+template<class Precision>
+void checkSpring() {
+	LinearSpringDamper<Precision> spring(
+		typename LinearSpringDamper<Precision>::mass_t(Precision(1)),
+		typename LinearSpringDamper<Precision>::stiffness_t(Precision(10)),
+		typename LinearSpringDamper<Precision>::viscosity_t(Precision(1)));
+	spring.setDisplacement(typename LinearSpringDamper<Precision>::length_t(Precision(0.5)));
+	spring.setVelocity(typename LinearSpringDamper<Precision>::speed_t(Precision(2)));
+	BOOST_CHECK_CLOSE(spring.force().value(), Precision(-7), Precision(1e-4));
+}
+
+BOOST_AUTO_TEST_CASE(SpringDampersLinkFromLibrary) {
+	checkSpring<float>();
+	checkSpring<double>();
+}
@@ -0,0 +1,160 @@
+/** @file	test_FrequencyAnalysis.cpp
+	@brief	Frequency-domain analysis test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE FrequencyAnalysis basic tests
+
+// Module to test
+#include <PhysicalModeling/FrequencyAnalysis.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <vector>
+#include <complex>
+#include <cmath>
+
+namespace {
+	const double pi = std::acos(-1.0);
+
+	/// A row of point masses along x, joined by springs, with node 0 pinned
+	SpringNetwork<> chain(std::size_t nodes, double mass, double K, double B) {
+		SpringNetwork<> net;
+		net.resizeNodes(nodes);
+		for (std::size_t i = 0; i < nodes; ++i) {
+			net.x[i] = 0.1 * i;
+			net.invMass[i] = i == 0 ? 0.0 : 1.0 / mass;
+		}
+		for (std::size_t i = 0; i + 1 < nodes; ++i) {
+			net.a.push_back(i);
+			net.b.push_back(i + 1);
+			net.rest.push_back(0.1);
+			net.K.push_back(K);
+			net.B.push_back(B);
+		}
+		return net;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SingleSystem) {
+	const LinearSpringDamper<> sd(Kilograms(1), NewtonsPerMeter(100), NewtonSecondsPerMeter(4));
+	const RadiansPerSecond wn = naturalFrequency(sd);
+	const Dimensionless zeta = dampingRatio(sd);
+	BOOST_CHECK_CLOSE(wn.value(), 10.0, 1e-12);
+	BOOST_CHECK_CLOSE(zeta.value(), 0.2, 1e-12);
+	BOOST_CHECK_CLOSE(dampedFrequency(sd).value(), 10.0 * std::sqrt(0.96), 1e-12);
+
+	const std::pair<std::complex<double>, std::complex<double> > p = poles(sd);
+	BOOST_CHECK_CLOSE(p.first.real(), -2.0, 1e-12);
+	BOOST_CHECK_CLOSE(p.first.imag(), std::sqrt(96.0), 1e-12);
+	BOOST_CHECK_CLOSE(p.second.imag(), -std::sqrt(96.0), 1e-12);
+	// Each pole is a root of m s^2 + B s + K
+	BOOST_CHECK_SMALL(std::abs(p.first * p.first + 4.0 * p.first + 100.0), 1e-10);
+
+	const LinearSpringDamper<> overdamped(Kilograms(1), NewtonsPerMeter(100), NewtonSecondsPerMeter(50));
+	BOOST_CHECK_EQUAL(dampedFrequency(overdamped).value(), 0.0);
+	BOOST_CHECK_EQUAL(poles(overdamped).first.imag(), 0.0);
+	BOOST_CHECK_SMALL(std::abs(poles(overdamped).second * poles(overdamped).second
+		+ 50.0 * poles(overdamped).second + 100.0), 1e-9);
+
+	// Static compliance 1/K, and at resonance 1/(B wn) a quarter cycle behind
+	BOOST_CHECK_CLOSE(complianceMagnitude(sd, RadiansPerSecond(0)).value(), 0.01, 1e-12);
+	BOOST_CHECK_SMALL(compliancePhase(sd, RadiansPerSecond(0)).value(), 1e-15);
+	BOOST_CHECK_CLOSE(complianceMagnitude(sd, wn).value(), 1.0 / 40.0, 1e-10);
+	BOOST_CHECK_CLOSE(compliancePhase(sd, wn).value(), -pi / 2, 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE(BatchedResponses) {
+	const LinearSpringDamper<> sd(Kilograms(0.3), NewtonsPerMeter(250), NewtonSecondsPerMeter(1.5));
+	// An odd count, so the last frequencies are a partial block
+	const std::size_t count = 37;
+	std::vector<double> omega(count), re(count), im(count);
+	for (std::size_t f = 0; f < count; ++f) {
+		omega[f] = 2.0 * f;
+	}
+	complianceResponse(sd, omega.data(), count, re.data(), im.data());
+	for (std::size_t f = 0; f < count; ++f) {
+		const std::complex<double> h = compliance(sd, RadiansPerSecond(omega[f]));
+		BOOST_CHECK_CLOSE(re[f], h.real(), 1e-9);
+		BOOST_CHECK_CLOSE(im[f], h.imag(), 1e-9);
+	}
+
+	std::vector<double> m(count), K(count), B(count), wn(count), zeta(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		m[i] = 0.1 + 0.05 * i;
+		K[i] = 100.0 + 10.0 * i;
+		B[i] = 0.2 * i;
+	}
+	naturalFrequencies(m.data(), K.data(), B.data(), count, wn.data(), zeta.data());
+	for (std::size_t i = 0; i < count; ++i) {
+		const LinearSpringDamper<> each(Kilograms(m[i]), NewtonsPerMeter(K[i]), NewtonSecondsPerMeter(B[i]));
+		BOOST_CHECK_CLOSE(wn[i], naturalFrequency(each).value(), 1e-10);
+		BOOST_CHECK_SMALL(zeta[i] - dampingRatio(each).value(), 1e-12);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SingleMassNetworkMatchesSpringDamper) {
+	const SpringNetwork<> net = chain(2, 0.5, 200, 2);
+	const NetworkModes<> modes(net);
+	BOOST_REQUIRE_EQUAL(modes.modeCount(), 3u);
+	// Only the axial direction is stiff
+	const LinearSpringDamper<> sd(Kilograms(0.5), NewtonsPerMeter(200), NewtonSecondsPerMeter(2));
+	BOOST_CHECK_SMALL(modes.naturalFrequency(0).value(), 1e-9);
+	BOOST_CHECK_CLOSE(modes.naturalFrequency(2).value(), naturalFrequency(sd).value(), 1e-10);
+	BOOST_CHECK_CLOSE(modes.dampingRatio(2).value(), dampingRatio(sd).value(), 1e-10);
+	BOOST_CHECK_EQUAL(modes.shape(2, 0, 0), 0.0);
+
+	const std::size_t count = 9;
+	std::vector<double> omega(count), re(count), im(count);
+	for (std::size_t f = 0; f < count; ++f) {
+		omega[f] = 5.0 * (f + 1);
+	}
+	modes.complianceResponse(1, 0, 1, 0, omega.data(), count, re.data(), im.data());
+	for (std::size_t f = 0; f < count; ++f) {
+		const std::complex<double> h = compliance(sd, RadiansPerSecond(omega[f]));
+		// One frequency is the resonance, where the real part vanishes
+		BOOST_CHECK_SMALL(std::abs(std::complex<double>(re[f], im[f]) - h), 1e-10 * std::abs(h));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(TwoMassChainModes) {
+	// Axial modes of pinned-mass-mass: omega^2 = (3 -+ sqrt 5) / 2 K / m
+	const double m = 0.2, K = 80;
+	const SpringNetwork<> net = chain(3, m, K, 0);
+	const NetworkModes<> modes(net);
+	BOOST_REQUIRE_EQUAL(modes.modeCount(), 6u);
+	BOOST_CHECK_CLOSE(modes.naturalFrequency(4).value(), std::sqrt((3 - std::sqrt(5.0)) / 2 * K / m), 1e-9);
+	BOOST_CHECK_CLOSE(modes.naturalFrequency(5).value(), std::sqrt((3 + std::sqrt(5.0)) / 2 * K / m), 1e-9);
+	for (std::size_t r = 0; r < 4; ++r) {
+		BOOST_CHECK_SMALL(modes.naturalFrequency(r).value(), 1e-6);
+	}
+
+	// Mass-normalized: phi^T M phi = 1
+	for (std::size_t r = 4; r < 6; ++r) {
+		const double s1 = modes.shape(r, 1, 0), s2 = modes.shape(r, 2, 0);
+		BOOST_CHECK_CLOSE(m * (s1 * s1 + s2 * s2), 1.0, 1e-9);
+	}
+
+	// Static compliance at the free end is the two springs in series
+	const double omega = 1e-3;
+	double re, im;
+	modes.complianceResponse(2, 0, 2, 0, &omega, 1, &re, &im);
+	BOOST_CHECK_CLOSE(re, 2.0 / K, 1e-4);
+	// and reciprocal between the two masses
+	double re12, im12, re21, im21;
+	const double drive = 7.0;
+	modes.complianceResponse(1, 0, 2, 0, &drive, 1, &re12, &im12);
+	modes.complianceResponse(2, 0, 1, 0, &drive, 1, &re21, &im21);
+	BOOST_CHECK_CLOSE(re12, re21, 1e-10);
+}
@@ -0,0 +1,69 @@
+/** @file	test_ImplicitSpringSolver.cpp
+	@brief	ImplicitSpringSolver test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE ImplicitSpringSolver basic tests
+
+// Module to test
+#include <PhysicalModeling/ImplicitSpringSolver.h>
+#include <PhysicalModeling/SoftBody.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// Test fixtures
+#include "SpringNetworkFixtures.h"
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <cmath>
+
+BOOST_AUTO_TEST_CASE(SettlesWithStepsLongerThanThePeriod) {
+	// Backward Euler damps what it cannot resolve, so steps past the 0.4 s period still settle
+	SpringNetwork<> net = Fixtures::hangingMass(50.0, 1.0);
+	ImplicitSpringSolver<> solver(net);
+	solver.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-Fixtures::gravity), MetersPerSecondSquared(0));
+	for (int i = 0; i < 40; ++i) {
+		solver.step(Seconds(0.5));
+		BOOST_REQUIRE(-net.y[1] - 0.1 < 2 * Fixtures::staticStretch(50.0));
+	}
+	BOOST_CHECK_CLOSE(-net.y[1] - 0.1, Fixtures::staticStretch(50.0), 0.5);
+	BOOST_CHECK_SMALL(net.vy[1], 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(StiffClothStableAtSixtyHertz) {
+	const SpringParameters<> stiff(NewtonsPerMeter(1e5), NewtonSecondsPerMeter(1));
+	SoftBody<> cloth(SoftBodyMesh<>::grid(20, 20, Meters(0.02), Kilograms(0.1)), stiff, stiff, stiff);
+	cloth.pin(0);
+	cloth.pin(19);
+	SoftBody<> reference(cloth);
+	ImplicitSpringSolver<> solver(cloth.network());
+	ImplicitSpringSolver<double, BlockJacobiPreconditioner<double> > jacobi(reference.network());
+	solver.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+	jacobi.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+	std::size_t total = 0, jacobiTotal = 0;
+	for (int i = 0; i < 60; ++i) {
+		total += solver.step(Seconds(1.0 / 60.0));
+		jacobiTotal += jacobi.step(Seconds(1.0 / 60.0));
+		BOOST_CHECK_LT(solver.lastIterations(), 150u);
+	}
+	BOOST_CHECK_LT(3 * total, jacobiTotal);
+
+	const SpringNetwork<> & net = cloth.network();
+	for (std::size_t i = 0; i < net.nodeCount(); ++i) {
+		BOOST_REQUIRE(std::fabs(net.x[i]) < 2.0 && std::fabs(net.y[i]) < 2.0);
+	}
+	Meters x, y, z;
+	cloth.position(399, x, y, z);
+	BOOST_CHECK_LT(y.value(), -0.1);
+	BOOST_CHECK_GE(solver.preconditioner().fullSetupCount(), 1u);
+}
@@ -0,0 +1,168 @@
+/** @file	test_ImpulseResponse.cpp
+	@brief	Impulse-response convolution test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE ImpulseResponse basic tests
+
+// Module to test
+#include <PhysicalModeling/ImpulseResponse.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <vector>
+#include <cmath>
+
+namespace {
+	const LinearSpringDamper<> sd(Kilograms(0.2), NewtonsPerMeter(800), NewtonSecondsPerMeter(1.2));
+	const double dt = 0.001;
+
+	/// A force trace with steps, ramps, and noise
+	std::vector<double> forceTrace(std::size_t count) {
+		std::vector<double> f(count);
+		unsigned state = 12345;
+		for (std::size_t n = 0; n < count; ++n) {
+			state = state * 1103515245u + 12345u;
+			f[n] = (n / 300 % 2 ? 1.0 : -0.5) + 0.001 * (n % 97) + 0.2 * ((state >> 16) / 65536.0 - 0.5);
+		}
+		return f;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ExactStepResponse) {
+	// A held unit force, from rest: x = (1 - exp(-zeta wn t) (cos wd t + zeta / sqrt(1 - zeta^2) sin wd t)) / K
+	const ImpulseResponse<> response(sd, Seconds(dt), 10);
+	BOOST_REQUIRE(response.recursive());
+	BOOST_CHECK_EQUAL(response[0], 0.0);
+	ResponseFilter<> filter(response);
+	const double wn = naturalFrequency(sd).value(), zeta = dampingRatio(sd).value();
+	const double wd = wn * std::sqrt(1 - zeta * zeta);
+	for (int n = 0; n < 2000; ++n) {
+		const double x = filter.process(1.0);
+		const double t = dt * n;
+		const double expected = (1 - std::exp(-zeta * wn * t) * (std::cos(wd * t) + zeta / std::sqrt(1 - zeta * zeta) * std::sin(wd * t))) / 800;
+		BOOST_CHECK_SMALL(x - expected, 1e-12);
+	}
+
+	// Also exact at periods longer than the system's own
+	const ImpulseResponse<> coarse(sd, Seconds(0.05), 10);
+	ResponseFilter<> coarseFilter(coarse);
+	double x = 0;
+	for (int n = 0; n <= 40; ++n) {
+		x = coarseFilter.process(1.0);
+	}
+	const double t = 0.05 * 40;
+	BOOST_CHECK_SMALL(x - (1 - std::exp(-zeta * wn * t) * (std::cos(wd * t) + zeta / std::sqrt(1 - zeta * zeta) * std::sin(wd * t))) / 800, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(ConvolutionMatchesDirectSum) {
+	// Neither length a multiple of the partition size
+	const std::size_t length = 700, count = 3001;
+	const ImpulseResponse<> response(sd, Seconds(dt), length);
+	BOOST_CHECK_EQUAL(response.length(), length);
+	const std::vector<double> force = forceTrace(count);
+	std::vector<double> direct(count, 0.0);
+	for (std::size_t n = 0; n < count; ++n) {
+		for (std::size_t k = 0; k < length && k <= n; ++k) {
+			direct[n] += response[k] * force[n - k];
+		}
+	}
+	// Sizes that are not powers of two are rounded up
+	const std::size_t blockSizes[] = { 64, 256, 1024, 0, 1, 100 };
+	for (std::size_t b = 0; b < sizeof(blockSizes) / sizeof(blockSizes[0]); ++b) {
+		std::vector<double> fast(count);
+		response.convolve(force.data(), count, fast.data(), blockSizes[b]);
+		for (std::size_t n = 0; n < count; ++n) {
+			BOOST_CHECK_SMALL(fast[n] - direct[n], 1e-14);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(RecursionMatchesConvolution) {
+	const std::size_t length = ImpulseResponse<>::decayLength(sd, Seconds(dt), 1e-12);
+	BOOST_CHECK_GT(length, 1000u);
+	BOOST_CHECK_LT(length, 10000u);
+	const ImpulseResponse<> response(sd, Seconds(dt), length);
+	const std::size_t count = 20000;
+	const std::vector<double> force = forceTrace(count);
+	std::vector<double> offline(count), online(count);
+	response.convolve(force.data(), count, offline.data());
+
+	// Online, in uneven chunks
+	ResponseFilter<> filter(response);
+	std::size_t done = 0;
+	for (std::size_t chunk = 1; done < count; chunk = chunk * 3 % 1000 + 1) {
+		const std::size_t n = std::min(chunk, count - done);
+		filter.process(force.data() + done, n, online.data() + done);
+		done += n;
+	}
+	for (std::size_t n = 0; n < count; ++n) {
+		BOOST_CHECK_SMALL(online[n] - offline[n], 1e-14);
+	}
+
+	filter.reset();
+	BOOST_CHECK_EQUAL(filter.process(1.0), 0.0);
+	BOOST_CHECK_EQUAL(ImpulseResponse<>::decayLength(LinearSpringDamper<>(Kilograms(1), NewtonsPerMeter(1)), Seconds(dt), 1e-6, 500), 500u);
+}
+
+BOOST_AUTO_TEST_CASE(MatchesFineIntegration) {
+	// Force held over each period, integrated with 100 substeps
+	const std::size_t count = 1000;
+	const std::vector<double> force = forceTrace(count);
+	const ImpulseResponse<> response(sd, Seconds(dt), 4000);
+	std::vector<double> fast(count);
+	response.convolve(force.data(), count, fast.data());
+
+	LinearSpringDamper<> element = sd;
+	double x = 0, v = 0;
+	const int substeps = 100;
+	const double h = dt / substeps;
+	for (std::size_t n = 0; n < count; ++n) {
+		BOOST_CHECK_SMALL(fast[n] - x, 2e-5);
+		for (int s = 0; s < substeps; ++s) {
+			element.setDisplacement(Meters(x));
+			element.setVelocity(MetersPerSecond(v));
+			v += h / 0.2 * (force[n] + element.force().value());
+			x += h * v;
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(NetworkResponse) {
+	// One free mass on a pinned spring is the same spring-damper
+	SpringNetwork<> net;
+	net.resizeNodes(2);
+	net.x[1] = 0.1;
+	net.invMass[1] = 1 / 0.2;
+	net.a.push_back(0);
+	net.b.push_back(1);
+	net.rest.push_back(0.1);
+	net.K.push_back(800);
+	net.B.push_back(1.2);
+	const NetworkModes<> modes(net);
+	const ImpulseResponse<> fromNetwork(modes, 1, 0, 1, 0, Seconds(dt), 500);
+	const ImpulseResponse<> fromElement(sd, Seconds(dt), 500);
+	BOOST_CHECK_EQUAL(fromNetwork.sections().size(), 1u);
+	for (std::size_t k = 0; k < 500; ++k) {
+		BOOST_CHECK_SMALL(fromNetwork[k] - fromElement[k], 1e-13);
+	}
+
+	// A precomputed response convolves but has no recursion
+	const ImpulseResponse<> measured(std::vector<double>(fromElement.length(), 0.5), Seconds(dt));
+	BOOST_CHECK(!measured.recursive());
+	const std::vector<double> ones(10, 1.0);
+	std::vector<double> out(10);
+	measured.convolve(ones.data(), 10, out.data(), 4);
+	BOOST_CHECK_CLOSE(out[9], 5.0, 1e-12);
+}
@@ -0,0 +1,49 @@
+/** @file	test_LinearSpringDamper.cpp
+	@brief	LinearSpringDamper test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE LinearSpringDamper basic tests
+
+// Module to test
+#include <PhysicalModeling/LinearSpringDamper.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using PhysicalModeling::LinearSpringDamper;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+// - none
+
+BOOST_AUTO_TEST_CASE(SpringForce) {
+	LinearSpringDamper<> sd(Kilograms(1.0), NewtonsPerMeter(100.0));
+	sd.setDisplacement(Meters(0.02));
+	BOOST_CHECK_CLOSE(sd.force().value(), -2.0, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(SpringDamperForce) {
+	LinearSpringDamper<> sd(Kilograms(1.0), NewtonsPerMeter(100.0), NewtonSecondsPerMeter(3.0));
+	sd.setDisplacement(Meters(0.02));
+	sd.setVelocity(MetersPerSecond(-1.0));
+	BOOST_CHECK_CLOSE(sd.force().value(), 1.0, 1e-9);
+
+	// cached force must be recomputed after a state change
+	sd.setDisplacement(Meters(0.0));
+	BOOST_CHECK_CLOSE(sd.force().value(), 3.0, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(FloatPrecision) {
+	typedef LinearSpringDamper<float> SpringDamper;
+	SpringDamper sd(SpringDamper::mass_t(1.0f), SpringDamper::stiffness_t(10.0f));
+	sd.setDisplacement(SpringDamper::length_t(0.5f));
+	BOOST_CHECK_CLOSE(sd.force().value(), -5.0f, 1e-4f);
+	BOOST_CHECK_EQUAL(sd.stiffness().value(), 10.0f);
+}
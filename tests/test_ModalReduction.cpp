@@ -0,0 +1,189 @@
+/** @file	test_ModalReduction.cpp
+	@brief	Modal reduction of spring networks test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE ModalReduction basic tests
+
+// Module to test
+#include <PhysicalModeling/ModalReduction.h>
+#include <PhysicalModeling/SoftBody.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <vector>
+#include <cmath>
+
+namespace {
+	const double pi = std::acos(-1.0);
+
+	/// A row of equal point masses along x joined by equal springs, with node 0 pinned
+	SpringNetwork<> chain(std::size_t nodes, double mass, double K, double B) {
+		SpringNetwork<> net;
+		net.resizeNodes(nodes);
+		for (std::size_t i = 0; i < nodes; ++i) {
+			net.x[i] = 0.1 * i;
+			net.invMass[i] = i == 0 ? 0.0 : 1.0 / mass;
+		}
+		for (std::size_t i = 0; i + 1 < nodes; ++i) {
+			net.a.push_back(i);
+			net.b.push_back(i + 1);
+			net.rest.push_back(0.1);
+			net.K.push_back(K);
+			net.B.push_back(B);
+		}
+		return net;
+	}
+
+	/// Semi-implicit Euler on the full network, as SoftBody steps
+	void stepFull(SpringNetwork<> & net, double h, double gx) {
+		const std::size_t n = net.nodeCount();
+		std::vector<double> fx(n, 0.0), fy(n, 0.0), fz(n, 0.0);
+		accumulateSpringForces(net, fx.data(), fy.data(), fz.data());
+		for (std::size_t i = 0; i < n; ++i) {
+			if (net.invMass[i] > 0) {
+				net.vx[i] += h * (net.invMass[i] * fx[i] + gx);
+				net.vy[i] += h * net.invMass[i] * fy[i];
+				net.vz[i] += h * net.invMass[i] * fz[i];
+				net.x[i] += h * net.vx[i];
+				net.y[i] += h * net.vy[i];
+				net.z[i] += h * net.vz[i];
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ChainFrequencies) {
+	// Fixed-free chain of N masses: omega_j = 2 sqrt(K / m) sin((2 j - 1) pi / (2 (2 N + 1)))
+	const std::size_t N = 12;
+	const double m = 0.05, K = 300;
+	const ModalSpringNetwork<> reduced(chain(N + 1, m, K, 0.1), 8);
+	BOOST_REQUIRE_EQUAL(reduced.modeCount(), 8u);
+	BOOST_CHECK_EQUAL(reduced.nodeCount(), N + 1);
+
+	// Sideways, a straight chain has no stiffness: 2 N zero-frequency modes come first
+	const ModalSpringNetwork<> axial(chain(N + 1, m, K, 0.1), 2 * N + 4);
+	BOOST_REQUIRE_EQUAL(axial.modeCount(), 2 * N + 4);
+	for (std::size_t r = 0; r < 2 * N; ++r) {
+		BOOST_CHECK_SMALL(axial.naturalFrequency(r).value(), 1e-4);
+	}
+	for (std::size_t j = 1; j <= 4; ++j) {
+		const double expected = 2 * std::sqrt(K / m) * std::sin((2 * j - 1) * pi / (2 * (2 * N + 1)));
+		BOOST_CHECK_CLOSE(axial.naturalFrequency(2 * N + j - 1).value(), expected, 1e-6);
+		// Proportional damping, B / K times the stiffness
+		BOOST_CHECK_CLOSE(axial.dampingRatio(2 * N + j - 1).value(), 0.5 * 0.1 / K * expected, 1e-6);
+		// All along x
+		BOOST_CHECK_SMALL(axial.shape(2 * N + j - 1, 3, 1), 1e-9);
+		BOOST_CHECK_EQUAL(axial.shape(2 * N + j - 1, 0, 0), 0.0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(MatchesDenseModes) {
+	// A crumpled cloth, so every direction is stiff somewhere
+	SoftBodyMesh<> mesh = SoftBodyMesh<>::grid(6, 6, Meters(0.02), Kilograms(0.05));
+	for (std::size_t i = 0; i < mesh.y.size(); ++i) {
+		mesh.y[i] = 0.004 * std::sin(1.7 * i) + 0.002 * std::cos(0.9 * i * i);
+	}
+	SoftBody<> cloth(mesh, SpringParameters<>(NewtonsPerMeter(400), NewtonSecondsPerMeter(0.05)),
+		SpringParameters<>(NewtonsPerMeter(100), NewtonSecondsPerMeter(0.01)),
+		SpringParameters<>(NewtonsPerMeter(20), NewtonSecondsPerMeter(0.01)));
+	cloth.pin(0);
+	cloth.pin(5);
+	cloth.pin(33);
+
+	const NetworkModes<> dense(cloth.network());
+	const std::size_t k = 10;
+	const ModalSpringNetwork<> reduced(cloth.network(), k);
+	BOOST_REQUIRE_EQUAL(reduced.modeCount(), k);
+	const double scale = dense.naturalFrequency(dense.modeCount() - 1).value();
+	for (std::size_t r = 0; r < k; ++r) {
+		BOOST_CHECK_SMALL(reduced.naturalFrequency(r).value() - dense.naturalFrequency(r).value(), 1e-8 * scale);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(AllModesMatchFullSimulation) {
+	// Axial motion of a chain is exactly linear, so keeping every mode reproduces the full model
+	SpringNetwork<> full = chain(6, 0.1, 200, 0.3);
+	for (std::size_t i = 1; i < full.nodeCount(); ++i) {
+		full.vx[i] = 0.05 * i;
+	}
+	ModalSpringNetwork<> reduced(full, 3 * (full.nodeCount() - 1));
+	BOOST_REQUIRE_EQUAL(reduced.modeCount(), 15u);
+	reduced.setGravity(MetersPerSecondSquared(9.81), MetersPerSecondSquared(0), MetersPerSecondSquared(0));
+
+	const double h = 0.0005;
+	for (int k = 0; k < 2000; ++k) {
+		stepFull(full, h, 9.81);
+		reduced.step(Seconds(h));
+	}
+	SpringNetwork<> result = full;
+	reduced.reconstruct(result);
+	for (std::size_t i = 0; i < full.nodeCount(); ++i) {
+		BOOST_CHECK_SMALL(result.x[i] - full.x[i], 1e-9);
+		BOOST_CHECK_SMALL(result.vx[i] - full.vx[i], 1e-8);
+		BOOST_CHECK_SMALL(result.y[i] - full.y[i], 1e-12);
+		Meters px, py, pz;
+		reduced.position(i, px, py, pz);
+		BOOST_CHECK_EQUAL(px.value(), result.x[i]);
+		MetersPerSecond vx, vy, vz;
+		reduced.velocity(i, vx, vy, vz);
+		BOOST_CHECK_EQUAL(vx.value(), result.vx[i]);
+	}
+	// Hanging: the free end has sagged
+	BOOST_CHECK_GT(full.x[5], 0.5 + 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE(ExternalForceSettles) {
+	// Pull the free end of a damped chain, keeping its lowest four axial modes
+	const std::size_t nodes = 9;
+	const double K = 500;
+	ModalSpringNetwork<> reduced(chain(nodes, 0.02, K, 2), 2 * (nodes - 1) + 4);
+	reduced.setExternalForce(nodes - 1, Newtons(1), Newtons(0), Newtons(0));
+	reduced.setExternalForce(nodes - 1, Newtons(2), Newtons(0), Newtons(0));
+	for (int k = 0; k < 20000; ++k) {
+		reduced.step(Seconds(0.0002));
+	}
+	Meters px, py, pz;
+	reduced.position(nodes - 1, px, py, pz);
+	// It settles near the static stretch: the truncated modes would add the rest
+	const double stretch = px.value() - 0.1 * (nodes - 1), exact = 2.0 * (nodes - 1) / K;
+	BOOST_CHECK_LT(stretch, exact);
+	BOOST_CHECK_GT(stretch, 0.9 * exact);
+	reduced.position(0, px, py, pz);
+	BOOST_CHECK_EQUAL(px.value(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(NoModesKept) {
+	// Asking for no modes, or pinning every node, leaves a reduced model that stays at its reference
+	SpringNetwork<> net = chain(2, 0.1, 100, 0.1);
+	net.vx[1] = 0.5;
+	SpringNetwork<> pinned = net;
+	pinned.invMass[1] = 0;
+	ModalSpringNetwork<> none(net, 0);
+	ModalSpringNetwork<> stuck(pinned, 4);
+	BOOST_REQUIRE_EQUAL(none.modeCount(), 0u);
+	BOOST_REQUIRE_EQUAL(stuck.modeCount(), 0u);
+	none.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+	none.setExternalForce(1, Newtons(1), Newtons(0), Newtons(0));
+	stuck.setExternalForce(1, Newtons(1), Newtons(0), Newtons(0));
+	none.step(Seconds(0.001));
+	stuck.step(Seconds(0.001));
+	SpringNetwork<> result = net;
+	none.reconstruct(result);
+	BOOST_CHECK_EQUAL(result.x[1], 0.1);
+	BOOST_CHECK_EQUAL(result.vx[1], 0.0);
+	Meters px, py, pz;
+	stuck.position(1, px, py, pz);
+	BOOST_CHECK_EQUAL(px.value(), 0.1);
+}
@@ -0,0 +1,146 @@
+/** @file	test_MultiRateIntegrator.cpp
+	@brief	MultiRateIntegrator test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE MultiRateIntegrator basic tests
+
+// Module to test
+#include <PhysicalModeling/MultiRateIntegrator.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <cmath>
+#include <algorithm>
+
+/// Horizontal chain of n nodes, 0.1 m apart, first node pinned; spring
+/// `stiffSpring` has stiffness stiffK and the rest have softK.
+static SpringNetwork<> makeChain(std::size_t n, double softK, double stiffK, std::size_t stiffSpring) {
+	SpringNetwork<> net;
+	net.resizeNodes(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		net.x[i] = 0.1 * double(i);
+		net.invMass[i] = i == 0 ? 0.0 : 1.0 / 0.01;
+	}
+	for (std::size_t i = 0; i + 1 < n; ++i) {
+		net.a.push_back(i);
+		net.b.push_back(i + 1);
+		net.rest.push_back(0.1);
+		net.K.push_back(i == stiffSpring ? stiffK : softK);
+		net.B.push_back(0.0);
+	}
+	return net;
+}
+
+static double energy(const SpringNetwork<> & net) {
+	double e = 0;
+	for (std::size_t i = 0; i < net.nodeCount(); ++i) {
+		if (net.invMass[i] > 0) {
+			e += 0.5 / net.invMass[i] * (net.vx[i] * net.vx[i] + net.vy[i] * net.vy[i] + net.vz[i] * net.vz[i]);
+		}
+	}
+	for (std::size_t s = 0; s < net.springCount(); ++s) {
+		const double dx = net.x[net.b[s]] - net.x[net.a[s]];
+		const double dy = net.y[net.b[s]] - net.y[net.a[s]];
+		const double dz = net.z[net.b[s]] - net.z[net.a[s]];
+		const double stretch = std::sqrt(dx * dx + dy * dy + dz * dz) - net.rest[s];
+		e += 0.5 * net.K[s] * stretch * stretch;
+	}
+	return e;
+}
+
+BOOST_AUTO_TEST_CASE(StiffSpringsGetFasterClasses) {
+	SpringNetwork<> net = makeChain(20, 10.0, 1e6, 10);
+	MultiRateIntegrator<> integrator(net, Seconds(0.01));
+
+	BOOST_CHECK_EQUAL(integrator.springClass(0), 0u);
+	BOOST_CHECK_GT(integrator.springClass(10), integrator.springClass(0));
+	BOOST_CHECK_EQUAL(integrator.classCount(), integrator.springClass(10) + 1);
+	for (std::size_t s = 0; s < net.springCount(); ++s) {
+		const std::size_t c = integrator.springClass(s);
+		BOOST_CHECK_LE(integrator.classStep(c).value(), integrator.stableStep(s).value());
+		BOOST_CHECK_CLOSE(integrator.classStep(c).value() * double(1 << c), 0.01, 1e-9);
+	}
+
+	std::size_t total = 0;
+	for (std::size_t c = 0; c < integrator.classCount(); ++c) {
+		total += integrator.classSize(c);
+	}
+	BOOST_CHECK_EQUAL(total, net.springCount());
+}
+
+BOOST_AUTO_TEST_CASE(EachSpringEvaluatedAtItsOwnRate) {
+	// Two kicks per step of its class: a class-c spring costs 2^(c+1) per coarse step
+	SpringNetwork<> net = makeChain(30, 10.0, 1e6, 12);
+	net.K[25] = 1e4;
+	MultiRateIntegrator<> integrator(net, Seconds(0.01));
+	BOOST_REQUIRE_GT(integrator.springClass(12), integrator.springClass(25));
+	BOOST_REQUIRE_GT(integrator.springClass(25), 0u);
+	std::size_t expected = 0;
+	for (std::size_t s = 0; s < net.springCount(); ++s) {
+		expected += std::size_t(2) << integrator.springClass(s);
+	}
+	for (int i = 0; i < 3; ++i) {
+		integrator.step();
+		BOOST_CHECK_EQUAL(integrator.lastSpringEvaluations(), expected);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(StableWithLessWork) {
+	SpringNetwork<> net = makeChain(40, 10.0, 1e6, 20);
+	// Disturb the soft chain and the stiff spring
+	for (std::size_t i = 1; i < net.nodeCount(); ++i) {
+		net.vy[i] = 0.1 * std::sin(double(i));
+	}
+	net.x[21] += 1e-4;
+	const double e0 = energy(net);
+
+	MultiRateIntegrator<> integrator(net, Seconds(0.01));
+	BOOST_REQUIRE_GT(integrator.classCount(), 3u);
+	// Verlet energy oscillates about the true value but must not grow
+	double peak = 0;
+	for (int i = 0; i < 500; ++i) {
+		integrator.step();
+		peak = std::max(peak, energy(net));
+	}
+	BOOST_CHECK_LT(peak, 2 * e0);
+	BOOST_CHECK_LT(4 * integrator.lastSpringEvaluations(), integrator.uniformSpringEvaluations());
+}
+
+BOOST_AUTO_TEST_CASE(MatchesSingleRateSolution) {
+	SpringNetwork<> multi = makeChain(10, 10.0, 1e4, 5);
+	for (std::size_t i = 1; i < multi.nodeCount(); ++i) {
+		multi.vy[i] = 0.05 * double(i);
+	}
+	SpringNetwork<> single = multi;
+
+	MultiRateIntegrator<> multiRate(multi, Seconds(0.01));
+	BOOST_REQUIRE_GT(multiRate.classCount(), 1u);
+
+	// Single rate: a coarse step small enough that everything is class 0
+	const std::size_t substeps = std::size_t(1) << (multiRate.classCount() - 1);
+	MultiRateIntegrator<> singleRate(single, Seconds(0.01 / double(substeps)));
+	BOOST_REQUIRE_EQUAL(singleRate.classCount(), 1u);
+
+	for (int i = 0; i < 50; ++i) {
+		multiRate.step();
+		for (std::size_t k = 0; k < substeps; ++k) {
+			singleRate.step();
+		}
+	}
+	for (std::size_t i = 0; i < multi.nodeCount(); ++i) {
+		BOOST_CHECK_SMALL(multi.x[i] - single.x[i], 2e-3);
+		BOOST_CHECK_SMALL(multi.y[i] - single.y[i], 2e-3);
+	}
+}
@@ -0,0 +1,139 @@
+/** @file	test_MultigridPreconditioner.cpp
+	@brief	MultigridPreconditioner test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE MultigridPreconditioner basic tests
+
+// Module to test
+#include <PhysicalModeling/MultigridPreconditioner.h>
+#include <PhysicalModeling/SoftBody.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <vector>
+
+namespace {
+	const double h = 1.0 / 60.0;
+	const SpringParameters<> stiff(NewtonsPerMeter(1e4), NewtonSecondsPerMeter(0.1));
+
+	void stiffClothSystem(std::size_t n, SpringNetwork<> & net, BlockSparseMatrix<> & A, std::vector<double> & b) {
+		SoftBody<> cloth(SoftBodyMesh<>::grid(n, n, Meters(1.0 / n), Kilograms(1.0)), stiff, stiff, stiff);
+		cloth.pin(0);
+		cloth.pin(n - 1);
+		net = cloth.network();
+		assembleSpringSystem(net, 1.0, h, h * h, A);
+		// In-plane load: out-of-plane dofs of a flat cloth are trivial
+		b.assign(3 * net.nodeCount(), 0.0);
+		for (std::size_t i = 0; i < net.nodeCount(); ++i) {
+			if (net.invMass[i] > 0) {
+				b[3 * i] = 0.01 * ((i * 37) % 11) - 0.05;
+				b[3 * i + 2] = 0.01 * ((i * 53) % 13) - 0.06;
+			}
+		}
+	}
+
+	template<class Preconditioner>
+	std::size_t solve(const BlockSparseMatrix<> & A, const std::vector<double> & b, Preconditioner & pre) {
+		std::vector<double> x(b.size(), 0.0);
+		ConjugateGradientWorkspace<> ws;
+		return conjugateGradient(A, b, x, pre, 1e-6, 5000, ws);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(FewerIterationsThanJacobi) {
+	SpringNetwork<> net;
+	BlockSparseMatrix<> A;
+	std::vector<double> b;
+	stiffClothSystem(30, net, A, b);
+
+	BlockJacobiPreconditioner<> jacobi;
+	jacobi.setup(A);
+	MultigridPreconditioner<> mg;
+	mg.setup(A);
+	const std::size_t jacobiIterations = solve(A, b, jacobi);
+	const std::size_t mgIterations = solve(A, b, mg);
+	BOOST_CHECK_GT(mg.levelCount(), 1u);
+	BOOST_CHECK_LT(mgIterations, 25u);
+	BOOST_CHECK_LT(mgIterations * 5, jacobiIterations);
+}
+
+BOOST_AUTO_TEST_CASE(IterationsIndependentOfResolution) {
+	std::size_t iterations[2];
+	const std::size_t sizes[2] = {16, 48};
+	for (int k = 0; k < 2; ++k) {
+		SpringNetwork<> net;
+		BlockSparseMatrix<> A;
+		std::vector<double> b;
+		stiffClothSystem(sizes[k], net, A, b);
+		MultigridPreconditioner<> mg;
+		mg.setup(A);
+		iterations[k] = solve(A, b, mg);
+	}
+	// Nine times the nodes, nearly the same iteration count
+	BOOST_CHECK_LE(iterations[1], iterations[0] + 5);
+}
+
+BOOST_AUTO_TEST_CASE(IncrementalUpdateAfterTopologyChange) {
+	SpringNetwork<> net;
+	BlockSparseMatrix<> A;
+	std::vector<double> b;
+	stiffClothSystem(24, net, A, b);
+	MultigridPreconditioner<> mg;
+	mg.setup(A);
+	BOOST_CHECK_EQUAL(mg.fullSetupCount(), 1u);
+
+	// Attach a new node to the cloth with a new spring, and add a spring
+	// between two existing nodes
+	const std::size_t added = net.nodeCount();
+	net.resizeNodes(added + 1);
+	net.x[added] = net.x[100] + 0.02;
+	net.y[added] = 0.01;
+	net.z[added] = net.z[100];
+	net.invMass[added] = net.invMass[100];
+	net.a.push_back(100);
+	net.b.push_back(added);
+	net.rest.push_back(0.02);
+	net.K.push_back(1e4);
+	net.B.push_back(0.1);
+	net.a.push_back(10);
+	net.b.push_back(200);
+	net.rest.push_back(0.2);
+	net.K.push_back(1e4);
+	net.B.push_back(0.1);
+
+	assembleSpringSystem(net, 1.0, h, h * h, A);
+	mg.update(A);
+	BOOST_CHECK_EQUAL(mg.fullSetupCount(), 1u);
+	BOOST_CHECK_EQUAL(mg.aggregateOf(0, added), mg.aggregateOf(0, 100));
+
+	b.resize(3 * net.nodeCount(), 0.0);
+	b[3 * added] = 0.1;
+	BOOST_CHECK_LT(solve(A, b, mg), 30u);
+}
+
+BOOST_AUTO_TEST_CASE(StaleHierarchyIsRebuilt) {
+	SpringNetwork<> net;
+	BlockSparseMatrix<> A;
+	std::vector<double> b;
+	stiffClothSystem(10, net, A, b);
+	MultigridPreconditioner<> mg;
+	mg.setCoarsestSize(8);
+	mg.setMaxStaleUpdates(3);
+	mg.setup(A);
+	for (int i = 0; i < 4; ++i) {
+		mg.update(A);
+	}
+	BOOST_CHECK_EQUAL(mg.fullSetupCount(), 2u);
+}
@@ -0,0 +1,50 @@
+/** @file	test_PhysicalModelingModule.cpp
+	@brief	C++20 module test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE PhysicalModelingModule basic tests
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// System includes
+#include <string>
+
+// Module to test: imported after all textual includes
+import physical_modeling;
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities;
+
+BOOST_AUTO_TEST_CASE(QuantitiesFromModule) {
+	SI::Meters a(1.0), b(2.0);
+	SI::Meters c = a + b;
+	BOOST_CHECK_CLOSE(c.value(), 3.0, 1e-12);
+
+	Quantity<dims::force> f(4.0);
+	SI::Joules w = f * c;
+	BOOST_CHECK_CLOSE(w.value(), 12.0, 1e-12);
+
+	SI::MetersPerSecond v = c / SI::Seconds(2.0);
+	BOOST_CHECK_CLOSE(v.value(), 1.5, 1e-12);
+	BOOST_CHECK(a < b);
+}
+
+BOOST_AUTO_TEST_CASE(NamesAndIdsFromModule) {
+	BOOST_CHECK_EQUAL(std::string(unit_string<dims::force>::value), "kg*m/s^2");
+	BOOST_CHECK_EQUAL(dimension_id<dims::speed>::value, dimensionId(-1, 0, 1, 0));
+}
+
+BOOST_AUTO_TEST_CASE(SpringDamperFromModule) {
+	LinearSpringDamper<> spring(SI::Kilograms(1.0), SI::NewtonsPerMeter(10.0), SI::NewtonSecondsPerMeter(1.0));
+	spring.setDisplacement(SI::Meters(0.5));
+	spring.setVelocity(SI::MetersPerSecond(2.0));
+	BOOST_CHECK_CLOSE(spring.force().value(), -7.0, 1e-12);
+}
@@ -0,0 +1,113 @@
+/** @file	test_PositionBasedSolver.cpp
+	@brief	XpbdSolver test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE PositionBasedSolver basic tests
+
+// Module to test
+#include <PhysicalModeling/PositionBasedSolver.h>
+#include <PhysicalModeling/SoftBody.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// Test fixtures
+#include "SpringNetworkFixtures.h"
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <cmath>
+#include <set>
+
+BOOST_AUTO_TEST_CASE(ColoringSeparatesSharedNodes) {
+	const SpringParameters<> params(NewtonsPerMeter(100));
+	SoftBody<> cloth(SoftBodyMesh<>::grid(12, 12, Meters(0.01), Kilograms(0.1)), params, params, params);
+	XpbdSolver<> solver(cloth.network());
+	const SpringNetwork<> & net = cloth.network();
+
+	std::size_t total = 0;
+	for (std::size_t c = 0; c < solver.colorCount(); ++c) {
+		total += solver.colorSize(c);
+	}
+	BOOST_CHECK_EQUAL(total, net.springCount());
+
+	for (std::size_t c = 0; c < solver.colorCount(); ++c) {
+		std::set<std::size_t> touched;
+		for (std::size_t s = 0; s < net.springCount(); ++s) {
+			if (solver.springColor(s) == c) {
+				BOOST_CHECK(touched.insert(net.a[s]).second);
+				BOOST_CHECK(touched.insert(net.b[s]).second);
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(StretchIndependentOfIterationCount) {
+	// XPBD's compliance gives the spring's own stretch however few sweeps run
+	for (std::size_t iterations = 1; iterations <= 16; iterations *= 4) {
+		SpringNetwork<> net = Fixtures::hangingMass(50.0, 1.0);
+		XpbdSolver<> solver(net, iterations);
+		solver.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-Fixtures::gravity), MetersPerSecondSquared(0));
+		for (int i = 0; i < 600; ++i) {
+			solver.step(Seconds(1.0 / 60.0));
+		}
+		BOOST_CHECK_CLOSE(-net.y[1] - 0.1, Fixtures::staticStretch(50.0), 0.5);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(StiffClothStableAtSixtyHertz) {
+	const SpringParameters<> stiff(NewtonsPerMeter(1e6), NewtonSecondsPerMeter(10));
+	SoftBody<> cloth(SoftBodyMesh<>::grid(16, 16, Meters(0.02), Kilograms(0.1)), stiff, stiff, stiff);
+	cloth.pin(0);
+	cloth.pin(15);
+	XpbdSolver<> solver(cloth.network(), 20);
+	solver.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+	for (int i = 0; i < 120; ++i) {
+		solver.step(Seconds(1.0 / 60.0));
+	}
+	const SpringNetwork<> & net = cloth.network();
+	for (std::size_t i = 0; i < net.nodeCount(); ++i) {
+		BOOST_REQUIRE(std::fabs(net.y[i]) < 1.0);
+	}
+	// 0.3 m wide cloth hanging from two corners must hang below them
+	Meters x, y, z;
+	cloth.position(255, x, y, z);
+	BOOST_CHECK_LT(y.value(), -0.1);
+	BOOST_CHECK_LT(solver.maxConstraintError().value(), 0.02);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadedSweepsMatchSerial) {
+	const SpringParameters<> params(NewtonsPerMeter(5000), NewtonSecondsPerMeter(1));
+	SoftBody<> serial(SoftBodyMesh<>::grid(20, 20, Meters(0.02), Kilograms(0.2)), params, params, params);
+	serial.pin(0);
+	serial.pin(19);
+	SoftBody<> threaded(serial);
+	XpbdSolver<> one(serial.network(), 8);
+	XpbdSolver<> many(threaded.network(), 8);
+	many.setThreads(3);
+	BOOST_CHECK_EQUAL(many.threads(), 3u);
+	one.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+	many.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+	for (int i = 0; i < 30; ++i) {
+		one.step(Seconds(1.0 / 60.0));
+		many.step(Seconds(1.0 / 60.0));
+	}
+	// Springs of one color share no node, so the split cannot change the result
+	const SpringNetwork<> & a = serial.network();
+	const SpringNetwork<> & b = threaded.network();
+	for (std::size_t i = 0; i < a.nodeCount(); ++i) {
+		BOOST_CHECK_EQUAL(a.x[i], b.x[i]);
+		BOOST_CHECK_EQUAL(a.y[i], b.y[i]);
+		BOOST_CHECK_EQUAL(a.vz[i], b.vz[i]);
+	}
+	BOOST_CHECK_EQUAL(one.maxConstraintError().value(), many.maxConstraintError().value());
+}
@@ -0,0 +1,88 @@
+/** @file	test_RollbackSimulator.cpp
+	@brief	RollbackSimulator test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE RollbackSimulator basic tests
+
+// Module to test
+#include <PhysicalModeling/RollbackSimulator.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// Test fixtures
+#include "SpringNetworkFixtures.h"
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <cmath>
+
+using Fixtures::sameState;
+
+BOOST_AUTO_TEST_CASE(LateInputMatchesOnTimeInput) {
+	SoftBody<> onTime = Fixtures::hangingCloth(10, true);
+	SoftBody<> late = Fixtures::hangingCloth(10, true);
+	RollbackSimulator<> reference(onTime, Seconds(0.001));
+	RollbackSimulator<> delayed(late, Seconds(0.001));
+
+	for (std::size_t f = 0; f < 40; ++f) {
+		if (f == 10) {
+			BOOST_REQUIRE(reference.setInput(f, 95, Newtons(0.5), Newtons(0), Newtons(0)));
+		}
+		if (f == 25) {
+			// Arrives 15 frames late
+			BOOST_REQUIRE(delayed.setInput(10, 95, Newtons(0.5), Newtons(0), Newtons(0)));
+		}
+		reference.advance();
+		delayed.advance();
+	}
+	BOOST_CHECK_EQUAL(delayed.lastResimulatedSteps(), 15u);
+	BOOST_CHECK_EQUAL(delayed.frame(), reference.frame());
+	BOOST_CHECK(sameState(late.network(), onTime.network()));
+}
+
+BOOST_AUTO_TEST_CASE(HeldInputsCorrectedByLateChange) {
+	SoftBody<> onTime = Fixtures::hangingCloth(10, true);
+	SoftBody<> late = Fixtures::hangingCloth(10, true);
+	RollbackSimulator<> reference(onTime, Seconds(0.001));
+	RollbackSimulator<> delayed(late, Seconds(0.001));
+
+	// Both see the first input on time; the release at frame 20 arrives late
+	reference.setInput(0, 95, Newtons(0), Newtons(0), Newtons(1));
+	delayed.setInput(0, 95, Newtons(0), Newtons(0), Newtons(1));
+	for (std::size_t f = 0; f < 50; ++f) {
+		if (f == 20) {
+			reference.setInput(f, 95, Newtons(0), Newtons(0), Newtons(0));
+		}
+		reference.advance();
+		delayed.advance();
+	}
+	BOOST_CHECK(!sameState(late.network(), onTime.network()));
+	BOOST_REQUIRE(delayed.setInput(20, 95, Newtons(0), Newtons(0), Newtons(0)));
+	BOOST_CHECK_EQUAL(delayed.resimulate(), 30u);
+	BOOST_CHECK(sameState(late.network(), onTime.network()));
+	BOOST_CHECK_EQUAL(delayed.resimulate(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(InputsOutsideHistoryRejected) {
+	SoftBody<> cloth = Fixtures::hangingCloth(10, true);
+	RollbackSimulator<> sim(cloth, Seconds(0.001), 16);
+	for (int i = 0; i < 40; ++i) {
+		sim.advance();
+	}
+	BOOST_CHECK_EQUAL(sim.frame(), 40u);
+	BOOST_CHECK_EQUAL(sim.oldestFrame(), 25u);
+	BOOST_CHECK(!sim.setInput(24, 5, Newtons(1), Newtons(0), Newtons(0)));
+	BOOST_CHECK(!sim.setInput(41, 5, Newtons(1), Newtons(0), Newtons(0)));
+	BOOST_CHECK(sim.setInput(25, 5, Newtons(1), Newtons(0), Newtons(0)));
+	BOOST_CHECK_EQUAL(sim.resimulate(), 15u);
+}
@@ -0,0 +1,142 @@
+/** @file	test_SimdPack.cpp
+	@brief	Portable SIMD vector test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE SimdPack basic tests
+
+// Module to test
+#include <PhysicalModeling/SimdPack.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <boost/mpl/list.hpp>
+#include <boost/mpl/int.hpp>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+
+// System includes
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace {
+	/// Doubles [first, last), counting how often each element is visited
+	struct CountingKernel {
+		double * values;
+		int * visits;
+
+		template <int W>
+		PHYSICALMODELING_SIMD_INLINE std::size_t blocks(std::size_t first, std::size_t last) const {
+			typedef Simd::Pack<double, W> pack_t;
+			for (; first + W <= last; first += W) {
+				(pack_t::load(values + first) * pack_t::broadcast(2.0)).store(values + first);
+				for (int i = 0; i < W; ++i) {
+					++visits[first + i];
+				}
+			}
+			return first;
+		}
+	};
+}
+
+typedef boost::mpl::list<boost::mpl::int_<1>, boost::mpl::int_<2>, boost::mpl::int_<4>, boost::mpl::int_<8>, boost::mpl::int_<16> > widths;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(LaneWiseArithmetic, Width, widths) {
+	const int W = Width::value;
+	typedef Simd::Pack<double, W> pack_t;
+	double a[W], b[W], out[W];
+	for (int i = 0; i < W; ++i) {
+		a[i] = i + 1.0;
+		b[i] = 2.0 * i - 3.0;
+	}
+	const pack_t pa = pack_t::load(a), pb = pack_t::load(b);
+	(pa * pb + pa / pb - pb).store(out);
+	for (int i = 0; i < W; ++i) {
+		BOOST_CHECK_CLOSE(out[i], a[i] * b[i] + a[i] / b[i] - b[i], 1e-12);
+	}
+	Simd::sqrt(pa).store(out);
+	for (int i = 0; i < W; ++i) {
+		BOOST_CHECK_CLOSE(out[i], std::sqrt(a[i]), 1e-12);
+	}
+	Simd::selectGreater(pb, pack_t::broadcast(0.0), pa, pack_t::broadcast(-1.0)).store(out);
+	for (int i = 0; i < W; ++i) {
+		BOOST_CHECK_EQUAL(out[i], b[i] > 0 ? a[i] : -1.0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Gather, Width, widths) {
+	const int W = Width::value;
+	typedef Simd::Pack<float, W> pack_t;
+	float table[32];
+	for (int i = 0; i < 32; ++i) {
+		table[i] = 0.5f * i;
+	}
+	std::size_t index[W];
+	for (int i = 0; i < W; ++i) {
+		index[i] = (7 * i + 3) % 32;
+	}
+	const pack_t p = pack_t::gather(table, index);
+	for (int i = 0; i < W; ++i) {
+		BOOST_CHECK_EQUAL(p[i], table[index[i]]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ComplexArithmetic, Width, widths) {
+	const int W = Width::value;
+	typedef Simd::Pack<double, W> pack_t;
+	typedef Simd::ComplexPack<double, W> complex_t;
+	double re[W], im[W], outRe[W], outIm[W];
+	for (int i = 0; i < W; ++i) {
+		re[i] = i - 2.5;
+		im[i] = 0.5 * i + 1.0;
+	}
+	const complex_t z = complex_t::make(pack_t::load(re), pack_t::load(im));
+	const complex_t w = complex_t::make(pack_t::broadcast(2.0), pack_t::broadcast(-3.0));
+	const complex_t r = (z * w + z) / w - z * pack_t::broadcast(0.5);
+	r.re.store(outRe);
+	r.im.store(outIm);
+	for (int i = 0; i < W; ++i) {
+		const std::complex<double> zi(re[i], im[i]), wi(2.0, -3.0);
+		const std::complex<double> expected = (zi * wi + zi) / wi - zi * 0.5;
+		BOOST_CHECK_CLOSE(outRe[i], expected.real(), 1e-10);
+		BOOST_CHECK_CLOSE(outIm[i], expected.imag(), 1e-10);
+	}
+	Simd::norm(z).store(outRe);
+	for (int i = 0; i < W; ++i) {
+		BOOST_CHECK_CLOSE(outRe[i], std::norm(std::complex<double>(re[i], im[i])), 1e-12);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(NativeWidthAndIsa) {
+	BOOST_CHECK(Simd::NativeWidth<double>::value >= 1);
+	BOOST_CHECK(int(Simd::NativeWidth<float>::value) >= int(Simd::NativeWidth<double>::value));
+	const std::string name = Simd::isaName(Simd::runtimeIsa());
+	BOOST_CHECK(!name.empty());
+	BOOST_TEST_MESSAGE("Batched kernels use " << name);
+}
+
+BOOST_AUTO_TEST_CASE(ForEachBlockCoversTheRangeOnce) {
+	// A range that is not a whole number of packs, and does not start at 0
+	const std::size_t n = 45, first = 3, last = 42;
+	std::vector<double> values(n);
+	std::vector<int> visits(n, 0);
+	for (std::size_t i = 0; i < n; ++i) {
+		values[i] = i + 0.5;
+	}
+	const CountingKernel kernel = { values.data(), visits.data() };
+	Simd::forEachBlock<double>(kernel, first, last);
+	for (std::size_t i = 0; i < n; ++i) {
+		const bool inside = i >= first && i < last;
+		BOOST_CHECK_EQUAL(visits[i], inside ? 1 : 0);
+		BOOST_CHECK_EQUAL(values[i], inside ? 2 * (i + 0.5) : i + 0.5);
+	}
+}
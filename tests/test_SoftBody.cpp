@@ -0,0 +1,144 @@
+/** @file	test_SoftBody.cpp
+	@brief	SoftBody test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE SoftBody basic tests
+
+// Module to test
+#include <PhysicalModeling/SoftBody.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <cmath>
+#include <algorithm>
+
+namespace {
+	const SpringParameters<> structural(NewtonsPerMeter(200), NewtonSecondsPerMeter(0.05));
+	const SpringParameters<> shear(NewtonsPerMeter(50), NewtonSecondsPerMeter(0.01));
+	const SpringParameters<> bend(NewtonsPerMeter(10), NewtonSecondsPerMeter(0.01));
+
+	SoftBodyMesh<> shuffledGrid(std::size_t rows, std::size_t cols) {
+		// Same grid as SoftBodyMesh::grid, but numbered in a scrambled order
+		SoftBodyMesh<> ret;
+		const std::size_t n = rows * cols;
+		std::vector<std::size_t> label(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			label[(i * 7919) % n] = i;
+		}
+		std::vector<std::size_t> where(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			where[label[i]] = i;
+		}
+		for (std::size_t i = 0; i < n; ++i) {
+			const std::size_t g = label[i];
+			ret.addNode(Meters(0.01 * (g % cols)), Meters(0), Meters(0.01 * (g / cols)), Kilograms(0.001));
+		}
+		for (std::size_t r = 0; r + 1 < rows; ++r) {
+			for (std::size_t c = 0; c + 1 < cols; ++c) {
+				const std::size_t g = r * cols + c;
+				ret.addQuad(where[g], where[g + 1], where[g + 1 + cols], where[g + cols]);
+			}
+		}
+		return ret;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(GridSpringCounts) {
+	const std::size_t r = 6, c = 9;
+	SoftBody<> body(SoftBodyMesh<>::grid(r, c, Meters(0.01), Kilograms(0.1)), structural, shear, bend);
+	BOOST_CHECK_EQUAL(body.nodeCount(), r * c);
+	BOOST_CHECK_EQUAL(body.springCount(StructuralSpring), r * (c - 1) + c * (r - 1));
+	BOOST_CHECK_EQUAL(body.springCount(ShearSpring), 2 * (r - 1) * (c - 1));
+	BOOST_CHECK_EQUAL(body.springCount(BendSpring), r * (c - 2) + c * (r - 2));
+}
+
+BOOST_AUTO_TEST_CASE(TriangleBendSprings) {
+	// Two triangles sharing an edge: five edges and one bend spring
+	SoftBodyMesh<> mesh;
+	mesh.addNode(Meters(0), Meters(0), Meters(0), Kilograms(1));
+	mesh.addNode(Meters(1), Meters(0), Meters(0), Kilograms(1));
+	mesh.addNode(Meters(1), Meters(1), Meters(0), Kilograms(1));
+	mesh.addNode(Meters(0), Meters(1), Meters(0), Kilograms(1));
+	mesh.addTriangle(0, 1, 2);
+	mesh.addTriangle(0, 2, 3);
+	SoftBody<> body(mesh, structural, shear, bend);
+	BOOST_CHECK_EQUAL(body.springCount(StructuralSpring), 5u);
+	BOOST_CHECK_EQUAL(body.springCount(ShearSpring), 0u);
+	BOOST_CHECK_EQUAL(body.springCount(BendSpring), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(ReorderingReducesBandwidth) {
+	const SoftBodyMesh<> mesh = shuffledGrid(20, 20);
+	SoftBody<> original(mesh, structural, shear, bend, OriginalOrder);
+	SoftBody<> rcm(mesh, structural, shear, bend, ReverseCuthillMcKeeOrder);
+	SoftBody<> morton(mesh, structural, shear, bend, MortonOrder);
+	BOOST_CHECK_LT(rcm.springBandwidth(), original.springBandwidth());
+	BOOST_CHECK_LT(morton.springBandwidth(), original.springBandwidth());
+	// RCM on a grid should be close to the grid's natural bandwidth
+	BOOST_CHECK_LE(rcm.springBandwidth(), 3u * 20u);
+}
+
+BOOST_AUTO_TEST_CASE(OrderingDoesNotChangeResults) {
+	const SoftBodyMesh<> mesh = shuffledGrid(8, 8);
+	SoftBody<> original(mesh, structural, shear, bend, OriginalOrder);
+	SoftBody<> rcm(mesh, structural, shear, bend, ReverseCuthillMcKeeOrder);
+	SoftBody<> morton(mesh, structural, shear, bend, MortonOrder);
+	SoftBody<> * bodies[3] = {&original, &rcm, &morton};
+	for (int b = 0; b < 3; ++b) {
+		bodies[b]->pin(0);
+		bodies[b]->setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+		for (int i = 0; i < 200; ++i) {
+			bodies[b]->step(Seconds(0.0005));
+		}
+	}
+	for (std::size_t node = 0; node < mesh.nodeCount(); ++node) {
+		Meters x0, y0, z0;
+		original.position(node, x0, y0, z0);
+		for (int b = 1; b < 3; ++b) {
+			Meters x, y, z;
+			bodies[b]->position(node, x, y, z);
+			BOOST_CHECK_SMALL(x.value() - x0.value(), 1e-9);
+			BOOST_CHECK_SMALL(y.value() - y0.value(), 1e-9);
+			BOOST_CHECK_SMALL(z.value() - z0.value(), 1e-9);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(PinnedNodesStayAndClothSags) {
+	SoftBody<> cloth(SoftBodyMesh<>::grid(10, 10, Meters(0.01), Kilograms(0.01)), structural, shear, bend);
+	cloth.pin(0);
+	cloth.pin(9);
+	cloth.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+	for (int i = 0; i < 1000; ++i) {
+		cloth.step(Seconds(0.0002));
+	}
+	Meters x, y, z;
+	cloth.position(0, x, y, z);
+	BOOST_CHECK_EQUAL(y.value(), 0.0);
+	cloth.position(9, x, y, z);
+	BOOST_CHECK_EQUAL(y.value(), 0.0);
+	cloth.position(95, x, y, z);
+	BOOST_CHECK_LT(y.value(), -0.01);
+
+	BOOST_CHECK_GE(cloth.lastStepTiming().forces.value(), 0.0);
+	BOOST_CHECK_GE(cloth.lastStepTiming().total().value(), cloth.lastStepTiming().forces.value());
+}
+
+BOOST_AUTO_TEST_CASE(SpringParametersFromElement) {
+	LinearSpringDamper<> element(Kilograms(1), NewtonsPerMeter(42), NewtonSecondsPerMeter(0.5));
+	SpringParameters<> params(element);
+	BOOST_CHECK_EQUAL(params.stiffness.value(), 42.0);
+	BOOST_CHECK_EQUAL(params.viscosity.value(), 0.5);
+}
@@ -0,0 +1,144 @@
+/** @file	test_SpringDamperBatch.cpp
+	@brief	Spring-damper scenario batch test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE SpringDamperBatch basic tests
+
+// Module to test
+#include <PhysicalModeling/SpringDamperBatch.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <cmath>
+#include <algorithm>
+
+namespace {
+	const double pi = std::acos(-1.0);
+	const double dt = 0.0005, duration = 1.5;
+
+	/// One scenario stepped with LinearSpringDamper, one at a time
+	SpringDamperMetrics<> simulateOne(const SpringDamperScenario<> & s, double bandFraction) {
+		LinearSpringDamper<> sd(s.mass, s.stiffness, s.viscosity);
+		const double m = s.mass.value(), K = s.stiffness.value(), B = s.viscosity.value();
+		const double F = s.applied.value(), xeq = F / K;
+		const double offset = s.displacement.value() - xeq, start = std::fabs(offset);
+		const double side = offset > 0 || (offset == 0 && s.velocity.value() > 0) ? 1 : -1;
+		double x = s.displacement.value(), v = s.velocity.value();
+		double overshoot = 0, peak = start, settling = 0, dissipated = 0;
+		const int steps = int(duration / dt + 0.5);
+		for (int k = 0; k < steps; ++k) {
+			sd.setDisplacement(Meters(x));
+			sd.setVelocity(MetersPerSecond(v));
+			v += dt / m * (F + sd.force().value());
+			x += dt * v;
+			overshoot = std::max(overshoot, -side * (x - xeq));
+			peak = std::max(peak, std::fabs(x - xeq));
+			if (std::fabs(x - xeq) > bandFraction * start) {
+				settling = dt * (k + 1);
+			}
+			dissipated += dt * B * v * v;
+		}
+		SpringDamperMetrics<> ret;
+		ret.overshoot = Meters(overshoot);
+		ret.overshootRatio = start > 0 ? overshoot / start : 0;
+		ret.peakDeviation = Meters(peak);
+		ret.settlingTime = Seconds(settling);
+		ret.dissipatedEnergy = Joules(dissipated);
+		ret.finalEnergy = Joules(0.5 * (m * v * v + K * (x - xeq) * (x - xeq)));
+		return ret;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(UnderdampedStepResponse) {
+	// zeta = B / (2 sqrt(K m)) = 0.2: textbook overshoot exp(-pi zeta / sqrt(1 - zeta^2))
+	SpringDamperBatch<> batch;
+	batch.add(SpringDamperScenario<>(Kilograms(1), NewtonsPerMeter(100), NewtonSecondsPerMeter(4),
+		Meters(0), MetersPerSecond(0), Newtons(1)));
+	batch.run(Seconds(0.00001), Seconds(3), 1);
+	const SpringDamperMetrics<> result = batch.metrics(0);
+	const double zeta = 0.2;
+	BOOST_CHECK_CLOSE(result.overshootRatio, std::exp(-pi * zeta / std::sqrt(1 - zeta * zeta)), 0.5);
+	BOOST_CHECK_CLOSE(result.overshoot.value(), 0.01 * result.overshootRatio, 1e-9);
+	BOOST_CHECK_CLOSE(result.peakDeviation.value(), 0.01, 1e-9);
+	// 2% settling time is about 4 / (zeta omega_n) = 2 s
+	BOOST_CHECK_GT(result.settlingTime.value(), 1.5);
+	BOOST_CHECK_LT(result.settlingTime.value(), 2.2);
+	// Started at 0.005 J of spring energy about equilibrium
+	BOOST_CHECK_CLOSE(result.dissipatedEnergy.value() + result.finalEnergy.value(), 0.005, 0.1);
+}
+
+BOOST_AUTO_TEST_CASE(KickedFromEquilibrium) {
+	// zeta = 0.2, omega_n = 10: the first swing, along v0, peaks at
+	// v0 / omega_n exp(-zeta / sqrt(1 - zeta^2) atan(sqrt(1 - zeta^2) / zeta)),
+	// and the overshoot is the swing back, smaller by exp(-pi zeta / sqrt(1 - zeta^2))
+	const double zeta = 0.2, root = std::sqrt(1 - zeta * zeta);
+	const double first = 0.1 * std::exp(-zeta / root * std::atan(root / zeta));
+	for (int sign = -1; sign <= 1; sign += 2) {
+		SpringDamperBatch<> batch;
+		batch.add(SpringDamperScenario<>(Kilograms(1), NewtonsPerMeter(100), NewtonSecondsPerMeter(4),
+			Meters(0), MetersPerSecond(sign), Newtons(0)));
+		batch.run(Seconds(0.00001), Seconds(3), 1);
+		const SpringDamperMetrics<> result = batch.metrics(0);
+		BOOST_CHECK_CLOSE(result.peakDeviation.value(), first, 0.5);
+		BOOST_CHECK_CLOSE(result.overshoot.value(), first * std::exp(-pi * zeta / root), 0.5);
+		BOOST_CHECK_EQUAL(result.overshootRatio, 0.0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(MatchesOneAtATime) {
+	SpringDamperBatch<> batch;
+	std::vector<SpringDamperScenario<> > scenarios;
+	// An odd count, so some lanes are in a partial block
+	for (int k = 1; k <= 9; ++k) {
+		for (int b = 0; b < 7; ++b) {
+			scenarios.push_back(SpringDamperScenario<>(Kilograms(0.1 * k), NewtonsPerMeter(40.0 * k),
+				NewtonSecondsPerMeter(0.3 * b), Meters(0.01 * (b % 3) - 0.01), MetersPerSecond(0.1), Newtons(0.2 * b)));
+			BOOST_CHECK_EQUAL(batch.add(scenarios.back()), scenarios.size() - 1);
+		}
+	}
+	BOOST_CHECK_EQUAL(batch.size(), scenarios.size());
+
+	for (std::size_t threads = 1; threads <= 3; ++threads) {
+		batch.run(Seconds(dt), Seconds(duration), threads);
+		for (std::size_t i = 0; i < scenarios.size(); ++i) {
+			const SpringDamperMetrics<> expected = simulateOne(scenarios[i], 0.02);
+			const SpringDamperMetrics<> actual = batch.metrics(i);
+			BOOST_CHECK_SMALL(actual.overshoot.value() - expected.overshoot.value(), 1e-12);
+			BOOST_CHECK_SMALL(actual.overshootRatio - expected.overshootRatio, 1e-9);
+			BOOST_CHECK_SMALL(actual.peakDeviation.value() - expected.peakDeviation.value(), 1e-12);
+			BOOST_CHECK_SMALL(actual.settlingTime.value() - expected.settlingTime.value(), 1e-9);
+			BOOST_CHECK_SMALL(actual.dissipatedEnergy.value() - expected.dissipatedEnergy.value(), 1e-12);
+			BOOST_CHECK_SMALL(actual.finalEnergy.value() - expected.finalEnergy.value(), 1e-12);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ScenarioFromSpringDamper) {
+	const LinearSpringDamper<> sd(Kilograms(2), NewtonsPerMeter(50), NewtonSecondsPerMeter(20));
+	const SpringDamperScenario<> s(sd, Meters(0.1));
+	BOOST_CHECK_EQUAL(s.mass.value(), 2.0);
+	BOOST_CHECK_EQUAL(s.stiffness.value(), 50.0);
+	BOOST_CHECK_EQUAL(s.viscosity.value(), 20.0);
+
+	// Overdamped from rest: no overshoot, and a band floor caps the settling time
+	SpringDamperBatch<> batch;
+	batch.add(s);
+	batch.setSettlingBand(0, Meters(0.05));
+	batch.run(Seconds(0.001), Seconds(2));
+	BOOST_CHECK_EQUAL(batch.metrics(0).overshoot.value(), 0.0);
+	BOOST_CHECK_EQUAL(batch.metrics(0).overshootRatio, 0.0);
+	BOOST_CHECK_GT(batch.metrics(0).settlingTime.value(), 0.0);
+	BOOST_CHECK_LT(batch.metrics(0).settlingTime.value(), 1.0);
+}
@@ -0,0 +1,150 @@
+/** @file	test_SpringForceKernel.cpp
+	@brief	Vectorized spring force kernel test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE SpringForceKernel basic tests
+
+// Module to test
+#include <PhysicalModeling/SpringForceKernel.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+#include <boost/mpl/list.hpp>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+
+// System includes
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+template<class P>
+static SpringNetwork<P> randomNetwork(std::size_t nodes, std::size_t springs) {
+	std::srand(42);
+	SpringNetwork<P> net;
+	net.resizeNodes(nodes);
+	for (std::size_t i = 0; i < nodes; ++i) {
+		net.x[i] = P(std::rand()) / RAND_MAX;
+		net.y[i] = P(std::rand()) / RAND_MAX;
+		net.z[i] = P(std::rand()) / RAND_MAX;
+		net.vx[i] = P(std::rand()) / RAND_MAX - P(0.5);
+		net.vy[i] = P(std::rand()) / RAND_MAX - P(0.5);
+		net.vz[i] = P(std::rand()) / RAND_MAX - P(0.5);
+		net.invMass[i] = 1;
+	}
+	for (std::size_t s = 0; s < springs; ++s) {
+		std::size_t a = std::rand() % nodes, b = std::rand() % nodes;
+		if (a == b) {
+			b = (a + 1) % nodes;
+		}
+		net.a.push_back(std::min(a, b));
+		net.b.push_back(std::max(a, b));
+		net.rest.push_back(P(0.3));
+		net.K.push_back(P(100) + std::rand() % 50);
+		net.B.push_back(P(0.5));
+	}
+	// A degenerate spring, which must contribute nothing
+	net.x[1] = net.x[0];
+	net.y[1] = net.y[0];
+	net.z[1] = net.z[0];
+	net.a.push_back(0);
+	net.b.push_back(1);
+	net.rest.push_back(P(1));
+	net.K.push_back(P(1000));
+	net.B.push_back(P(1));
+	return net;
+}
+
+template<class P>
+static void referenceForces(const SpringNetwork<P> & net, std::vector<P> & fx, std::vector<P> & fy, std::vector<P> & fz) {
+	for (std::size_t s = 0; s < net.springCount(); ++s) {
+		const std::size_t a = net.a[s], b = net.b[s];
+		const P dx = net.x[b] - net.x[a], dy = net.y[b] - net.y[a], dz = net.z[b] - net.z[a];
+		const P len = std::sqrt(dx * dx + dy * dy + dz * dz);
+		if (len <= std::numeric_limits<P>::min()) {
+			continue;
+		}
+		const P ux = dx / len, uy = dy / len, uz = dz / len;
+		const P relVel = (net.vx[b] - net.vx[a]) * ux + (net.vy[b] - net.vy[a]) * uy + (net.vz[b] - net.vz[a]) * uz;
+		const P f = net.K[s] * (len - net.rest[s]) + net.B[s] * relVel;
+		fx[a] += f * ux;
+		fy[a] += f * uy;
+		fz[a] += f * uz;
+		fx[b] -= f * ux;
+		fy[b] -= f * uy;
+		fz[b] -= f * uz;
+	}
+}
+
+template<class P>
+static void checkClose(const std::vector<P> & expected, const std::vector<P> & actual, P scale) {
+	for (std::size_t i = 0; i < expected.size(); ++i) {
+		BOOST_CHECK_SMALL(expected[i] - actual[i], scale);
+	}
+}
+
+typedef boost::mpl::list<float, double> precisions;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(MatchesScalarReference, P, precisions) {
+	// A spring count that is not a multiple of any lane width
+	const SpringNetwork<P> net = randomNetwork<P>(200, 1001);
+	const std::size_t n = net.nodeCount();
+	std::vector<P> rx(n), ry(n), rz(n), fx(n), fy(n), fz(n);
+	referenceForces(net, rx, ry, rz);
+	accumulateSpringForces(net, fx.data(), fy.data(), fz.data());
+	const P tol = std::numeric_limits<P>::epsilon() * 1e4;
+	checkClose(rx, fx, tol);
+	checkClose(ry, fy, tol);
+	checkClose(rz, fz, tol);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(EveryWidthAgrees, P, precisions) {
+	const SpringNetwork<P> net = randomNetwork<P>(50, 203);
+	const std::size_t n = net.nodeCount();
+	std::vector<P> f1[3], fw[3];
+	for (int c = 0; c < 3; ++c) {
+		f1[c].assign(n, P(0));
+	}
+	Internal::springForceBlocks<1>(net, 0, net.x.data(), net.y.data(), net.z.data(),
+		net.vx.data(), net.vy.data(), net.vz.data(), f1[0].data(), f1[1].data(), f1[2].data());
+
+	const P tol = std::numeric_limits<P>::epsilon() * 1e4;
+	for (int width = 2; width <= 16; width *= 2) {
+		for (int c = 0; c < 3; ++c) {
+			fw[c].assign(n, P(0));
+		}
+		std::size_t s = 0;
+		switch (width) {
+			case 2:
+				s = Internal::springForceBlocks<2>(net, 0, net.x.data(), net.y.data(), net.z.data(),
+					net.vx.data(), net.vy.data(), net.vz.data(), fw[0].data(), fw[1].data(), fw[2].data());
+				break;
+			case 4:
+				s = Internal::springForceBlocks<4>(net, 0, net.x.data(), net.y.data(), net.z.data(),
+					net.vx.data(), net.vy.data(), net.vz.data(), fw[0].data(), fw[1].data(), fw[2].data());
+				break;
+			case 8:
+				s = Internal::springForceBlocks<8>(net, 0, net.x.data(), net.y.data(), net.z.data(),
+					net.vx.data(), net.vy.data(), net.vz.data(), fw[0].data(), fw[1].data(), fw[2].data());
+				break;
+			default:
+				s = Internal::springForceBlocks<16>(net, 0, net.x.data(), net.y.data(), net.z.data(),
+					net.vx.data(), net.vy.data(), net.vz.data(), fw[0].data(), fw[1].data(), fw[2].data());
+				break;
+		}
+		BOOST_CHECK_EQUAL(s, net.springCount() / width * width);
+		Internal::springForceBlocks<1>(net, s, net.x.data(), net.y.data(), net.z.data(),
+			net.vx.data(), net.vy.data(), net.vz.data(), fw[0].data(), fw[1].data(), fw[2].data());
+		for (int c = 0; c < 3; ++c) {
+			checkClose(f1[c], fw[c], tol);
+		}
+	}
+}
@@ -0,0 +1,113 @@
+/** @file	test_SpringNetworkMatrix.cpp
+	@brief	SpringNetworkMatrix test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE SpringNetworkMatrix basic tests
+
+// Module to test
+#include <PhysicalModeling/SpringNetworkMatrix.h>
+#include <PhysicalModeling/SoftBody.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <vector>
+#include <cmath>
+
+namespace {
+	SpringNetwork<> twoSprings() {
+		// 0 --- 1 --- 2 along x, node 0 pinned
+		SpringNetwork<> net;
+		net.resizeNodes(3);
+		net.x[1] = 1;
+		net.x[2] = 2;
+		net.invMass[0] = 0;
+		net.invMass[1] = 0.5;
+		net.invMass[2] = 0.25;
+		for (std::size_t s = 0; s < 2; ++s) {
+			net.a.push_back(s);
+			net.b.push_back(s + 1);
+			net.rest.push_back(1);
+			net.K.push_back(10);
+			net.B.push_back(1);
+		}
+		return net;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(AssembleSmallSystem) {
+	const SpringNetwork<> net = twoSprings();
+	BlockSparseMatrix<> A;
+	assembleSpringSystem(net, 1.0, 0.1, 0.01, A);
+	BOOST_CHECK_EQUAL(A.rows, 3u);
+	// pinned node 0 is decoupled: diagonal 0,1,2 plus 1-2 and 2-1
+	BOOST_CHECK_EQUAL(A.blockCount(), 5u);
+
+	// k = 0.1 * B + 0.01 * K = 0.2 along x only
+	const double * d1 = &A.val[9 * A.find(1, 1)];
+	BOOST_CHECK_CLOSE(d1[0], 2.0 + 0.4, 1e-9);
+	BOOST_CHECK_CLOSE(d1[4], 2.0, 1e-9);
+	const double * o12 = &A.val[9 * A.find(1, 2)];
+	BOOST_CHECK_CLOSE(o12[0], -0.2, 1e-9);
+	BOOST_CHECK_EQUAL(A.find(0, 1), A.blockCount());
+	BOOST_CHECK_EQUAL(A.val[9 * A.find(0, 0)], 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(TransposeAndProduct) {
+	const SpringParameters<> p(NewtonsPerMeter(100), NewtonSecondsPerMeter(1));
+	SoftBody<> body(SoftBodyMesh<>::grid(4, 5, Meters(0.1), Kilograms(1)), p, p, p);
+	BlockSparseMatrix<> A, At, AA;
+	assembleSpringSystem(body.network(), 1.0, 0.01, 0.0001, A);
+	transpose(A, At);
+	multiply(A, At, AA);
+
+	std::vector<double> x(3 * A.rows), Ax, AAx, AAAx;
+	for (std::size_t i = 0; i < x.size(); ++i) {
+		x[i] = std::sin(0.3 * i);
+	}
+	At.multiply(x, Ax);
+	A.multiply(x, AAx);
+	for (std::size_t i = 0; i < x.size(); ++i) {
+		// symmetric
+		BOOST_CHECK_CLOSE(Ax[i] + 10.0, AAx[i] + 10.0, 1e-9);
+	}
+	A.multiply(AAx, AAAx);
+	AA.multiply(x, Ax);
+	for (std::size_t i = 0; i < x.size(); ++i) {
+		BOOST_CHECK_CLOSE(Ax[i] + 10.0, AAAx[i] + 10.0, 1e-9);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ConjugateGradientSolves) {
+	const SpringParameters<> p(NewtonsPerMeter(1000), NewtonSecondsPerMeter(1));
+	SoftBody<> body(SoftBodyMesh<>::grid(8, 8, Meters(0.1), Kilograms(1)), p, p, p);
+	BlockSparseMatrix<> A;
+	const double h = 0.01;
+	assembleSpringSystem(body.network(), 1.0, h, h * h, A);
+
+	std::vector<double> expected(3 * A.rows), b, x(3 * A.rows, 0.0), check;
+	for (std::size_t i = 0; i < expected.size(); ++i) {
+		expected[i] = std::cos(0.7 * i);
+	}
+	A.multiply(expected, b);
+
+	BlockJacobiPreconditioner<> jacobi;
+	jacobi.setup(A);
+	ConjugateGradientWorkspace<> ws;
+	const std::size_t iterations = conjugateGradient(A, b, x, jacobi, 1e-10, 1000, ws);
+	BOOST_CHECK_LT(iterations, 1000u);
+	for (std::size_t i = 0; i < x.size(); ++i) {
+		BOOST_CHECK_SMALL(x[i] - expected[i], 1e-6);
+	}
+}
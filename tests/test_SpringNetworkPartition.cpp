@@ -0,0 +1,119 @@
+/** @file	test_SpringNetworkPartition.cpp
+	@brief	Partitioned spring network test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE SpringNetworkPartition basic tests
+
+// Module to test
+#include <PhysicalModeling/SpringNetworkPartition.h>
+#include <PhysicalModeling/SoftBody.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <vector>
+#include <cstddef>
+
+namespace {
+	const SpringParameters<> structural(NewtonsPerMeter(200), NewtonSecondsPerMeter(0.05));
+	const SpringParameters<> shear(NewtonsPerMeter(50), NewtonSecondsPerMeter(0.01));
+	const SpringParameters<> bend(NewtonsPerMeter(10), NewtonSecondsPerMeter(0.01));
+}
+
+BOOST_AUTO_TEST_CASE(CpuListParsing) {
+	const std::vector<int> cpus = Internal::parseCpuList("0-3,8,10-11");
+	const int expected[] = {0, 1, 2, 3, 8, 10, 11};
+	BOOST_CHECK_EQUAL_COLLECTIONS(cpus.begin(), cpus.end(), expected, expected + 7);
+	BOOST_CHECK(Internal::parseCpuList("").empty());
+}
+
+BOOST_AUTO_TEST_CASE(PartitionsAreBalancedAndCompact) {
+	const SoftBody<> cloth(SoftBodyMesh<>::grid(24, 24, Meters(0.01), Kilograms(0.1)), structural, shear, bend);
+	const SpringNetwork<> & net = cloth.network();
+	const std::size_t parts = 4;
+	const std::vector<std::size_t> part = partitionByLocality(net, parts);
+
+	std::vector<std::size_t> sizes(parts, 0);
+	for (std::size_t i = 0; i < part.size(); ++i) {
+		BOOST_REQUIRE_LT(part[i], parts);
+		++sizes[part[i]];
+	}
+	for (std::size_t p = 0; p < parts; ++p) {
+		BOOST_CHECK_GT(sizes[p], net.nodeCount() / parts * 3 / 4);
+		BOOST_CHECK_LT(sizes[p], net.nodeCount() / parts * 5 / 4);
+	}
+
+	// Strips of a grid: only springs near the three cuts cross partitions
+	std::size_t cut = 0;
+	for (std::size_t s = 0; s < net.springCount(); ++s) {
+		cut += part[net.a[s]] != part[net.b[s]];
+	}
+	BOOST_CHECK_LT(cut, net.springCount() / 5);
+}
+
+BOOST_AUTO_TEST_CASE(MorePartsThanNodes) {
+	SpringNetwork<> net;
+	net.resizeNodes(2);
+	net.a.push_back(0);
+	net.b.push_back(1);
+	net.rest.push_back(1);
+	net.K.push_back(1);
+	net.B.push_back(0);
+	const std::vector<std::size_t> part = partitionByLocality(net, 5);
+	BOOST_CHECK_NE(part[0], part[1]);
+
+	PartitionedSpringNetwork<> partitioned(net, 5);
+	BOOST_CHECK_EQUAL(partitioned.partitionCount(), 2u);
+	BOOST_CHECK_EQUAL(partitioned.ghostCount(0), 1u);
+	BOOST_CHECK_EQUAL(partitioned.ghostCount(1), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(MatchesSoftBody) {
+	for (std::size_t parts = 1; parts <= 4; ++parts) {
+		SoftBody<> cloth(SoftBodyMesh<>::grid(12, 12, Meters(0.01), Kilograms(0.01)), structural, shear, bend);
+		cloth.pin(0);
+		cloth.pin(11);
+		cloth.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+
+		PartitionedSpringNetwork<> partitioned(cloth.network(), parts);
+		partitioned.setGravity(MetersPerSecondSquared(0), MetersPerSecondSquared(-9.81), MetersPerSecondSquared(0));
+		BOOST_CHECK_EQUAL(partitioned.partitionCount(), parts);
+		std::size_t owned = 0;
+		for (std::size_t p = 0; p < parts; ++p) {
+			owned += partitioned.ownedCount(p);
+			BOOST_CHECK_EQUAL(partitioned.ghostCount(p) > 0, parts > 1);
+			if (partitioned.numaNodeCount()) {
+				BOOST_CHECK_LT(partitioned.numaNode(p), partitioned.numaNodeCount());
+			}
+		}
+		BOOST_CHECK_EQUAL(owned, cloth.nodeCount());
+
+		for (int i = 0; i < 300; ++i) {
+			cloth.step(Seconds(0.0002));
+		}
+		partitioned.step(Seconds(0.0002), 100);
+		partitioned.step(Seconds(0.0002), 200);
+
+		SpringNetwork<> result = cloth.network();
+		partitioned.gather(result);
+		const SpringNetwork<> & expected = cloth.network();
+		BOOST_CHECK_LT(expected.y[cloth.nodeCount() / 2], -1e-3);
+		for (std::size_t i = 0; i < cloth.nodeCount(); ++i) {
+			BOOST_CHECK_SMALL(result.x[i] - expected.x[i], 1e-12);
+			BOOST_CHECK_SMALL(result.y[i] - expected.y[i], 1e-12);
+			BOOST_CHECK_SMALL(result.z[i] - expected.z[i], 1e-12);
+			BOOST_CHECK_SMALL(result.vy[i] - expected.vy[i], 1e-9);
+		}
+	}
+}
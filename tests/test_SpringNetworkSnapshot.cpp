@@ -0,0 +1,119 @@
+/** @file	test_SpringNetworkSnapshot.cpp
+	@brief	NetworkSnapshot and SnapshotRing test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE SpringNetworkSnapshot basic tests
+
+// Module to test
+#include <PhysicalModeling/SpringNetworkSnapshot.h>
+#include <PhysicalModeling/SoftBody.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+// Test fixtures
+#include "SpringNetworkFixtures.h"
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <cmath>
+
+using Fixtures::sameState;
+
+BOOST_AUTO_TEST_CASE(FullSnapshotRoundTrip) {
+	SoftBody<> cloth = Fixtures::hangingCloth(16, false);
+	for (int i = 0; i < 10; ++i) {
+		cloth.step(Seconds(0.001));
+	}
+	const SpringNetwork<> saved = cloth.network();
+
+	NetworkSnapshot<> snapshot;
+	snapshot.capture(cloth.network());
+	BOOST_CHECK_EQUAL(snapshot.nodeCount(), 256u);
+	BOOST_CHECK_EQUAL(snapshot.springCount(), saved.springCount());
+
+	for (int i = 0; i < 10; ++i) {
+		cloth.step(Seconds(0.001));
+	}
+	BOOST_CHECK(!sameState(cloth.network(), saved));
+	snapshot.restore(cloth.network());
+	BOOST_CHECK(sameState(cloth.network(), saved));
+
+	// Restoring into an empty network recreates it
+	SpringNetwork<> other;
+	snapshot.restore(other);
+	BOOST_CHECK(sameState(other, saved));
+}
+
+BOOST_AUTO_TEST_CASE(RingCopiesOnlyDirtyChunks) {
+	SoftBody<> cloth = Fixtures::hangingCloth(64, false);
+	SpringNetwork<> & net = cloth.network();
+	SnapshotRing<> ring(8, 256);
+
+	const std::size_t first = ring.capture(net);
+	const std::size_t perSnapshot = ring.chunksPerSnapshot();
+	BOOST_CHECK_EQUAL(ring.lastCopiedChunks(), perSnapshot);
+	const SpringNetwork<> saved = net;
+
+	// Touch one node: one chunk of one array changes
+	net.y[1000] += 0.01;
+	const std::size_t second = ring.capture(net);
+	BOOST_CHECK_EQUAL(ring.lastCopiedChunks(), 1u);
+	BOOST_CHECK_EQUAL(ring.storedChunks(), perSnapshot + 1);
+
+	// No change at all: nothing copied
+	ring.capture(net);
+	BOOST_CHECK_EQUAL(ring.lastCopiedChunks(), 0u);
+
+	const SpringNetwork<> moved = net;
+	BOOST_REQUIRE(ring.restore(first, net));
+	BOOST_CHECK(sameState(net, saved));
+	BOOST_REQUIRE(ring.restore(second, net));
+	BOOST_CHECK(sameState(net, moved));
+}
+
+BOOST_AUTO_TEST_CASE(RingEvictsOldest) {
+	SoftBody<> cloth = Fixtures::hangingCloth(16, false);
+	SnapshotRing<> ring(3, 64);
+	ring.reserve(cloth.network(), 3);
+
+	std::vector<SpringNetwork<> > history;
+	for (int i = 0; i < 5; ++i) {
+		BOOST_CHECK_EQUAL(ring.capture(cloth.network()), std::size_t(i));
+		history.push_back(cloth.network());
+		cloth.step(Seconds(0.001));
+	}
+	BOOST_CHECK_EQUAL(ring.size(), 3u);
+	BOOST_CHECK_EQUAL(ring.newest(), 4u);
+	BOOST_CHECK(!ring.contains(1));
+	BOOST_CHECK(ring.contains(2));
+	BOOST_CHECK_LE(ring.storedChunks(), 3 * ring.chunksPerSnapshot());
+
+	SpringNetwork<> net = cloth.network();
+	BOOST_CHECK(!ring.restore(1, net));
+	for (std::size_t id = 2; id < 5; ++id) {
+		BOOST_REQUIRE(ring.restore(id, net));
+		BOOST_CHECK(sameState(net, history[id]));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(DegenerateRingSizesClamped) {
+	SoftBody<> cloth = Fixtures::hangingCloth(4, false);
+	SnapshotRing<> ring(0, 0);
+	BOOST_CHECK_EQUAL(ring.capacity(), 1u);
+	const std::size_t id = ring.capture(cloth.network());
+	BOOST_CHECK_EQUAL(ring.chunksPerSnapshot(), 7 * 16 + 3 * cloth.network().springCount());
+	const SpringNetwork<> saved = cloth.network();
+	cloth.step(Seconds(0.001));
+	BOOST_REQUIRE(ring.restore(id, cloth.network()));
+	BOOST_CHECK(sameState(cloth.network(), saved));
+}
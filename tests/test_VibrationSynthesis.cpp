@@ -0,0 +1,171 @@
+/** @file	test_VibrationSynthesis.cpp
+	@brief	Spring-damper vibration synthesis bank test driver
+
+	@date	2026
+
+	@author
+	agent <agent@local>
+*/
+
+#define BOOST_TEST_MODULE VibrationSynthesis basic tests
+
+// Module to test
+#include <PhysicalModeling/VibrationSynthesis.h>
+
+// Library/third-party includes
+#include <BoostTestTargetConfig.h>
+
+using namespace boost::unit_test;
+
+using namespace PhysicalModeling;
+using namespace PhysicalModeling::DimensionedQuantities::SI;
+
+// System includes
+#include <vector>
+#include <cmath>
+
+namespace {
+	const double pi = std::acos(-1.0);
+	const double dt = 1.0 / 48000;
+
+	/// One section in direct form I, for reference
+	struct DirectForm {
+		DirectForm() : u1(0), u2(0), y1(0), y2(0) {}
+		double operator()(const SecondOrderSection<> & c, double u) {
+			const double y = c.b0 * u + c.b1 * u1 + c.b2 * u2 - c.a1 * y1 - c.a2 * y2;
+			u2 = u1;
+			u1 = u;
+			y2 = y1;
+			y1 = y;
+			return y;
+		}
+		double u1, u2, y1, y2;
+	};
+
+	/// Modes of a struck plate, between 80 Hz and a few kHz
+	LinearSpringDamper<> mode(std::size_t i) {
+		const double f = 80 + 37.0 * i + 3.0 * (i * i % 11);
+		const double m = 0.001 * (1 + i % 3);
+		const double K = m * (2 * pi * f) * (2 * pi * f);
+		return LinearSpringDamper<>(Kilograms(m), NewtonsPerMeter(K), NewtonSecondsPerMeter(2 * 0.002 * (1 + i % 4) * std::sqrt(K * m)));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SingleOscillator) {
+	VibrationBank<> bank(Seconds(dt), 64, VelocityResponse);
+	BOOST_CHECK_EQUAL(bank.blockSize(), 64u);
+	BOOST_CHECK_EQUAL(bank.samplePeriod().value(), dt);
+	BOOST_CHECK_EQUAL(bank.addOscillator(mode(5), 2.0), 0u);
+	BOOST_CHECK_EQUAL(bank.oscillatorCount(), 1u);
+	BOOST_CHECK(bank.excite(0, Newtons(0.5), 10));
+	BOOST_CHECK(!bank.excite(1, Newtons(0.5), 10));
+	BOOST_CHECK(!bank.excite(0, Newtons(0.5), 64));
+
+	const SecondOrderSection<> section = compileBiquad(mode(5), Seconds(dt), VelocityResponse);
+	DirectForm reference;
+	std::vector<double> block(64);
+	for (int b = 0; b < 20; ++b) {
+		if (b == 3) {
+			bank.excite(0, Newtons(-0.25), 63);
+		}
+		bank.render(block.data());
+		for (std::size_t n = 0; n < 64; ++n) {
+			const double force = (b == 0 && n == 10) ? 0.5 : (b == 3 && n == 63) ? -0.25 : 0.0;
+			const double expected = 2.0 * reference(section, force);
+			BOOST_CHECK_SMALL(block[n] - expected, 1e-12 + 1e-12 * std::fabs(expected));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SparseEventsMatchDenseFiltering) {
+	// Not a whole number of groups, with several events in a group and on one sample
+	const std::size_t count = 37, blockSize = 48, blocks = 30;
+	VibrationBank<> bank(Seconds(dt), blockSize);
+	std::vector<SecondOrderSection<> > sections;
+	std::vector<double> gains;
+	for (std::size_t i = 0; i < count; ++i) {
+		gains.push_back(1000.0 / (1 + i));
+		bank.addOscillator(mode(i), gains.back());
+		sections.push_back(compileBiquad(mode(i), Seconds(dt)));
+	}
+
+	// Events as (frame, oscillator, force), summed into a dense force for the reference
+	std::vector<std::size_t> frames, oscillators;
+	std::vector<double> strikes;
+	std::vector<double> force(count * blockSize * blocks, 0.0);
+	unsigned state = 2024;
+	for (int k = 0; k < 200; ++k) {
+		state = state * 1103515245u + 12345u;
+		frames.push_back((state >> 16) % (blockSize * blocks));
+		oscillators.push_back((state >> 8) % count);
+		strikes.push_back(0.1 + (state >> 24) / 256.0);
+		if (k % 7 == 0) {
+			// A second strike at the same instant
+			frames.push_back(frames.back());
+			oscillators.push_back(oscillators.back());
+			strikes.push_back(-0.05);
+		}
+	}
+	for (std::size_t k = 0; k < strikes.size(); ++k) {
+		force[frames[k] * count + oscillators[k]] += strikes[k];
+	}
+
+	std::vector<DirectForm> reference(count);
+	std::vector<double> block(blockSize);
+	for (std::size_t b = 0; b < blocks; ++b) {
+		for (std::size_t k = 0; k < strikes.size(); ++k) {
+			if (frames[k] / blockSize == b) {
+				BOOST_CHECK(bank.excite(oscillators[k], Newtons(strikes[k]), frames[k] % blockSize));
+			}
+		}
+		bank.render(block.data());
+		for (std::size_t n = 0; n < blockSize; ++n) {
+			double expected = 0;
+			for (std::size_t i = 0; i < count; ++i) {
+				expected += gains[i] * reference[i](sections[i], force[(b * blockSize + n) * count + i]);
+			}
+			BOOST_CHECK_SMALL(block[n] - expected, 1e-12 * (1 + std::fabs(expected)));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SilenceAndReset) {
+	VibrationBank<> bank(Seconds(dt), 64);
+	for (std::size_t i = 0; i < 40; ++i) {
+		bank.addOscillator(mode(i), 1000.0);
+	}
+	std::vector<double> block(64, 1.0);
+	bank.render(block.data());
+	for (std::size_t n = 0; n < 64; ++n) {
+		BOOST_CHECK_EQUAL(block[n], 0.0);
+	}
+
+	// Once below the threshold, a group falls exactly silent
+	bank.setSilenceThreshold(1e-6);
+	bank.excite(20, Newtons(1));
+	bank.render(block.data());
+	BOOST_CHECK_NE(block[10], 0.0);
+	int silentAfter = -1;
+	for (int b = 0; b < 2000 && silentAfter < 0; ++b) {
+		bank.render(block.data());
+		if (block[63] == 0.0) {
+			silentAfter = b;
+		}
+	}
+	BOOST_CHECK_GT(silentAfter, 0);
+	bank.render(block.data());
+	BOOST_CHECK_EQUAL(block[0], 0.0);
+
+	// And wakes on the next event
+	bank.excite(39, Newtons(1), 5);
+	bank.render(block.data());
+	BOOST_CHECK_EQUAL(block[5], 0.0);
+	BOOST_CHECK_NE(block[6], 0.0);
+
+	bank.excite(0, Newtons(1));
+	bank.reset();
+	bank.render(block.data());
+	for (std::size_t n = 0; n < 64; ++n) {
+		BOOST_CHECK_EQUAL(block[n], 0.0);
+	}
+}